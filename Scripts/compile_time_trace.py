@@ -0,0 +1,88 @@
+"""Summarise where clang spends front-end time on the RetroLibUE sources.
+
+Generate a compilation database with UnrealBuildTool first, e.g.
+
+    RunUBT.sh -mode=GenerateClangDatabase -project=<Project>.uproject <Target> Linux Development
+
+then run
+
+    python Scripts/compile_time_trace.py compile_commands.json --filter RetroLibUE/Tests --out trace.csv
+
+Each matching translation unit is recompiled with -ftime-trace and the heaviest template instantiations are written
+out as CSV, one row per (file, event, detail), so runs before and after a change can be diffed.
+"""
+
+import argparse
+import csv
+import json
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+from collections import defaultdict
+
+EVENTS = ("InstantiateFunction", "InstantiateClass", "ParseClass", "Frontend", "Backend")
+
+
+def load_commands(database, path_filter):
+    with open(database, encoding="utf-8") as f:
+        entries = json.load(f)
+    for entry in entries:
+        if path_filter and path_filter not in entry["file"].replace("\\", "/"):
+            continue
+        arguments = entry.get("arguments") or shlex.split(entry["command"])
+        yield entry["directory"], entry["file"], arguments
+
+
+def trace_file(directory, source, arguments, trace_dir):
+    obj = os.path.join(trace_dir, os.path.basename(source) + ".o")
+    args = [a for a in arguments]
+    if "-o" in args:
+        args[args.index("-o") + 1] = obj
+    else:
+        args += ["-o", obj]
+    args += ["-ftime-trace", "-ftime-trace-granularity=100"]
+    result = subprocess.run(args, cwd=directory, capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.stderr.write(f"failed: {source}\n{result.stderr}\n")
+        return None
+    with open(os.path.splitext(obj)[0] + ".json", encoding="utf-8") as f:
+        return json.load(f)
+
+
+def summarise(trace, top):
+    totals = defaultdict(int)
+    for event in trace.get("traceEvents", []):
+        name = event.get("name")
+        if name not in EVENTS or "dur" not in event:
+            continue
+        detail = event.get("args", {}).get("detail", "")
+        totals[(name, detail)] += event["dur"]
+    return sorted(totals.items(), key=lambda item: item[1], reverse=True)[:top]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("database", help="Path to compile_commands.json")
+    parser.add_argument("--filter", default="RetroLibUE/", help="Only trace files whose path contains this")
+    parser.add_argument("--top", type=int, default=25, help="Number of events to keep per file")
+    parser.add_argument("--out", default="-", help="CSV file to write, or - for stdout")
+    options = parser.parse_args()
+
+    out = sys.stdout if options.out == "-" else open(options.out, "w", newline="", encoding="utf-8")
+    writer = csv.writer(out)
+    writer.writerow(["file", "event", "detail", "milliseconds"])
+    with tempfile.TemporaryDirectory() as trace_dir:
+        for directory, source, arguments in load_commands(options.database, options.filter):
+            trace = trace_file(directory, source, arguments, trace_dir)
+            if trace is None:
+                continue
+            for (name, detail), duration in summarise(trace, options.top):
+                writer.writerow([source, name, detail, f"{duration / 1000:.1f}"])
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
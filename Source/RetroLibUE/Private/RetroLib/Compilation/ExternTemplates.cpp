@@ -0,0 +1,13 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Compilation/ExternTemplates.h"
+
+#if RETROLIB_EXTERN_TEMPLATES
+
+#define RETROLIB_DEFINE_TO_ARRAY(Type) RETROLIB_INSTANTIATE_TO_ARRAY(, Type)
+RETROLIB_FOR_EACH_PREINSTANTIATED_ELEMENT(RETROLIB_DEFINE_TO_ARRAY)
+#undef RETROLIB_DEFINE_TO_ARRAY
+
+RETROLIB_INSTANTIATE_DELEGATE_BINDERS()
+
+#endif
@@ -0,0 +1,60 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/Delegates.h"
+#include "RetroLib/Ranges/Algorithm/ToArray.h"
+
+#include <Containers/Array.h>
+#include <Delegates/Delegate.h>
+#include <UObject/NameTypes.h>
+
+#ifndef RETROLIB_EXTERN_TEMPLATES
+#define RETROLIB_EXTERN_TEMPLATES 0
+#endif
+
+/**
+ * The element types that ToArray is pre-instantiated for when collecting straight from a TArray.
+ *
+ * @param Op Macro invoked with each element type
+ */
+#define RETROLIB_FOR_EACH_PREINSTANTIATED_ELEMENT(Op)                                                                  \
+    Op(int32) Op(uint8) Op(float) Op(double) Op(FName) Op(FString) Op(UObject *)
+
+/**
+ * Declare or define the ToArray instantiations for a single element type.
+ *
+ * @param Prefix Either extern for the declaration or nothing for the definition
+ * @param Type The element type
+ */
+#define RETROLIB_INSTANTIATE_TO_ARRAY(Prefix, Type)                                                                    \
+    Prefix template TArray<Type> Retro::Ranges::TToArrayInvoker<FDefaultAllocator>::operator()<TArray<Type> &>(        \
+        TArray<Type> &) const;                                                                                         \
+    Prefix template TArray<Type> Retro::Ranges::TToArrayInvoker<FDefaultAllocator>::operator()<const TArray<Type> &>(  \
+        const TArray<Type> &) const;
+
+/**
+ * Declare or define the delegate factory instantiations for the simple delegate signatures, which are by far the most
+ * commonly bound to free functions.
+ *
+ * @param Prefix Either extern for the declaration or nothing for the definition
+ */
+#define RETROLIB_INSTANTIATE_DELEGATE_BINDERS(Prefix)                                                                  \
+    Prefix template FSimpleDelegate Retro::Delegates::Create<FSimpleDelegate, void (*)()>(void (*&&)());              \
+    Prefix template void Retro::Delegates::FDelegateBinder::operator()<FSimpleDelegate, void (*)()>(                  \
+        FSimpleDelegate &, void (*&&)()) const;                                                                        \
+    Prefix template FDelegateHandle                                                                                    \
+    Retro::Delegates::FDelegateAdder::operator()<FSimpleMulticastDelegate, void (*)()>(FSimpleMulticastDelegate &,     \
+                                                                                        void (*&&)()) const;
+
+#if RETROLIB_EXTERN_TEMPLATES
+
+// Every translation unit in the module sees these through the private PCH, and ExternTemplates.cpp provides the only
+// definitions, so the bodies are compiled once per module rather than once per translation unit
+#define RETROLIB_EXTERN_TO_ARRAY(Type) RETROLIB_INSTANTIATE_TO_ARRAY(extern, Type)
+RETROLIB_FOR_EACH_PREINSTANTIATED_ELEMENT(RETROLIB_EXTERN_TO_ARRAY)
+#undef RETROLIB_EXTERN_TO_ARRAY
+
+RETROLIB_INSTANTIATE_DELEGATE_BINDERS(extern)
+
+#endif
@@ -0,0 +1,138 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Functional/DynamicDelegates.h"
+
+#include <UObject/EnumProperty.h>
+#include <UObject/Stack.h>
+#include <UObject/TextProperty.h>
+#include <UObject/UnrealType.h>
+
+namespace Retro::Delegates {
+#if WITH_TESTS
+    namespace {
+        thread_local int32 NumProcessEventInvocations = 0;
+    } // namespace
+
+    int32 GetNumProcessEventInvocations() {
+        return NumProcessEventInvocations;
+    }
+#endif
+
+    bool FDynamicParamType::IsCompatibleWith(const FProperty &Property) const {
+        if (Property.GetSize() != Size) {
+            return false;
+        }
+
+        switch (Kind) {
+        case EKind::Bool:
+            return Property.IsA<FBoolProperty>();
+        case EKind::Int8:
+            return Property.IsA<FInt8Property>();
+        case EKind::Int16:
+            return Property.IsA<FInt16Property>();
+        case EKind::Int32:
+            return Property.IsA<FIntProperty>();
+        case EKind::Int64:
+            return Property.IsA<FInt64Property>();
+        case EKind::UInt8:
+            return Property.IsA<FByteProperty>();
+        case EKind::UInt16:
+            return Property.IsA<FUInt16Property>();
+        case EKind::UInt32:
+            return Property.IsA<FUInt32Property>();
+        case EKind::UInt64:
+            return Property.IsA<FUInt64Property>();
+        case EKind::Float:
+            return Property.IsA<FFloatProperty>();
+        case EKind::Double:
+            return Property.IsA<FDoubleProperty>();
+        case EKind::String:
+            return Property.IsA<FStrProperty>();
+        case EKind::Name:
+            return Property.IsA<FNameProperty>();
+        case EKind::Text:
+            return Property.IsA<FTextProperty>();
+        case EKind::Object: {
+            // The argument has to be usable wherever the parameter's class is expected
+            const auto *ObjectProperty = CastField<FObjectPropertyBase>(&Property);
+            return ObjectProperty != nullptr && ObjectProperty->PropertyClass != nullptr &&
+                   GetStruct()->IsChildOf(ObjectProperty->PropertyClass);
+        }
+        case EKind::Enum:
+            return Property.IsA<FEnumProperty>() || Property.IsA<FByteProperty>();
+        case EKind::Struct: {
+            const auto *StructProperty = CastField<FStructProperty>(&Property);
+            return StructProperty != nullptr && StructProperty->Struct == GetStruct();
+        }
+        default:
+            return true;
+        }
+    }
+
+    FDynamicFunctionLayout::FDynamicFunctionLayout(UFunction *Function)
+        : Function(Function), WeakFunction(Function), ParmsSize(Function->ParmsSize),
+          MinAlignment(FMath::Max<int32>(Function->GetMinAlignment(), 1)),
+          bNative(Function->HasAnyFunctionFlags(FUNC_Native) && !Function->HasAnyFunctionFlags(FUNC_Net)) {
+        for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It) {
+            if (It->HasAnyPropertyFlags(CPF_ReturnParm)) {
+                ReturnProperty = *It;
+                ReturnOffset = It->GetOffset_ForUFunction();
+            } else {
+                Params.Add(*It);
+                ParamOffsets.Add(It->GetOffset_ForUFunction());
+            }
+
+            if (It->HasAnyPropertyFlags(CPF_OutParm)) {
+                OutParms.Add(*It);
+            }
+        }
+    }
+
+    TSharedRef<const FDynamicFunctionLayout, ESPMode::NotThreadSafe>
+    FDynamicFunctionCache::Find(UObject *Object, FName FunctionName) {
+        const UClass *Class = Object->GetClass();
+        for (const FEntry &Entry : Entries) {
+            // The function is checked as well so that a class that was reinstanced at the same address is not
+            // matched against a stale layout
+            if (Entry.Class == Class && Entry.FunctionName == FunctionName && Entry.Layout->WeakFunction.IsValid()) {
+                return Entry.Layout;
+            }
+        }
+
+        if (Entries.Num() >= MaxEntries) {
+            Entries.Reset();
+        } else {
+            Entries.RemoveAll([](const FEntry &Entry) { return !Entry.Layout->WeakFunction.IsValid(); });
+        }
+
+        auto Layout =
+            MakeShared<const FDynamicFunctionLayout, ESPMode::NotThreadSafe>(Object->FindFunctionChecked(FunctionName));
+        Entries.Add({Class, FunctionName, Layout});
+        return Layout;
+    }
+
+    void InvokeDynamicFunction(UObject *Object, const FDynamicFunctionLayout &Layout, uint8 *Parms) {
+        if (!Layout.bNative) {
+#if WITH_TESTS
+            NumProcessEventInvocations++;
+#endif
+            Object->ProcessEvent(Layout.Function, Parms);
+            return;
+        }
+
+        // Mirror the frame that ProcessEvent sets up for a native function, minus the copy of the parameters
+        FFrame Stack(Object, Layout.Function, Parms, nullptr, Layout.Function->ChildProperties);
+        auto *OutParms = static_cast<FOutParmRec *>(FMemory_Alloca(sizeof(FOutParmRec) * Layout.OutParms.Num()));
+        FOutParmRec **LastOut = &Stack.OutParms;
+        for (int32 i = 0; i < Layout.OutParms.Num(); i++) {
+            OutParms[i].Property = Layout.OutParms[i];
+            OutParms[i].PropAddr = Layout.OutParms[i]->ContainerPtrToValuePtr<uint8>(Parms);
+            *LastOut = &OutParms[i];
+            LastOut = &OutParms[i].NextOutParm;
+        }
+        *LastOut = nullptr;
+
+        uint8 *ReturnValue = Layout.ReturnOffset != INDEX_NONE ? Parms + Layout.ReturnOffset : nullptr;
+        Layout.Function->Invoke(Object, Stack, ReturnValue);
+    }
+} // namespace Retro::Delegates
@@ -0,0 +1,93 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Functional/GameThreadDispatch.h"
+
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+
+namespace Retro::Delegates {
+    FGameThreadDispatcher::~FGameThreadDispatcher() {
+        Discard();
+    }
+
+    FGameThreadDispatcher &FGameThreadDispatcher::Get() {
+        static FGameThreadDispatcher Dispatcher;
+        return Dispatcher;
+    }
+
+    int32 FGameThreadDispatcher::Flush() {
+        check(IsInGameThread());
+        FCall *Calls = TakeAll();
+        if (Calls == nullptr) {
+            return 0;
+        }
+
+        RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::FlushGameThreadCalls"));
+
+        // Only the most recent call for each key survives, which is the last one in queue order
+        TMap<uint64, FCall *, TInlineSetAllocator<16>> LatestByKey;
+        for (FCall *Call = Calls; Call != nullptr; Call = Call->Next) {
+            if (Call->CoalescingKey.IsSet()) {
+                LatestByKey.Add(Call->CoalescingKey.GetValue(), Call);
+            }
+        }
+
+        int32 NumExecuted = 0;
+        while (Calls != nullptr) {
+            FCall *Call = Calls;
+            Calls = Call->Next;
+            if (!Call->CoalescingKey.IsSet() || LatestByKey.FindChecked(Call->CoalescingKey.GetValue()) == Call) {
+                Call->Execute();
+                NumExecuted++;
+            }
+            Free(Call);
+        }
+
+        RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, NumExecuted);
+        return NumExecuted;
+    }
+
+    void FGameThreadDispatcher::Discard() {
+        FCall *Calls = TakeAll();
+        while (Calls != nullptr) {
+            FCall *Call = Calls;
+            Calls = Call->Next;
+            Free(Call);
+        }
+    }
+
+    void *FGameThreadDispatcher::Allocate(SIZE_T Size) {
+        RETROLIB_LLM_SCOPE();
+        return Size <= BlockSize ? BlockAllocator.Allocate() : FMemory::Malloc(Size, 16);
+    }
+
+    void FGameThreadDispatcher::Free(FCall *Call) {
+        uint32 Size = Call->AllocationSize;
+        Call->~FCall();
+        if (Size <= BlockSize) {
+            BlockAllocator.Free(Call);
+        } else {
+            FMemory::Free(Call);
+        }
+    }
+
+    void FGameThreadDispatcher::Push(FCall *Call) {
+        FCall *OldHead = Head.load(std::memory_order_relaxed);
+        do {
+            Call->Next = OldHead;
+        } while (!Head.compare_exchange_weak(OldHead, Call, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    FGameThreadDispatcher::FCall *FGameThreadDispatcher::TakeAll() {
+        // The stack is newest first, so reverse it to run the calls in the order they were made
+        FCall *Stack = Head.exchange(nullptr, std::memory_order_acquire);
+        FCall *Queue = nullptr;
+        while (Stack != nullptr) {
+            FCall *Next = Stack->Next;
+            Stack->Next = Queue;
+            Queue = Stack;
+            Stack = Next;
+        }
+        return Queue;
+    }
+} // namespace Retro::Delegates
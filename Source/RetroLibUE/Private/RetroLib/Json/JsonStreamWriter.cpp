@@ -0,0 +1,229 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Json/JsonStreamWriter.h"
+
+#include <Misc/CString.h>
+
+namespace Retro::Json {
+    namespace {
+        constexpr ANSICHAR HexDigits[] = "0123456789abcdef";
+
+        constexpr uint32 ReplacementCharacter = 0xFFFD;
+
+        bool IsHighSurrogate(uint32 CodeUnit) {
+            return CodeUnit >= 0xD800 && CodeUnit <= 0xDBFF;
+        }
+
+        bool IsLowSurrogate(uint32 CodeUnit) {
+            return CodeUnit >= 0xDC00 && CodeUnit <= 0xDFFF;
+        }
+    } // namespace
+
+    FJsonStreamWriter::FJsonStreamWriter(FArchive &Ar, int32 FlushThreshold)
+        : Archive(&Ar), Output(&Buffer), FlushThreshold(FlushThreshold) {
+        check(Ar.IsSaving());
+        check(FlushThreshold > 0);
+
+        // Leave room for the value that crosses the threshold so that the buffer never has to grow
+        Buffer.Reserve(FlushThreshold + 256);
+    }
+
+    FJsonStreamWriter::FJsonStreamWriter(TArray<uint8> &Bytes) : Output(&Bytes) {
+    }
+
+    FJsonStreamWriter::~FJsonStreamWriter() {
+        Flush();
+    }
+
+    void FJsonStreamWriter::BeginObject() {
+        BeginValue();
+        Output->Add('{');
+        bNeedsComma = false;
+        Depth++;
+    }
+
+    void FJsonStreamWriter::EndObject() {
+        check(Depth > 0);
+        Depth--;
+        Output->Add('}');
+        EndValue();
+    }
+
+    void FJsonStreamWriter::BeginArray() {
+        BeginValue();
+        Output->Add('[');
+        bNeedsComma = false;
+        Depth++;
+    }
+
+    void FJsonStreamWriter::EndArray() {
+        check(Depth > 0);
+        Depth--;
+        Output->Add(']');
+        EndValue();
+    }
+
+    void FJsonStreamWriter::WriteKey(FStringView Key) {
+        check(Depth > 0);
+        BeginValue();
+        AppendEscaped(Key);
+        Output->Add(':');
+        bNeedsComma = false;
+    }
+
+    void FJsonStreamWriter::WriteNull() {
+        BeginValue();
+        Append("null", 4);
+        EndValue();
+    }
+
+    void FJsonStreamWriter::WriteBool(bool bValue) {
+        BeginValue();
+        if (bValue) {
+            Append("true", 4);
+        } else {
+            Append("false", 5);
+        }
+        EndValue();
+    }
+
+    void FJsonStreamWriter::WriteInt(int64 Value) {
+        BeginValue();
+        // Negate in unsigned arithmetic so that the minimum value does not overflow
+        AppendInteger(Value < 0 ? 0 - static_cast<uint64>(Value) : static_cast<uint64>(Value), Value < 0);
+        EndValue();
+    }
+
+    void FJsonStreamWriter::WriteUInt(uint64 Value) {
+        BeginValue();
+        AppendInteger(Value, false);
+        EndValue();
+    }
+
+    void FJsonStreamWriter::WriteFloat(float Value) {
+        if (!FMath::IsFinite(Value)) {
+            WriteNull();
+            return;
+        }
+
+        BeginValue();
+        ANSICHAR Digits[32];
+        int32 Num = FCStringAnsi::Snprintf(Digits, UE_ARRAY_COUNT(Digits), "%.9g", Value);
+        Append(Digits, Num);
+        EndValue();
+    }
+
+    void FJsonStreamWriter::WriteDouble(double Value) {
+        if (!FMath::IsFinite(Value)) {
+            WriteNull();
+            return;
+        }
+
+        BeginValue();
+        ANSICHAR Digits[32];
+        int32 Num = FCStringAnsi::Snprintf(Digits, UE_ARRAY_COUNT(Digits), "%.17g", Value);
+        Append(Digits, Num);
+        EndValue();
+    }
+
+    void FJsonStreamWriter::WriteString(FStringView Value) {
+        BeginValue();
+        AppendEscaped(Value);
+        EndValue();
+    }
+
+    void FJsonStreamWriter::Flush() {
+        if (Archive != nullptr && Output->Num() > 0) {
+            Archive->Serialize(Output->GetData(), Output->Num());
+            Output->Reset();
+        }
+    }
+
+    void FJsonStreamWriter::AppendInteger(uint64 Magnitude, bool bNegative) {
+        ANSICHAR Digits[24];
+        ANSICHAR *End = Digits + UE_ARRAY_COUNT(Digits);
+        ANSICHAR *Cursor = End;
+        do {
+            *--Cursor = static_cast<ANSICHAR>('0' + Magnitude % 10);
+            Magnitude /= 10;
+        } while (Magnitude != 0);
+
+        if (bNegative) {
+            *--Cursor = '-';
+        }
+        Append(Cursor, static_cast<int32>(End - Cursor));
+    }
+
+    void FJsonStreamWriter::AppendEscaped(FStringView String) {
+        // Every code unit produces at most six bytes, reserving the common case of one byte each up front avoids most
+        // of the incremental growth
+        Output->Reserve(Output->Num() + String.Len() + 2);
+        Output->Add('"');
+
+        const TCHAR *Data = String.GetData();
+        int32 Num = String.Len();
+        for (int32 i = 0; i < Num; i++) {
+            uint32 CodeUnit = static_cast<uint32>(Data[i]);
+            if (CodeUnit < 0x80) {
+                switch (CodeUnit) {
+                case '"':
+                    Append("\\\"", 2);
+                    break;
+                case '\\':
+                    Append("\\\\", 2);
+                    break;
+                case '\n':
+                    Append("\\n", 2);
+                    break;
+                case '\r':
+                    Append("\\r", 2);
+                    break;
+                case '\t':
+                    Append("\\t", 2);
+                    break;
+                default:
+                    if (CodeUnit < 0x20) {
+                        ANSICHAR Escape[] = {'\\', 'u', '0', '0', HexDigits[CodeUnit >> 4], HexDigits[CodeUnit & 0xF]};
+                        Append(Escape, UE_ARRAY_COUNT(Escape));
+                    } else {
+                        Output->Add(static_cast<uint8>(CodeUnit));
+                    }
+                    break;
+                }
+                continue;
+            }
+
+            // TCHAR is UTF-16 on most platforms, so pairs of surrogates have to be combined into a single code point
+            // before it can be encoded as UTF-8
+            uint32 CodePoint = CodeUnit;
+            if (IsHighSurrogate(CodeUnit)) {
+                if (i + 1 < Num && IsLowSurrogate(static_cast<uint32>(Data[i + 1]))) {
+                    CodePoint = 0x10000 + ((CodeUnit - 0xD800) << 10) + (static_cast<uint32>(Data[++i]) - 0xDC00);
+                } else {
+                    CodePoint = ReplacementCharacter;
+                }
+            } else if (IsLowSurrogate(CodeUnit) || CodeUnit > 0x10FFFF) {
+                CodePoint = ReplacementCharacter;
+            }
+
+            if (CodePoint < 0x800) {
+                uint8 Bytes[] = {static_cast<uint8>(0xC0 | (CodePoint >> 6)),
+                                 static_cast<uint8>(0x80 | (CodePoint & 0x3F))};
+                Output->Append(Bytes, UE_ARRAY_COUNT(Bytes));
+            } else if (CodePoint < 0x10000) {
+                uint8 Bytes[] = {static_cast<uint8>(0xE0 | (CodePoint >> 12)),
+                                 static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)),
+                                 static_cast<uint8>(0x80 | (CodePoint & 0x3F))};
+                Output->Append(Bytes, UE_ARRAY_COUNT(Bytes));
+            } else {
+                uint8 Bytes[] = {static_cast<uint8>(0xF0 | (CodePoint >> 18)),
+                                 static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F)),
+                                 static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)),
+                                 static_cast<uint8>(0x80 | (CodePoint & 0x3F))};
+                Output->Append(Bytes, UE_ARRAY_COUNT(Bytes));
+            }
+        }
+
+        Output->Add('"');
+    }
+} // namespace Retro::Json
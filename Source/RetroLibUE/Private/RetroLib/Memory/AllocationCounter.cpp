@@ -0,0 +1,186 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Memory/AllocationCounter.h"
+
+#include <HAL/MemoryBase.h>
+
+#include <atomic>
+
+namespace Retro {
+    namespace {
+        thread_local FScopedAllocationCounter *CurrentCounter = nullptr;
+
+        /**
+         * Malloc proxy that forwards everything to the original allocator, reporting each call to the active
+         * allocation counters of the calling thread.
+         */
+        class FCountingMallocProxy final : public FMalloc {
+          public:
+            explicit FCountingMallocProxy(FMalloc *InnerMalloc) : InnerMalloc(InnerMalloc) {
+            }
+
+            void *Malloc(SIZE_T Count, uint32 Alignment) override {
+                FScopedAllocationCounter::RecordAllocation(Count);
+                return InnerMalloc->Malloc(Count, Alignment);
+            }
+
+            void *TryMalloc(SIZE_T Count, uint32 Alignment) override {
+                FScopedAllocationCounter::RecordAllocation(Count);
+                return InnerMalloc->TryMalloc(Count, Alignment);
+            }
+
+            void *MallocZeroed(SIZE_T Count, uint32 Alignment) override {
+                FScopedAllocationCounter::RecordAllocation(Count);
+                return InnerMalloc->MallocZeroed(Count, Alignment);
+            }
+
+            void *TryMallocZeroed(SIZE_T Count, uint32 Alignment) override {
+                FScopedAllocationCounter::RecordAllocation(Count);
+                return InnerMalloc->TryMallocZeroed(Count, Alignment);
+            }
+
+            void *Realloc(void *Original, SIZE_T Count, uint32 Alignment) override {
+                RecordRealloc(Original, Count);
+                return InnerMalloc->Realloc(Original, Count, Alignment);
+            }
+
+            void *TryRealloc(void *Original, SIZE_T Count, uint32 Alignment) override {
+                RecordRealloc(Original, Count);
+                return InnerMalloc->TryRealloc(Original, Count, Alignment);
+            }
+
+            void Free(void *Original) override {
+                if (Original != nullptr) {
+                    FScopedAllocationCounter::RecordFree();
+                }
+                InnerMalloc->Free(Original);
+            }
+
+            bool GetAllocationSize(void *Original, SIZE_T &SizeOut) override {
+                return InnerMalloc->GetAllocationSize(Original, SizeOut);
+            }
+
+            SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override {
+                return InnerMalloc->QuantizeSize(Count, Alignment);
+            }
+
+            void Trim(bool bTrimThreadCaches) override {
+                InnerMalloc->Trim(bTrimThreadCaches);
+            }
+
+            void SetupTLSCachesOnCurrentThread() override {
+                InnerMalloc->SetupTLSCachesOnCurrentThread();
+            }
+
+            void ClearAndDisableTLSCachesOnCurrentThread() override {
+                InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+            }
+
+            void InitializeStatsMetadata() override {
+                InnerMalloc->InitializeStatsMetadata();
+            }
+
+            void UpdateStats() override {
+                InnerMalloc->UpdateStats();
+            }
+
+            void GetAllocatorStats(FGenericMemoryStats &OutStats) override {
+                InnerMalloc->GetAllocatorStats(OutStats);
+            }
+
+            void DumpAllocatorStats(FOutputDevice &Ar) override {
+                InnerMalloc->DumpAllocatorStats(Ar);
+            }
+
+            bool IsInternallyThreadSafe() const override {
+                return InnerMalloc->IsInternallyThreadSafe();
+            }
+
+            bool ValidateHeap() override {
+                return InnerMalloc->ValidateHeap();
+            }
+
+            const TCHAR *GetDescriptiveName() override {
+                return InnerMalloc->GetDescriptiveName();
+            }
+
+            bool Exec(UWorld *InWorld, const TCHAR *Cmd, FOutputDevice &Ar) override {
+                return InnerMalloc->Exec(InWorld, Cmd, Ar);
+            }
+
+            void OnMallocInitialized() override {
+                InnerMalloc->OnMallocInitialized();
+            }
+
+            void OnPreFork() override {
+                InnerMalloc->OnPreFork();
+            }
+
+            void OnPostFork() override {
+                InnerMalloc->OnPostFork();
+            }
+
+          private:
+            static void RecordRealloc(void *Original, SIZE_T Count) {
+                if (Count > 0) {
+                    FScopedAllocationCounter::RecordAllocation(Count);
+                } else if (Original != nullptr) {
+                    FScopedAllocationCounter::RecordFree();
+                }
+            }
+
+            FMalloc *InnerMalloc;
+        };
+
+        std::atomic<bool> bProxyInstalled = false;
+    } // namespace
+
+    void FScopedAllocationCounter::InstallProxy() {
+        check(IsInGameThread());
+        if (bProxyInstalled.exchange(true)) {
+            return;
+        }
+
+        // Intentionally leaked, there may be allocations in flight through the proxy at shutdown. Blocks that were
+        // allocated before this point are freed through the proxy as well, which simply forwards them.
+        FMalloc *Proxy = new FCountingMallocProxy(GMalloc);
+        FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void **>(&GMalloc), Proxy);
+    }
+
+    bool FScopedAllocationCounter::IsProxyInstalled() {
+        return bProxyInstalled.load(std::memory_order_relaxed);
+    }
+
+    FScopedAllocationCounter::FScopedAllocationCounter() {
+        Previous = CurrentCounter;
+        CurrentCounter = this;
+    }
+
+    FScopedAllocationCounter::~FScopedAllocationCounter() {
+        check(CurrentCounter == this);
+        CurrentCounter = Previous;
+    }
+
+    FScopedAllocationBudget::FScopedAllocationBudget(const TCHAR *Name, int64 MaxAllocations)
+        : Name(Name), MaxAllocations(MaxAllocations) {
+    }
+
+    FScopedAllocationBudget::~FScopedAllocationBudget() {
+        // Without the proxy nothing is counted, so the budget could never be exceeded anyway
+        ensureMsgf(IsWithinBudget(), TEXT("%s made %lld allocations (%lld bytes), the budget is %lld"), Name,
+                   GetNumAllocations(), GetNumBytes(), MaxAllocations);
+    }
+
+    void FScopedAllocationCounter::RecordAllocation(SIZE_T Size) {
+        for (FScopedAllocationCounter *Counter = CurrentCounter; Counter != nullptr; Counter = Counter->Previous) {
+            Counter->NumAllocations++;
+            Counter->NumBytes += static_cast<int64>(Size);
+        }
+    }
+
+    void FScopedAllocationCounter::RecordFree() {
+        for (FScopedAllocationCounter *Counter = CurrentCounter; Counter != nullptr; Counter = Counter->Previous) {
+            Counter->NumFrees++;
+        }
+    }
+} // namespace Retro
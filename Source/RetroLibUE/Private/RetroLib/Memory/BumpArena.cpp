@@ -0,0 +1,140 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Memory/BumpArena.h"
+
+namespace Retro {
+    FBumpArena::FBumpArena(SIZE_T BlockSize) : BlockSize(BlockSize) {
+    }
+
+    FBumpArena::~FBumpArena() {
+        check(NumMarks == 0);
+        FBlock *Block = FirstBlock;
+        while (Block != nullptr) {
+            FBlock *Next = Block->Next;
+            FMemory::Free(Block);
+            Block = Next;
+        }
+    }
+
+    FBumpArena &FBumpArena::Get() {
+        static thread_local FBumpArena Arena;
+        return Arena;
+    }
+
+    void FBumpArena::ResetFrameArena() {
+        check(IsInGameThread());
+        if (FBumpArena &Arena = Get(); Arena.NumMarks == 0) {
+            Arena.Reset();
+        }
+    }
+
+    void *FBumpArena::Allocate(SIZE_T Size, SIZE_T Alignment) {
+        uint8 *Result = Align(Top, Alignment);
+        if (Top == nullptr || Result + Size > End) {
+            AdvanceBlock(Size, Alignment);
+            Result = Align(Top, Alignment);
+        }
+
+        Top = Result + Size;
+        return Result;
+    }
+
+    void *FBumpArena::Reallocate(void *Original, SIZE_T OldSize, SIZE_T NewSize, SIZE_T Alignment) {
+        auto OriginalBytes = static_cast<uint8 *>(Original);
+        if (OriginalBytes != nullptr && OriginalBytes + OldSize == Top && OriginalBytes + NewSize <= End) {
+            Top = OriginalBytes + NewSize;
+            return Original;
+        }
+
+        void *Result = Allocate(NewSize, Alignment);
+        if (Original != nullptr) {
+            FMemory::Memcpy(Result, Original, FMath::Min(OldSize, NewSize));
+        }
+
+        return Result;
+    }
+
+    void FBumpArena::Reset() {
+        Rewind(FirstBlock, FirstBlock != nullptr ? FirstBlock->GetData() : nullptr);
+    }
+
+    void FBumpArena::Trim() {
+        if (CurrentBlock == nullptr) {
+            return;
+        }
+
+        FBlock *Block = CurrentBlock->Next;
+        CurrentBlock->Next = nullptr;
+        while (Block != nullptr) {
+            FBlock *Next = Block->Next;
+            FMemory::Free(Block);
+            Block = Next;
+        }
+    }
+
+    SIZE_T FBumpArena::GetReservedSize() const {
+        SIZE_T Result = 0;
+        for (FBlock *Block = FirstBlock; Block != nullptr; Block = Block->Next) {
+            Result += Block->Size;
+        }
+
+        return Result;
+    }
+
+    void FBumpArena::AdvanceBlock(SIZE_T Size, SIZE_T Alignment) {
+        SIZE_T Required = Size + Alignment;
+
+        // Reuse the blocks left over from a previous rewind if they are large enough
+        FBlock *Candidate = CurrentBlock != nullptr ? CurrentBlock->Next : FirstBlock;
+        if (Candidate != nullptr && Candidate->Size >= Required) {
+            CurrentBlock = Candidate;
+        } else {
+            SIZE_T NewSize = FMath::Max(BlockSize, Required);
+            auto NewBlock = static_cast<FBlock *>(FMemory::Malloc(sizeof(FBlock) + NewSize, alignof(FBlock)));
+            NewBlock->Size = NewSize;
+            NewBlock->Next = Candidate;
+            if (CurrentBlock != nullptr) {
+                CurrentBlock->Next = NewBlock;
+            } else {
+                FirstBlock = NewBlock;
+            }
+            CurrentBlock = NewBlock;
+        }
+
+        Top = CurrentBlock->GetData();
+        End = Top + CurrentBlock->Size;
+    }
+
+    void FBumpArena::Rewind(FBlock *Block, uint8 *Position) {
+        if (Block == nullptr) {
+            // The arena had not allocated anything when the position was recorded
+            CurrentBlock = nullptr;
+            Top = nullptr;
+            End = nullptr;
+            return;
+        }
+
+        CurrentBlock = Block;
+        Top = Position;
+        End = Block->GetData() + Block->Size;
+    }
+
+    FBumpArenaMark::FBumpArenaMark(FBumpArena &Arena)
+        : Arena(Arena), SavedBlock(Arena.CurrentBlock), SavedTop(Arena.Top) {
+        ++Arena.NumMarks;
+    }
+
+    FBumpArenaMark::~FBumpArenaMark() {
+        Pop();
+    }
+
+    void FBumpArenaMark::Pop() {
+        if (bPopped) {
+            return;
+        }
+
+        Arena.Rewind(SavedBlock, SavedTop);
+        --Arena.NumMarks;
+        bPopped = true;
+    }
+} // namespace Retro
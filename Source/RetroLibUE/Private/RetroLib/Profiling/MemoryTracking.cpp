@@ -0,0 +1,5 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Profiling/MemoryTracking.h"
+
+LLM_DEFINE_TAG(RetroLib);
@@ -0,0 +1,13 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Profiling/Trace.h"
+
+#if RETROLIB_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(RetroLibChannel);
+
+TRACE_DECLARE_INT_COUNTER(RetroLib_ElementsVisited, TEXT("RetroLib/Elements Visited"));
+TRACE_DECLARE_INT_COUNTER(RetroLib_ElementsFiltered, TEXT("RetroLib/Elements Filtered"));
+TRACE_DECLARE_INT_COUNTER(RetroLib_BytesAllocated, TEXT("RetroLib/Bytes Allocated"));
+
+#endif
@@ -0,0 +1,98 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Ranges/Views/AssetQuery.h"
+
+#include "RetroLib/Profiling/Trace.h"
+
+#include <AssetRegistry/IAssetRegistry.h>
+
+namespace Retro::Ranges {
+    FAssetQuery &FAssetQuery::OfClass(FTopLevelAssetPath ClassPath, bool bRecursive) {
+        Filter.ClassPaths.Add(ClassPath);
+        Filter.bRecursiveClasses |= bRecursive;
+        return *this;
+    }
+
+    FAssetQuery &FAssetQuery::UnderPath(FName PackagePath, bool bRecursive) {
+        Filter.PackagePaths.Add(PackagePath);
+        Filter.bRecursivePaths |= bRecursive;
+        return *this;
+    }
+
+    FAssetQuery &FAssetQuery::WithTag(FName Tag, TOptional<FString> Value) {
+        Filter.TagsAndValues.Add(Tag, MoveTemp(Value));
+        return *this;
+    }
+
+    FAssetQuery &FAssetQuery::OnDiskOnly() {
+        Filter.bIncludeOnlyOnDiskAssets = true;
+        return *this;
+    }
+
+    FAssetQuery &FAssetQuery::Where(TFunction<bool(const FAssetData &)> Predicate) {
+        Predicates.Add(MoveTemp(Predicate));
+        return *this;
+    }
+
+    FAssetQuery &FAssetQuery::Take(int32 Count) {
+        check(Count >= 0);
+        Limit = Limit == INDEX_NONE ? Count : FMath::Min(Limit, Count);
+        return *this;
+    }
+
+    int32 FAssetQuery::ForEach(TFunctionRef<bool(const FAssetData &)> Callback) const {
+        RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::FAssetQuery::ForEach"));
+        if (Limit == 0) {
+            return 0;
+        }
+
+        int32 NumVisited = 0;
+        int32 NumProduced = 0;
+        auto Visit = [&](const FAssetData &Asset) {
+            NumVisited++;
+            for (const TFunction<bool(const FAssetData &)> &Predicate : Predicates) {
+                if (!Predicate(Asset)) {
+                    return true;
+                }
+            }
+
+            NumProduced++;
+            return Callback(Asset) && (Limit == INDEX_NONE || NumProduced < Limit);
+        };
+
+        IAssetRegistry &AssetRegistry = Registry != nullptr ? *Registry : IAssetRegistry::GetChecked();
+        // The registry treats an empty filter as matching nothing, whereas an unconstrained query should see
+        // everything. IsEmpty ignores the on-disk flag, so it has to be passed along separately.
+        if (Filter.IsEmpty()) {
+            AssetRegistry.EnumerateAllAssets(Visit, Filter.bIncludeOnlyOnDiskAssets);
+        } else {
+            AssetRegistry.EnumerateAssets(Filter, Visit);
+        }
+
+        RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, NumVisited);
+        RETROLIB_TRACE_COUNTER_ADD(ElementsFiltered, NumVisited - NumProduced);
+        return NumProduced;
+    }
+
+    int32 FAssetQuery::Count() const {
+        return ForEach([](const FAssetData &) { return true; });
+    }
+
+    TOptional<FAssetData> FAssetQuery::First() const {
+        TOptional<FAssetData> Result;
+        ForEach([&Result](const FAssetData &Asset) {
+            Result.Emplace(Asset);
+            return false;
+        });
+        return Result;
+    }
+
+    TArray<FAssetData> FAssetQuery::ToArray() const {
+        TArray<FAssetData> Result;
+        ForEach([&Result](const FAssetData &Asset) {
+            Result.Add(Asset);
+            return true;
+        });
+        return Result;
+    }
+} // namespace Retro::Ranges
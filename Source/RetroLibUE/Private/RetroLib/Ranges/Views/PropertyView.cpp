@@ -0,0 +1,101 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Ranges/Views/PropertyView.h"
+
+#include <Misc/ScopeRWLock.h>
+
+namespace Retro::Ranges {
+    namespace {
+        struct FPropertyLayoutKey {
+            const UStruct *Struct;
+            FFieldClass *PropertyClass;
+            EFieldIterationFlags Flags;
+
+            bool operator==(const FPropertyLayoutKey &) const = default;
+
+            friend uint32 GetTypeHash(const FPropertyLayoutKey &Key) {
+                return HashCombineFast(HashCombineFast(GetTypeHash(Key.Struct), GetTypeHash(Key.PropertyClass)),
+                                       GetTypeHash(static_cast<uint8>(Key.Flags)));
+            }
+        };
+
+        FRWLock CacheLock;
+        TMap<FPropertyLayoutKey, TSharedRef<const FPropertyLayout>> Cache;
+
+        template <typename T>
+        int32 GetArrayDim(const T *Property) {
+            if constexpr (requires { Property->GetArrayDim(); }) {
+                return Property->GetArrayDim();
+            } else {
+                return Property->ArrayDim;
+            }
+        }
+
+        template <typename T>
+        int32 GetElementSize(const T *Property) {
+            if constexpr (requires { Property->GetElementSize(); }) {
+                return Property->GetElementSize();
+            } else {
+                return Property->ElementSize;
+            }
+        }
+    } // namespace
+
+    FPropertyLayout::FPropertyLayout(const UStruct *Struct, FFieldClass *PropertyClass, EFieldIterationFlags Flags)
+        : Owner(Struct), ChildProperties(Struct->ChildProperties),
+          PropertyLink(Struct->PropertyLink), PropertiesSize(Struct->GetPropertiesSize()) {
+        for (TFieldIterator<FProperty> It(Struct, Flags); It; ++It) {
+            FProperty *Property = *It;
+            if (!Property->IsA(PropertyClass)) {
+                continue;
+            }
+
+            int32 ElementSize = GetElementSize(Property);
+            for (int32 i = 0; i < GetArrayDim(Property); i++) {
+                Entries.Add({Property, Property->GetOffset_ForInternal() + i * ElementSize, ElementSize});
+            }
+        }
+    }
+
+    TSharedRef<const FPropertyLayout> FPropertyLayout::Get(const UStruct *Struct, FFieldClass *PropertyClass,
+                                                           EFieldIterationFlags Flags) {
+        check(Struct != nullptr);
+        FPropertyLayoutKey Key{Struct, PropertyClass, Flags};
+        {
+            FReadScopeLock Lock(CacheLock);
+            if (const auto *Existing = Cache.Find(Key); Existing != nullptr && (*Existing)->Matches(Struct)) {
+                return *Existing;
+            }
+        }
+
+        // Build outside of the lock, in the worst case two threads build the same layout and one of them wins
+        auto Layout = MakeShared<const FPropertyLayout>(Struct, PropertyClass, Flags);
+        FWriteScopeLock Lock(CacheLock);
+        if (const auto *Existing = Cache.Find(Key); Existing != nullptr && (*Existing)->Matches(Struct)) {
+            return *Existing;
+        }
+
+        Cache.Add(Key, Layout);
+        return Layout;
+    }
+
+    void FPropertyLayout::Invalidate(const UStruct *Struct) {
+        FWriteScopeLock Lock(CacheLock);
+        for (auto It = Cache.CreateIterator(); It; ++It) {
+            if (It.Key().Struct == Struct) {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    void FPropertyLayout::InvalidateAll() {
+        FWriteScopeLock Lock(CacheLock);
+        Cache.Empty();
+    }
+
+    bool FPropertyLayout::Matches(const UStruct *Struct) const {
+        // The weak pointer guards against a new struct being allocated at the address of a destroyed one
+        return Owner.Get() == Struct && ChildProperties == Struct->ChildProperties &&
+               PropertyLink == Struct->PropertyLink && PropertiesSize == Struct->GetPropertiesSize();
+    }
+} // namespace Retro::Ranges
@@ -2,21 +2,58 @@
 
 #include "RetroLibUE.h"
 
+#include "Containers/Ticker.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Parse.h"
+#include "RetroLib/Functional/GameThreadDispatch.h"
+#include "RetroLib/Memory/AllocationCounter.h"
+#include "RetroLib/Memory/BumpArena.h"
 #include "RetroLib/Optionals/Compatiblity/UnrealOptional.h"
 #include "RetroLib/Optionals/Filter.h"
 #include "RetroLib/Ranges/Algorithm/To.h"
 #include "RetroLib/Ranges/Compatibility/UnrealContainers.h"
+#include "RetroLib/Ranges/Views/PropertyView.h"
+#include "UObject/UObjectGlobals.h"
 
 #include <array>
 
 #define LOCTEXT_NAMESPACE "FRetroLibUEModule"
 
 void FRetroLibUEModule::StartupModule() {
+#if !UE_BUILD_SHIPPING
+    // Every allocation in the process goes through the proxy once installed, so it is only put in place when asked
+    // for. Done here rather than on first use, so the allocator is swapped once during startup instead of mid-run.
+    if (FParse::Param(FCommandLine::Get(), TEXT("RetroCountAllocs"))) {
+        Retro::FScopedAllocationCounter::InstallProxy();
+    }
+#endif
+
+    EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&Retro::FBumpArena::ResetFrameArena);
+
+    // Reinstancing and reloads can relink structs in place, so any cached property layouts may be stale
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda(
+        [](EReloadCompleteReason) { Retro::Ranges::FPropertyLayout::InvalidateAll(); });
+    ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda(
+        [](const FCoreUObjectDelegates::FReplacementObjectMap &) { Retro::Ranges::FPropertyLayout::InvalidateAll(); });
+
+    // Drain everything marshalled to the game thread in one go each tick, rather than a task per call
+    DispatchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        TEXT("RetroLib.GameThreadDispatch"), 0.f, [](float) {
+            Retro::Delegates::FGameThreadDispatcher::Get().Flush();
+            return true;
+        });
 }
 
 void FRetroLibUEModule::ShutdownModule() {
     // This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
     // we call this function before unloading the module.
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+    Retro::Ranges::FPropertyLayout::InvalidateAll();
+    FTSTicker::GetCoreTicker().RemoveTicker(DispatchTickerHandle);
+    Retro::Delegates::FGameThreadDispatcher::Get().Discard();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,25 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+// Private precompiled header for the module. It pulls in the engine headers and the heavy RetroLib headers that
+// nearly every source and test file includes, so that their parsing and the instantiation of the shared concept
+// machinery happen once when the PCH is built.
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "UObject/UnrealType.h"
+
+#include "RetroLib/Concepts/Delegates.h"
+#include "RetroLib/Functional/CreateBinding.h"
+#include "RetroLib/Functional/Delegates.h"
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Optionals/Compatiblity/UnrealOptional.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Algorithm/ToArray.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Compatibility/UnrealContainers.h"
+#include "RetroLib/Ranges/Views/Filter.h"
+#include "RetroLib/Ranges/Views/Transform.h"
+
+#include "RetroLib/Compilation/ExternTemplates.h"
@@ -0,0 +1,188 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Containers/SortedArray.h"
+
+#include <Containers/ArrayView.h>
+#include <Templates/Tuple.h>
+
+namespace Retro {
+
+    /**
+     * Read-mostly map stored as two parallel sorted arrays, one of keys and one of values. Lookups binary search the
+     * key array alone, so a search touches only tightly packed keys and the value is read once at the end. There is no
+     * hash table to build, which makes this a good fit for lookup tables that are rebuilt on data reload and then
+     * queried many times. Build it in bulk from an array of pairs or through the ToFlatSortedMap pipe; single pair
+     * insertion is supported but is linear in the size of the map.
+     *
+     * @tparam K The key type
+     * @tparam V The value type
+     * @tparam A The allocator of the backing arrays
+     * @tparam P The less-than predicate the keys are ordered by
+     */
+    template <typename K, typename V, typename A = FDefaultAllocator, typename P = TLess<K>>
+    class TFlatSortedMap {
+      public:
+        using KeyType = K;
+        using ValueType = V;
+        using ElementType = TPair<K, V>;
+
+        TFlatSortedMap() = default;
+
+        /**
+         * Build the map from an array of pairs in any order. If a key appears more than once the last pair wins, as it
+         * would when adding the pairs to a TMap.
+         *
+         * @param Pairs The pairs to take ownership of
+         */
+        template <typename B>
+        explicit TFlatSortedMap(TArray<TPair<K, V>, B> &&Pairs) {
+            SortAndRemoveDuplicates(Pairs, [](const TPair<K, V> &Pair) -> const K & { return Pair.Key; }, P());
+            Keys.Reserve(Pairs.Num());
+            Values.Reserve(Pairs.Num());
+            for (TPair<K, V> &Pair : Pairs) {
+                Keys.Emplace(MoveTemp(Pair.Key));
+                Values.Emplace(MoveTemp(Pair.Value));
+            }
+        }
+
+        TFlatSortedMap(std::initializer_list<TPair<K, V>> Pairs) : TFlatSortedMap(TArray<TPair<K, V>>(Pairs)) {
+        }
+
+        /**
+         * Find the position of a key.
+         *
+         * @param Key The key to search for
+         * @return The index of the key, or INDEX_NONE if it is not in the map
+         */
+        int32 IndexOf(const K &Key) const {
+            int32 Index = BranchlessLowerBound(Keys.GetData(), Keys.Num(), Key, FIdentityFunctor(), P());
+            return Index < Keys.Num() && !P()(Key, Keys[Index]) ? Index : INDEX_NONE;
+        }
+
+        bool Contains(const K &Key) const {
+            return IndexOf(Key) != INDEX_NONE;
+        }
+
+        /**
+         * Find the value associated with a key.
+         *
+         * @param Key The key to search for
+         * @return Pointer to the value, or nullptr if the key is not in the map
+         */
+        V *Find(const K &Key) {
+            int32 Index = IndexOf(Key);
+            return Index != INDEX_NONE ? &Values[Index] : nullptr;
+        }
+
+        const V *Find(const K &Key) const {
+            int32 Index = IndexOf(Key);
+            return Index != INDEX_NONE ? &Values[Index] : nullptr;
+        }
+
+        /**
+         * Find the value associated with a key, asserting that it exists.
+         *
+         * @param Key The key to search for
+         * @return The value
+         */
+        V &FindChecked(const K &Key) {
+            V *Value = Find(Key);
+            check(Value != nullptr);
+            return *Value;
+        }
+
+        const V &FindChecked(const K &Key) const {
+            const V *Value = Find(Key);
+            check(Value != nullptr);
+            return *Value;
+        }
+
+        /**
+         * Find the value associated with a key, returning a copy of it or a default constructed value.
+         *
+         * @param Key The key to search for
+         * @return The value, or a default constructed value if the key is not in the map
+         */
+        V FindRef(const K &Key) const {
+            const V *Value = Find(Key);
+            return Value != nullptr ? *Value : V();
+        }
+
+        /**
+         * Set the value of a key, inserting the key at its sorted position if it is not present.
+         *
+         * @param Key The key
+         * @param Value The value to set
+         * @return Reference to the stored value
+         */
+        V &Add(K Key, V Value) {
+            int32 Index = BranchlessLowerBound(Keys.GetData(), Keys.Num(), Key, FIdentityFunctor(), P());
+            if (Index < Keys.Num() && !P()(Key, Keys[Index])) {
+                Values[Index] = MoveTemp(Value);
+                return Values[Index];
+            }
+
+            Keys.Insert(MoveTemp(Key), Index);
+            Values.Insert(MoveTemp(Value), Index);
+            return Values[Index];
+        }
+
+        /**
+         * Remove a key and its value.
+         *
+         * @param Key The key to remove
+         * @return Was the key removed
+         */
+        bool Remove(const K &Key) {
+            int32 Index = IndexOf(Key);
+            if (Index == INDEX_NONE) {
+                return false;
+            }
+
+            Keys.RemoveAt(Index);
+            Values.RemoveAt(Index);
+            return true;
+        }
+
+        void Reset() {
+            Keys.Reset();
+            Values.Reset();
+        }
+
+        int32 Num() const {
+            return Keys.Num();
+        }
+
+        bool IsEmpty() const {
+            return Keys.IsEmpty();
+        }
+
+        /**
+         * Get the keys, in sorted order.
+         *
+         * @return View of the keys
+         */
+        TConstArrayView<K> GetKeys() const {
+            return Keys;
+        }
+
+        /**
+         * Get the values, in the same order as the keys.
+         *
+         * @return View of the values
+         */
+        TArrayView<V> GetValues() {
+            return Values;
+        }
+
+        TConstArrayView<V> GetValues() const {
+            return Values;
+        }
+
+      private:
+        TArray<K, A> Keys;
+        TArray<V, A> Values;
+    };
+} // namespace Retro
@@ -0,0 +1,125 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Containers/SortedArray.h"
+
+#include <Containers/ArrayView.h>
+
+namespace Retro {
+
+    /**
+     * Read-mostly set stored as a single sorted array. Lookups are a branchless binary search over contiguous memory,
+     * and there are no buckets or hash table to maintain, which makes it a good fit for lookup tables that are built
+     * once, e.g. on data reload, and then queried many times. Build it in bulk from an array or through the
+     * ToFlatSortedSet pipe; single element insertion is supported but is linear in the size of the set.
+     *
+     * @tparam T The element type
+     * @tparam A The allocator of the backing array
+     * @tparam P The less-than predicate the elements are ordered by
+     */
+    template <typename T, typename A = FDefaultAllocator, typename P = TLess<T>>
+    class TFlatSortedSet {
+      public:
+        using ElementType = T;
+
+        TFlatSortedSet() = default;
+
+        /**
+         * Build the set from an array of elements in any order, possibly containing duplicates.
+         *
+         * @param Elements The elements to take ownership of
+         */
+        explicit TFlatSortedSet(TArray<T, A> &&Elements) : Elements(MoveTemp(Elements)) {
+            SortAndRemoveDuplicates(this->Elements, FIdentityFunctor(), P());
+        }
+
+        TFlatSortedSet(std::initializer_list<T> Elements) : TFlatSortedSet(TArray<T, A>(Elements)) {
+        }
+
+        /**
+         * Find the position of an element.
+         *
+         * @param Element The element to search for
+         * @return The index of the element, or INDEX_NONE if it is not in the set
+         */
+        int32 IndexOf(const T &Element) const {
+            int32 Index = BranchlessLowerBound(Elements.GetData(), Elements.Num(), Element, FIdentityFunctor(), P());
+            return Index < Elements.Num() && !P()(Element, Elements[Index]) ? Index : INDEX_NONE;
+        }
+
+        /**
+         * Check if the set contains an element.
+         *
+         * @param Element The element to search for
+         * @return Is the element in the set
+         */
+        bool Contains(const T &Element) const {
+            return IndexOf(Element) != INDEX_NONE;
+        }
+
+        /**
+         * Add an element at its sorted position.
+         *
+         * @param Element The element to add
+         * @return Was the element added, false if it was already present
+         */
+        bool Add(T Element) {
+            int32 Index = BranchlessLowerBound(Elements.GetData(), Elements.Num(), Element, FIdentityFunctor(), P());
+            if (Index < Elements.Num() && !P()(Element, Elements[Index])) {
+                return false;
+            }
+
+            Elements.Insert(MoveTemp(Element), Index);
+            return true;
+        }
+
+        /**
+         * Remove an element.
+         *
+         * @param Element The element to remove
+         * @return Was the element removed
+         */
+        bool Remove(const T &Element) {
+            int32 Index = IndexOf(Element);
+            if (Index == INDEX_NONE) {
+                return false;
+            }
+
+            Elements.RemoveAt(Index);
+            return true;
+        }
+
+        void Reset() {
+            Elements.Reset();
+        }
+
+        int32 Num() const {
+            return Elements.Num();
+        }
+
+        bool IsEmpty() const {
+            return Elements.IsEmpty();
+        }
+
+        /**
+         * Get the elements, in sorted order.
+         *
+         * @return View of the elements
+         */
+        TConstArrayView<T> GetElements() const {
+            return Elements;
+        }
+
+        const T *begin() const {
+            return Elements.GetData();
+        }
+
+        const T *end() const {
+            return Elements.GetData() + Elements.Num();
+        }
+
+      private:
+        TArray<T, A> Elements;
+    };
+} // namespace Retro
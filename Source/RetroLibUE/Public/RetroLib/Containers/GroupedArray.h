@@ -0,0 +1,218 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Containers/ArrayView.h>
+#include <Containers/Map.h>
+#include <Templates/Tuple.h>
+
+#include <iterator>
+
+namespace Retro {
+
+    /**
+     * Read-only multimap that stores the values of every group in one shared buffer, with each group occupying a
+     * contiguous slice of it (a compressed sparse row layout). Compared to a TMap<K, TArray<V>> there is one value
+     * allocation instead of one per key, and iterating a group or the whole buffer walks tightly packed memory. Build
+     * it through the GroupBy pipe.
+     *
+     * Groups are addressed either by key or by index. Iterating the container yields a pair of the key and a view of
+     * the values of each group, in group index order.
+     *
+     * @tparam K The key type
+     * @tparam V The value type
+     * @tparam A The allocator of the key, offset and value arrays
+     */
+    template <typename K, typename V, typename A = FDefaultAllocator>
+    class TGroupedArray {
+      public:
+        using KeyType = K;
+        using ValueType = V;
+        using ElementType = TPair<const K &, TConstArrayView<V>>;
+
+        class FIterator {
+          public:
+            using value_type = ElementType;
+            using difference_type = std::ptrdiff_t;
+
+            FIterator() = default;
+
+            FIterator(const TGroupedArray &Owner, int32 Index) : Owner(&Owner), Index(Index) {
+            }
+
+            ElementType operator*() const {
+                return ElementType(Owner->GetKey(Index), (*Owner)[Index]);
+            }
+
+            FIterator &operator++() {
+                ++Index;
+                return *this;
+            }
+
+            FIterator operator++(int) {
+                FIterator Copy = *this;
+                ++Index;
+                return Copy;
+            }
+
+            bool operator==(const FIterator &Other) const {
+                return Index == Other.Index;
+            }
+
+          private:
+            const TGroupedArray *Owner = nullptr;
+            int32 Index = 0;
+        };
+
+        TGroupedArray() = default;
+
+        /**
+         * Take ownership of grouped storage. Group i owns the values in [Offsets[i], Offsets[i + 1]), so there must be
+         * exactly one more offset than there are keys, the offsets must be ascending, and the last one must equal the
+         * number of values.
+         *
+         * @param Keys The key of each group, which must be unique
+         * @param Offsets The offset of the first value of each group, followed by the total number of values
+         * @param Values The values of every group, laid out back to back
+         */
+        TGroupedArray(TArray<K, A> &&Keys, TArray<int32, A> &&Offsets, TArray<V, A> &&Values)
+            : Keys(MoveTemp(Keys)), Offsets(MoveTemp(Offsets)), Values(MoveTemp(Values)) {
+            check(this->Offsets.Num() == this->Keys.Num() + 1 && this->Offsets.Last() == this->Values.Num());
+            GroupIndices.Reserve(this->Keys.Num());
+            for (int32 i = 0; i < this->Keys.Num(); i++) {
+                GroupIndices.Add(this->Keys[i], i);
+            }
+        }
+
+        /**
+         * Take ownership of grouped storage along with the lookup from key to group index, for builders that already
+         * hashed every key while grouping. The storage has the same requirements as above.
+         *
+         * @param Keys The key of each group, which must be unique
+         * @param Offsets The offset of the first value of each group, followed by the total number of values
+         * @param Values The values of every group, laid out back to back
+         * @param GroupIndices The index of each key within Keys
+         */
+        TGroupedArray(TArray<K, A> &&Keys, TArray<int32, A> &&Offsets, TArray<V, A> &&Values,
+                      TMap<K, int32> &&GroupIndices)
+            : Keys(MoveTemp(Keys)), Offsets(MoveTemp(Offsets)), Values(MoveTemp(Values)),
+              GroupIndices(MoveTemp(GroupIndices)) {
+            check(this->Offsets.Num() == this->Keys.Num() + 1 && this->Offsets.Last() == this->Values.Num());
+            check(this->GroupIndices.Num() == this->Keys.Num());
+        }
+
+        /**
+         * Find the index of the group with the given key.
+         *
+         * @param Key The key to search for
+         * @return The index of the group, or INDEX_NONE if there is no such group
+         */
+        int32 IndexOf(const K &Key) const {
+            const int32 *Index = GroupIndices.Find(Key);
+            return Index != nullptr ? *Index : INDEX_NONE;
+        }
+
+        bool Contains(const K &Key) const {
+            return GroupIndices.Contains(Key);
+        }
+
+        /**
+         * Find the values of the group with the given key.
+         *
+         * @param Key The key to search for
+         * @return The values of the group, which is empty if there is no such group
+         */
+        TConstArrayView<V> FindGroup(const K &Key) const {
+            int32 Index = IndexOf(Key);
+            return Index != INDEX_NONE ? (*this)[Index] : TConstArrayView<V>();
+        }
+
+        TArrayView<V> FindGroup(const K &Key) {
+            int32 Index = IndexOf(Key);
+            return Index != INDEX_NONE ? (*this)[Index] : TArrayView<V>();
+        }
+
+        /**
+         * Get the values of a group by index.
+         *
+         * @param Index The index of the group
+         * @return The values of the group
+         */
+        TConstArrayView<V> operator[](int32 Index) const {
+            return TConstArrayView<V>(Values.GetData() + Offsets[Index], Offsets[Index + 1] - Offsets[Index]);
+        }
+
+        TArrayView<V> operator[](int32 Index) {
+            return TArrayView<V>(Values.GetData() + Offsets[Index], Offsets[Index + 1] - Offsets[Index]);
+        }
+
+        const K &GetKey(int32 Index) const {
+            return Keys[Index];
+        }
+
+        /**
+         * Get the number of groups.
+         *
+         * @return The number of groups
+         */
+        int32 Num() const {
+            return Keys.Num();
+        }
+
+        bool IsEmpty() const {
+            return Keys.IsEmpty();
+        }
+
+        /**
+         * Get the key of every group, in group index order.
+         *
+         * @return View of the keys
+         */
+        TConstArrayView<K> GetKeys() const {
+            return Keys;
+        }
+
+        /**
+         * Get the shared value buffer, which holds the values of every group in group index order.
+         *
+         * @return View of all the values
+         */
+        TConstArrayView<V> GetValues() const {
+            return Values;
+        }
+
+        TArrayView<V> GetValues() {
+            return Values;
+        }
+
+        /**
+         * Copy the groups out into a map with one array per key, for code that expects that shape.
+         *
+         * @return The map of keys to the values of their group
+         */
+        TMap<K, TArray<V>> ToMap() const {
+            TMap<K, TArray<V>> Result;
+            Result.Reserve(Keys.Num());
+            for (int32 i = 0; i < Keys.Num(); i++) {
+                TConstArrayView<V> Group = (*this)[i];
+                Result.Add(Keys[i], TArray<V>(Group.GetData(), Group.Num()));
+            }
+            return Result;
+        }
+
+        FIterator begin() const {
+            return FIterator(*this, 0);
+        }
+
+        FIterator end() const {
+            return FIterator(*this, Keys.Num());
+        }
+
+      private:
+        TArray<K, A> Keys;
+        TArray<int32, A> Offsets = {0};
+        TArray<V, A> Values;
+        TMap<K, int32> GroupIndices;
+    };
+} // namespace Retro
@@ -0,0 +1,85 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Templates/IdentityFunctor.h>
+#include <Templates/Less.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace Retro {
+
+    /**
+     * Find the first element of a sorted range that does not compare less than the key. The loop always runs
+     * log2(Num) times and picks the next half with a conditional move rather than a branch, so lookups do not pay
+     * for mispredictions on random keys.
+     *
+     * @tparam T The element type
+     * @tparam K The key type
+     * @tparam J The projection applied to each element before comparing
+     * @tparam P The less-than predicate
+     * @param Data The sorted elements
+     * @param Num The number of elements
+     * @param Key The key to search for
+     * @param Projection The projection applied to each element before comparing
+     * @param Predicate The less-than predicate the elements are sorted by
+     * @return The index of the lower bound, which is Num if every element is less than the key
+     */
+    template <typename T, typename K, typename J = FIdentityFunctor, typename P = TLess<>>
+    int32 BranchlessLowerBound(const T *Data, int32 Num, const K &Key, J Projection = {}, P Predicate = {}) {
+        if (Num == 0) {
+            return 0;
+        }
+
+        const T *Base = Data;
+        while (Num > 1) {
+            int32 Half = Num / 2;
+            Base = std::invoke(Predicate, std::invoke(Projection, Base[Half - 1]), Key) ? Base + Half : Base;
+            Num -= Half;
+        }
+
+        return static_cast<int32>(Base - Data) + (std::invoke(Predicate, std::invoke(Projection, *Base), Key) ? 1 : 0);
+    }
+
+    /**
+     * Sort an array once and then collapse each run of equivalent elements down to the last one, in place. This is
+     * how the sorted containers are built in bulk: O(n log n) overall instead of the O(n^2) of inserting into sorted
+     * position one element at a time. Keeping the last element matches the behavior of adding the same key to a TMap
+     * repeatedly.
+     *
+     * @tparam T The element type
+     * @tparam A The allocator of the array
+     * @tparam J The projection used to get the sort key of an element
+     * @tparam P The less-than predicate
+     * @param Array The array to sort and deduplicate
+     * @param Projection The projection used to get the sort key of an element
+     * @param Predicate The less-than predicate
+     */
+    template <typename T, typename A, typename J = FIdentityFunctor, typename P = TLess<>>
+    void SortAndRemoveDuplicates(TArray<T, A> &Array, J Projection = {}, P Predicate = {}) {
+        T *Data = Array.GetData();
+        int32 Num = Array.Num();
+        std::stable_sort(Data, Data + Num, [&Projection, &Predicate](const T &Lhs, const T &Rhs) {
+            return std::invoke(Predicate, std::invoke(Projection, Lhs), std::invoke(Projection, Rhs));
+        });
+
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < Num; ReadIndex++) {
+            // The array is sorted, so anything not greater than the last kept element is equivalent to it
+            if (WriteIndex > 0 && !std::invoke(Predicate, std::invoke(Projection, Data[WriteIndex - 1]),
+                                               std::invoke(Projection, Data[ReadIndex]))) {
+                Data[WriteIndex - 1] = MoveTemp(Data[ReadIndex]);
+                continue;
+            }
+
+            if (WriteIndex != ReadIndex) {
+                Data[WriteIndex] = MoveTemp(Data[ReadIndex]);
+            }
+            WriteIndex++;
+        }
+
+        Array.SetNum(WriteIndex, false);
+    }
+} // namespace Retro
@@ -2,11 +2,52 @@
 
 #pragma once
 
+#include "RetroLib/Expected/Expected.h"
+
 #include <Blueprint/BlueprintExceptionInfo.h>
+#include <UObject/Script.h>
+#include <UObject/Stack.h>
 #include <exception>
 
 namespace Retro {
 	inline FBlueprintExceptionInfo ConvertException(const std::exception& Exception, EBlueprintExceptionType::Type Type = EBlueprintExceptionType::AccessViolation) {
 		return FBlueprintExceptionInfo(Type, FText::FromString(Exception.what()));
 	}
+
+	inline FBlueprintExceptionInfo ConvertException(const FText& Message, EBlueprintExceptionType::Type Type = EBlueprintExceptionType::AccessViolation) {
+		return FBlueprintExceptionInfo(Type, Message);
+	}
+
+	inline FBlueprintExceptionInfo ConvertException(const FString& Message, EBlueprintExceptionType::Type Type = EBlueprintExceptionType::AccessViolation) {
+		return FBlueprintExceptionInfo(Type, FText::FromString(Message));
+	}
+
+	/**
+	 * Concept for an error type that can be reported to Blueprint, i.e. one that has a ConvertException overload.
+	 */
+	template <typename T>
+	concept BlueprintReportableError = requires(const T& Error) {
+		{ ConvertException(Error) } -> std::same_as<FBlueprintExceptionInfo>;
+	};
+
+	/**
+	 * Report the error held by an expected as a script exception on the given stack frame. This is intended for the
+	 * body of a custom thunk, where a failure needs to surface in Blueprint. Nothing is built on the success path; the
+	 * exception info is only created once an error is actually present.
+	 *
+	 * @param Result The result to check
+	 * @param Context The object the function was called on
+	 * @param Stack The script stack of the call
+	 * @param Type The kind of exception to raise
+	 * @return Was an exception raised
+	 */
+	template <typename T, BlueprintReportableError E>
+	bool RaiseIfError(const TValueOrError<T, E>& Result, const UObject* Context, FFrame& Stack, EBlueprintExceptionType::Type Type = EBlueprintExceptionType::AccessViolation) {
+		if (Result.HasValue()) [[likely]] {
+			return false;
+		}
+
+		FBlueprintCoreDelegates::ThrowScriptException(Context, Stack, ConvertException(Result.GetError(), Type));
+		return true;
+	}
 }
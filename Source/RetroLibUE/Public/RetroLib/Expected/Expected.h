@@ -0,0 +1,209 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Optionals/OptionalOperations.h"
+#include "RetroLib/Utils/ForwardLike.h"
+
+#include <Templates/ValueOrError.h>
+
+#include <functional>
+
+namespace Retro::Expected {
+
+    /**
+     * The result of an operation that can fail, holding either a value or an error. This is the engine's
+     * TValueOrError, which keeps both states inline in a variant, so neither propagating nor returning an error ever
+     * allocates. Prefer returning one of these over throwing on paths that can fail routinely, as exceptions are both
+     * expensive to throw and disabled in most targets.
+     *
+     * @tparam T The type of the value, which may be void
+     * @tparam E The type of the error
+     */
+    template <typename T, typename E>
+    using TExpected = TValueOrError<T, E>;
+
+    template <typename T>
+    struct TExpectedTraits : std::false_type {};
+
+    template <typename T, typename E>
+    struct TExpectedTraits<TValueOrError<T, E>> : std::true_type {
+        using ValueType = T;
+        using ErrorType = E;
+    };
+
+    /**
+     * Concept for a TValueOrError of any value and error type.
+     *
+     * @tparam T The type to check
+     */
+    template <typename T>
+    concept ValueOrError = TExpectedTraits<std::remove_cvref_t<T>>::value;
+
+    template <ValueOrError T>
+    using TExpectedValue = typename TExpectedTraits<std::remove_cvref_t<T>>::ValueType;
+
+    template <ValueOrError T>
+    using TExpectedError = typename TExpectedTraits<std::remove_cvref_t<T>>::ErrorType;
+
+    namespace Private {
+        template <ValueOrError O, typename F>
+        constexpr decltype(auto) InvokeWithValue(O &&Expected, F &&Functor) {
+            if constexpr (std::is_void_v<TExpectedValue<O>>) {
+                return std::invoke(std::forward<F>(Functor));
+            } else {
+                return std::invoke(std::forward<F>(Functor), Retro::ForwardLike<O>(Expected.GetValue()));
+            }
+        }
+
+        template <typename O, typename F>
+        using TValueResult = decltype(InvokeWithValue(std::declval<O>(), std::declval<F>()));
+
+        template <ValueOrError R, ValueOrError O>
+        constexpr R PassValue(O &&Expected) {
+            if constexpr (std::is_void_v<TExpectedValue<O>>) {
+                return R(MakeValue());
+            } else {
+                return R(MakeValue(Retro::ForwardLike<O>(Expected.GetValue())));
+            }
+        }
+
+        template <ValueOrError R, ValueOrError O>
+        constexpr R PassError(O &&Expected) {
+            return R(MakeError(Retro::ForwardLike<O>(Expected.GetError())));
+        }
+    } // namespace Private
+
+    struct FTransformInvoker {
+        template <ValueOrError O, typename F>
+        constexpr auto operator()(O &&Expected, F &&Functor) const {
+            using FResult = std::decay_t<Private::TValueResult<O, F>>;
+            using FReturn = TValueOrError<FResult, TExpectedError<O>>;
+            if (!Expected.HasValue()) {
+                return Private::PassError<FReturn>(std::forward<O>(Expected));
+            }
+
+            if constexpr (std::is_void_v<FResult>) {
+                Private::InvokeWithValue(std::forward<O>(Expected), std::forward<F>(Functor));
+                return FReturn(MakeValue());
+            } else {
+                return FReturn(MakeValue(Private::InvokeWithValue(std::forward<O>(Expected), std::forward<F>(Functor))));
+            }
+        }
+    };
+
+    /**
+     * Map the value of an expected, leaving an error untouched.
+     *
+     *     TExpected<int32, FText> Doubled = ParseInt(Text) | Retro::Expected::Transform([](int32 i) { return i * 2; });
+     */
+    constexpr auto Transform = ExtensionMethod<FTransformInvoker{}>;
+
+    struct FAndThenInvoker {
+        template <ValueOrError O, typename F>
+            requires ValueOrError<Private::TValueResult<O, F>>
+        constexpr auto operator()(O &&Expected, F &&Functor) const {
+            using FReturn = std::decay_t<Private::TValueResult<O, F>>;
+            static_assert(std::constructible_from<TExpectedError<FReturn>, TExpectedError<O>>,
+                          "The error of the chained operation must be constructible from the incoming error");
+            if (!Expected.HasValue()) {
+                return Private::PassError<FReturn>(std::forward<O>(Expected));
+            }
+
+            return FReturn(Private::InvokeWithValue(std::forward<O>(Expected), std::forward<F>(Functor)));
+        }
+    };
+
+    /**
+     * Chain another fallible operation onto the value of an expected. The operation is skipped, and the error is
+     * forwarded, if an earlier step failed.
+     */
+    constexpr auto AndThen = ExtensionMethod<FAndThenInvoker{}>;
+
+    struct FOrElseInvoker {
+        template <ValueOrError O, typename F>
+            requires ValueOrError<std::invoke_result_t<F, decltype(Retro::ForwardLike<O>(std::declval<O>().GetError()))>>
+        constexpr auto operator()(O &&Expected, F &&Functor) const {
+            using FReturn =
+                std::decay_t<std::invoke_result_t<F, decltype(Retro::ForwardLike<O>(std::declval<O>().GetError()))>>;
+            static_assert(std::is_void_v<TExpectedValue<FReturn>> == std::is_void_v<TExpectedValue<O>>,
+                          "The recovery operation must produce the same kind of value");
+            if (Expected.HasValue()) {
+                return Private::PassValue<FReturn>(std::forward<O>(Expected));
+            }
+
+            return FReturn(std::invoke(std::forward<F>(Functor), Retro::ForwardLike<O>(Expected.GetError())));
+        }
+    };
+
+    /**
+     * Attempt to recover from an error by calling a fallible operation with it. A value is forwarded untouched.
+     */
+    constexpr auto OrElse = ExtensionMethod<FOrElseInvoker{}>;
+
+    struct FTransformErrorInvoker {
+        template <ValueOrError O, typename F>
+        constexpr auto operator()(O &&Expected, F &&Functor) const {
+            using FError =
+                std::decay_t<std::invoke_result_t<F, decltype(Retro::ForwardLike<O>(std::declval<O>().GetError()))>>;
+            using FReturn = TValueOrError<TExpectedValue<O>, FError>;
+            if (Expected.HasValue()) {
+                return Private::PassValue<FReturn>(std::forward<O>(Expected));
+            }
+
+            return FReturn(MakeError(std::invoke(std::forward<F>(Functor), Retro::ForwardLike<O>(Expected.GetError()))));
+        }
+    };
+
+    /**
+     * Map the error of an expected, leaving a value untouched. Useful for converting a low level error into the error
+     * type of the calling layer.
+     */
+    constexpr auto TransformError = ExtensionMethod<FTransformErrorInvoker{}>;
+
+    struct FValueOrInvoker {
+        template <ValueOrError O, typename D>
+            requires(!std::is_void_v<TExpectedValue<O>>) && std::convertible_to<D, TExpectedValue<O>>
+        constexpr TExpectedValue<O> operator()(O &&Expected, D &&Default) const {
+            if (Expected.HasValue()) {
+                return Retro::ForwardLike<O>(Expected.GetValue());
+            }
+
+            return static_cast<TExpectedValue<O>>(std::forward<D>(Default));
+        }
+    };
+
+    /**
+     * Get the value of an expected, or the given default if it holds an error.
+     */
+    constexpr auto ValueOr = ExtensionMethod<FValueOrInvoker{}>;
+} // namespace Retro::Expected
+
+namespace Retro::Optionals {
+    /**
+     * Lets a TValueOrError be consumed by the optional pipes and iterated as an optional, with the error treated as
+     * the empty state. Use the pipes in Retro::Expected instead when the error needs to be preserved.
+     */
+    template <Expected::ValueOrError T>
+        requires(!std::is_void_v<Expected::TExpectedValue<T>>)
+    struct OptionalOperations<T> : ValidType {
+        template <Expected::ValueOrError O>
+            requires std::same_as<T, std::decay_t<O>>
+        static constexpr decltype(auto) Get(O &&Optional) {
+            return Retro::ForwardLike<O>(Optional.GetValue());
+        }
+
+        template <Expected::ValueOrError O>
+            requires std::same_as<T, std::decay_t<O>>
+        static constexpr decltype(auto) GetValue(O &&Optional) {
+            return Retro::ForwardLike<O>(Optional.GetValue());
+        }
+
+        template <Expected::ValueOrError O>
+            requires std::same_as<T, std::decay_t<O>>
+        static constexpr bool HasValue(const O &Optional) {
+            return Optional.HasValue();
+        }
+    };
+} // namespace Retro::Optionals
@@ -4,7 +4,12 @@
 
 #include "RetroLib/Concepts/Delegates.h"
 #include "RetroLib/Functional/CreateBinding.h"
+#include "RetroLib/Functional/DynamicDelegates.h"
 #include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+
+#include <variant>
 
 namespace Retro {
     namespace Delegates
@@ -18,17 +23,31 @@ namespace Retro {
             }
 
             template <typename... A>
-            constexpr decltype(auto) operator()(A &&... Args) const {
-                if constexpr (UnicastDelegate<D>) {
+            decltype(auto) operator()(A &&... Args) const {
+                if constexpr (DynamicUnicastDelegate<D>) {
+                    RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Execute"));
+                    check(Delegate.IsBound())
+                    return ExecuteDynamic(Delegate, FunctionCache, std::forward<A>(Args)...);
+                } else if constexpr (UnicastDelegate<D>) {
+                    RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Execute"));
                     check(Delegate.IsBound())
                     return Delegate.Execute(std::forward<A>(Args)...);
+                } else if constexpr (DynamicMulitcastDelegate<D>) {
+                    RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Broadcast"));
+                    return BroadcastDynamic(Delegate, FunctionCache, std::forward<A>(Args)...);
                 } else if constexpr (MulticastDelegate<D>) {
+                    RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Broadcast"));
                     return Delegate.Broadcast(std::forward<A>(Args)...);
                 }
             }
 
         private:
             D Delegate;
+
+            /**
+             * The resolved target functions of a dynamic delegate, so that native targets can be called directly.
+             */
+            mutable std::conditional_t<DynamicDelegate<D>, FDynamicFunctionCache, std::monostate> FunctionCache;
         };
 
         template <UEDelegate D>
@@ -48,6 +67,8 @@ namespace Retro {
         template <UEDelegate D, typename F, typename... A>
             requires CanBindFree<D, F, A...>
         D Create(F &&Functor, A &&... Args) {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Create"));
+            RETROLIB_LLM_SCOPE();
             if constexpr (CanBindStatic<D, F, A...>) {
                 return D::CreateStatic(std::forward<F>(Functor), std::forward<A>(Args)...);
             } else {
@@ -59,6 +80,8 @@ namespace Retro {
         template <UEDelegate D, typename O, typename F, typename... A>
             requires CanBindMember<D, O, F, A...>
         D Create(O &&Object, F &&Functor, A &&... Args) {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Create"));
+            RETROLIB_LLM_SCOPE();
             if constexpr (CanBindSP<D, O, F, A...>) {
                 return D::CreateSP(std::forward<O>(Object), std::forward<F>(Functor), std::forward<A>(Args)...);
             } else if constexpr (CanBindSPLambda<D, O, F, A...>) {
@@ -77,6 +100,8 @@ namespace Retro {
             template <NativeUnicastDelegate D, typename F, typename... A>
                 requires CanBindFree<D, F, A...>
             void operator()(D &Delegate, F &&Functor, A &&... Args) const {
+                RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Bind"));
+                RETROLIB_LLM_SCOPE();
                 if constexpr (CanBindStatic<D, F, A...>) {
                     return Delegate.BindStatic(std::forward<F>(Functor), std::forward<A>(Args)...);
                 } else {
@@ -88,6 +113,8 @@ namespace Retro {
             template <NativeUnicastDelegate D, typename O, typename F, typename... A>
                 requires CanBindMember<D, O, F, A...>
             void operator()(D &Delegate, O &&Object, F &&Functor, A &&... Args) const {
+                RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Bind"));
+                RETROLIB_LLM_SCOPE();
                 if constexpr (CanBindSP<D, O, F, A...>) {
                     return Delegate.BindSP(std::forward<O>(Object), std::forward<F>(Functor), std::forward<A>(Args)...);
                 } else if constexpr (CanBindSPLambda<D, O, F, A...>) {
@@ -112,12 +139,16 @@ namespace Retro {
             template <MulticastDelegate D, UnicastDelegate O>
                 requires BindableTo<D, O>
             decltype(auto) operator()(D& Delegate, O &&Binding) const {
+                RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Add"));
+                RETROLIB_LLM_SCOPE();
                 return Delegate.Add(std::forward<O>(Binding));
             }
             
             template <NativeMulitcastDelegate D, typename F, typename... A>
                 requires CanAddFree<D, F, A...>
             FDelegateHandle operator()(D &Delegate, F &&Functor, A &&... Args) const {
+                RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Add"));
+                RETROLIB_LLM_SCOPE();
                 if constexpr (CanAddStatic<D, F, A...>) {
                     return Delegate.AddStatic(std::forward<F>(Functor), std::forward<A>(Args)...);
                 } else {
@@ -129,6 +160,8 @@ namespace Retro {
             template <NativeMulitcastDelegate D, typename O, typename F, typename... A>
                 requires CanAddMember<D, O, F, A...>
             FDelegateHandle operator()(D &Delegate, O &&Object, F &&Functor, A &&... Args) const {
+                RETROLIB_TRACE_SCOPE(TEXT("Retro::Delegates::Add"));
+                RETROLIB_LLM_SCOPE();
                 if constexpr (CanAddSP<D, O, F, A...>) {
                     return Delegate.AddSP(std::forward<O>(Object), std::forward<F>(Functor), std::forward<A>(Args)...);
                 } else if constexpr (CanAddSPLambda<D, O, F, A...>) {
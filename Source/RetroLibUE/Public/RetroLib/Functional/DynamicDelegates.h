@@ -0,0 +1,460 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Containers/ArrayView.h>
+#include <HAL/UnrealMemory.h>
+#include <Internationalization/Text.h>
+#include <Templates/AlignmentTemplates.h>
+#include <Templates/SharedPointer.h>
+#include <UObject/Class.h>
+#include <UObject/ObjectPtr.h>
+#include <UObject/ScriptDelegates.h>
+#include <UObject/WeakObjectPtrTemplates.h>
+
+#include <utility>
+
+namespace Retro::Delegates {
+
+    /**
+     * The parts of a C++ parameter type that can be checked against the property a UFunction declares for it.
+     */
+    struct RETROLIBUE_API FDynamicParamType {
+        enum class EKind : uint8 {
+            Other,
+            Bool,
+            Int8,
+            Int16,
+            Int32,
+            Int64,
+            UInt8,
+            UInt16,
+            UInt32,
+            UInt64,
+            Float,
+            Double,
+            String,
+            Name,
+            Text,
+            Object,
+            Enum,
+            Struct
+        };
+
+        /**
+         * The kind of property expected for the type. Types that do not map to a specific kind of property are only
+         * checked by size.
+         */
+        EKind Kind;
+
+        /**
+         * The size of the type in bytes.
+         */
+        int32 Size;
+
+        /**
+         * Get the class of an object pointer, or the struct of a reflected struct. Null for every other kind.
+         */
+        UStruct *(*GetStruct)();
+
+        /**
+         * Check if a value of this type can be placed in the parameter block slot described by the property.
+         *
+         * @param Property The parameter property of the function
+         * @return Does the property hold this type?
+         */
+        bool IsCompatibleWith(const FProperty &Property) const;
+    };
+
+    namespace Private {
+        template <typename T>
+        using TParmType = std::remove_cvref_t<T>;
+
+        template <typename T>
+        struct TObjectParamClass {
+            using Type = void;
+        };
+
+        template <typename T>
+            requires std::derived_from<T, UObject>
+        struct TObjectParamClass<T *> {
+            using Type = std::remove_const_t<T>;
+        };
+
+        template <typename T>
+            requires std::derived_from<T, UObject>
+        struct TObjectParamClass<TObjectPtr<T>> {
+            using Type = std::remove_const_t<T>;
+        };
+
+        template <typename T>
+        constexpr FDynamicParamType::EKind GetParamKind() {
+            using EKind = FDynamicParamType::EKind;
+            if constexpr (std::same_as<T, bool>) {
+                return EKind::Bool;
+            } else if constexpr (std::is_integral_v<T>) {
+                constexpr EKind Signed[] = {EKind::Int8, EKind::Int16, EKind::Int32, EKind::Int64};
+                constexpr EKind Unsigned[] = {EKind::UInt8, EKind::UInt16, EKind::UInt32, EKind::UInt64};
+                constexpr int32 Index = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+                return std::is_signed_v<T> ? Signed[Index] : Unsigned[Index];
+            } else if constexpr (std::same_as<T, float>) {
+                return EKind::Float;
+            } else if constexpr (std::same_as<T, double>) {
+                return EKind::Double;
+            } else if constexpr (std::same_as<T, FString>) {
+                return EKind::String;
+            } else if constexpr (std::same_as<T, FName>) {
+                return EKind::Name;
+            } else if constexpr (std::same_as<T, FText>) {
+                return EKind::Text;
+            } else if constexpr (!std::is_void_v<typename TObjectParamClass<T>::Type>) {
+                return EKind::Object;
+            } else if constexpr (std::is_enum_v<T>) {
+                return EKind::Enum;
+            } else if constexpr (requires { T::StaticStruct(); }) {
+                return EKind::Struct;
+            } else {
+                return EKind::Other;
+            }
+        }
+
+        template <typename T>
+        FDynamicParamType MakeParamType() {
+            constexpr FDynamicParamType::EKind Kind = GetParamKind<T>();
+            UStruct *(*GetStruct)() = nullptr;
+            if constexpr (Kind == FDynamicParamType::EKind::Object) {
+                GetStruct = []() -> UStruct * { return TObjectParamClass<T>::Type::StaticClass(); };
+            } else if constexpr (Kind == FDynamicParamType::EKind::Struct) {
+                GetStruct = []() -> UStruct * { return T::StaticStruct(); };
+            }
+            return {Kind, static_cast<int32>(sizeof(T)), GetStruct};
+        }
+
+        /**
+         * Compute the size of the parameter block for the given types, which are laid out back to back at their
+         * natural alignment in the same way as the parameter struct generated for a UFunction. As with
+         * UFunction::ParmsSize, there is no padding after the last parameter.
+         */
+        template <typename... T>
+        constexpr int32 GetParmsSize() {
+            int32 Size = 0;
+            ((Size = Align(Size, static_cast<int32>(alignof(T))) + static_cast<int32>(sizeof(T))), ...);
+            return Size;
+        }
+    } // namespace Private
+
+    /**
+     * The parameter layout of a UFunction that a dynamic delegate is bound to, resolved once so that the parameter
+     * block can be built directly from the C++ arguments instead of going through the generated parameter struct.
+     */
+    struct RETROLIBUE_API FDynamicFunctionLayout {
+        explicit FDynamicFunctionLayout(UFunction *Function);
+
+        /**
+         * The function itself.
+         */
+        UFunction *Function;
+
+        /**
+         * Weak reference to the function, used to detect that the function was destroyed or replaced.
+         */
+        TWeakObjectPtr<UFunction> WeakFunction;
+
+        /**
+         * The parameter properties, in declaration order and excluding the return value.
+         */
+        TArray<FProperty *, TInlineAllocator<8>> Params;
+
+        /**
+         * The offsets of the parameters within the parameter block, in declaration order and excluding the return
+         * value.
+         */
+        TArray<int32, TInlineAllocator<8>> ParamOffsets;
+
+        /**
+         * The return value property, or null if the function returns nothing.
+         */
+        FProperty *ReturnProperty = nullptr;
+
+        /**
+         * The parameters that are written back to the caller, including the return value.
+         */
+        TArray<FProperty *, TInlineAllocator<4>> OutParms;
+
+        /**
+         * The offset of the return value, or INDEX_NONE if the function returns nothing.
+         */
+        int32 ReturnOffset = INDEX_NONE;
+
+        /**
+         * The size of the parameter block.
+         */
+        int32 ParmsSize;
+
+        /**
+         * The required alignment of the parameter block.
+         */
+        int32 MinAlignment;
+
+        /**
+         * Can the function be invoked directly, rather than through ProcessEvent. This is true for native, non
+         * replicated functions, which is everything declared in C++ that has not been overridden by a Blueprint.
+         */
+        bool bNative;
+
+        /**
+         * Check if the layout can be used with a delegate of the given signature, which requires every parameter and
+         * the return value to be held by a property of the matching type and the parameter blocks to be the same
+         * size. The result is remembered, so only the first call for a signature does the full check.
+         *
+         * @tparam R The return type of the delegate
+         * @tparam P The parameter types of the delegate
+         * @return Can the parameter block built for the delegate be passed to the function
+         */
+        template <typename R, typename... P>
+        bool Matches() const {
+            static constexpr uint8 SignatureTag = 0;
+            if (MatchedSignature == &SignatureTag) {
+                return true;
+            }
+
+            if (!MatchesSignature<R, P...>()) {
+                return false;
+            }
+
+            MatchedSignature = &SignatureTag;
+            return true;
+        }
+
+      private:
+        template <typename R, typename... P>
+        bool MatchesSignature() const {
+            int32 ExpectedParmsSize;
+            if constexpr (std::is_void_v<R>) {
+                ExpectedParmsSize = Private::GetParmsSize<Private::TParmType<P>...>();
+            } else {
+                ExpectedParmsSize = Private::GetParmsSize<Private::TParmType<P>..., R>();
+            }
+
+            if (Params.Num() != sizeof...(P) || std::is_void_v<R> != (ReturnProperty == nullptr) ||
+                ParmsSize != ExpectedParmsSize) {
+                return false;
+            }
+
+            int32 Index = 0;
+            if (!(Private::MakeParamType<Private::TParmType<P>>().IsCompatibleWith(*Params[Index++]) && ...)) {
+                return false;
+            }
+
+            if constexpr (!std::is_void_v<R>) {
+                return Private::MakeParamType<R>().IsCompatibleWith(*ReturnProperty);
+            } else {
+                return true;
+            }
+        }
+
+        /**
+         * The signature that this layout was last found to match.
+         */
+        mutable const void *MatchedSignature = nullptr;
+    };
+
+    /**
+     * Cache of the functions that a dynamic delegate has resolved to, keyed by the class of the bound object and the
+     * function name. A unicast delegate only ever needs a single entry, while a multicast delegate has one per
+     * distinct listener type.
+     */
+    class RETROLIBUE_API FDynamicFunctionCache {
+      public:
+        /**
+         * The maximum number of entries kept before the cache is cleared and rebuilt.
+         */
+        static constexpr int32 MaxEntries = 16;
+
+        /**
+         * Get the layout of the function that would be called on the given object. The layout is reference counted
+         * so that it stays alive if the cache is modified by a reentrant call while it is in use.
+         *
+         * @param Object The object the delegate is bound to
+         * @param FunctionName The name of the bound function
+         * @return The layout of the function
+         */
+        TSharedRef<const FDynamicFunctionLayout, ESPMode::NotThreadSafe> Find(UObject *Object, FName FunctionName);
+
+      private:
+        struct FEntry {
+            const UClass *Class;
+            FName FunctionName;
+            TSharedRef<const FDynamicFunctionLayout, ESPMode::NotThreadSafe> Layout;
+        };
+
+        TArray<FEntry, TInlineAllocator<1>> Entries;
+    };
+
+    /**
+     * Call a function with an already populated parameter block, either directly through its native thunk or through
+     * ProcessEvent for functions that are implemented in script or need to be routed over the network.
+     *
+     * @param Object The object to call the function on
+     * @param Layout The layout of the function
+     * @param Parms The parameter block
+     */
+    RETROLIBUE_API void InvokeDynamicFunction(UObject *Object, const FDynamicFunctionLayout &Layout, uint8 *Parms);
+
+#if WITH_TESTS
+    /**
+     * Get the number of calls that InvokeDynamicFunction has sent through ProcessEvent on the calling thread, so tests
+     * can tell which path a call took even when the target has no observable effect.
+     *
+     * @return The number of ProcessEvent calls made so far
+     */
+    RETROLIBUE_API int32 GetNumProcessEventInvocations();
+#endif
+
+    namespace Private {
+        /**
+         * Reads the listeners of a dynamic multicast delegate. The invocation list is a protected member of the script
+         * delegate base, so it can be named through a class that derives from it without any friend declaration or
+         * access check workaround. If the engine renames or reshapes the member this reports it as unavailable, and
+         * broadcasting falls back to the generated Broadcast, which goes through ProcessEvent.
+         *
+         * @tparam B The script delegate base of the multicast delegate
+         */
+        template <typename B>
+        struct TInvocationListAccess : B {
+            static constexpr bool IsAvailable() {
+                return requires(const B &Delegate) {
+                    {
+                        Delegate.*(&TInvocationListAccess::InvocationList)
+                    } -> std::convertible_to<TConstArrayView<FScriptDelegate>>;
+                };
+            }
+
+            static TConstArrayView<FScriptDelegate> Get(const B &Delegate) {
+                return Delegate.*(&TInvocationListAccess::InvocationList);
+            }
+        };
+
+        template <typename T>
+        constexpr bool IsWrittenBack = std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>;
+
+        template <typename R, typename... P>
+        struct TDynamicSignature {
+            template <typename D, typename... A>
+            static R Execute(const D &Delegate, FDynamicFunctionCache &Cache, A &&...Args) {
+                UObject *Object = Delegate.GetUObject();
+                check(Object != nullptr);
+                auto Layout = Cache.Find(Object, Delegate.GetFunctionName());
+                if (!Layout->Matches<R, P...>()) [[unlikely]] {
+                    return Delegate.Execute(std::forward<A>(Args)...);
+                }
+
+                return Invoke(Object, *Layout, std::index_sequence_for<P...>(), std::forward<A>(Args)...);
+            }
+
+            template <typename D, typename... A>
+            static void Broadcast(const D &Delegate, FDynamicFunctionCache &Cache, A &&...Args) {
+                using FInvocationListAccess = TInvocationListAccess<decltype(TMulticastScriptDelegate(Delegate))>;
+                if constexpr (!FInvocationListAccess::IsAvailable()) {
+                    Delegate.Broadcast(std::forward<A>(Args)...);
+                } else {
+                    // Copy the listeners as Broadcast does, so that listeners can remove themselves while being called
+                    TArray<FScriptDelegate, TInlineAllocator<4>> Listeners(FInvocationListAccess::Get(Delegate));
+                    for (const FScriptDelegate &Listener : Listeners) {
+                        if (UObject *Object = Listener.GetUObject();
+                            Object != nullptr &&
+                            !Cache.Find(Object, Listener.GetFunctionName())->Matches<R, P...>()) [[unlikely]] {
+                            Delegate.Broadcast(std::forward<A>(Args)...);
+                            return;
+                        }
+                    }
+
+                    for (const FScriptDelegate &Listener : Listeners) {
+                        // A listener can destroy a later one, so the object is checked again right before each call
+                        if (UObject *Object = Listener.GetUObject(); Object != nullptr) {
+                            auto Layout = Cache.Find(Object, Listener.GetFunctionName());
+                            Invoke(Object, *Layout, std::index_sequence_for<P...>(), Args...);
+                        }
+                    }
+                }
+            }
+
+          private:
+            /**
+             * Build the parameter block for a single call, invoke the function and then copy any reference
+             * parameters back to the caller, matching what the generated Execute/Broadcast functions do with their
+             * parameter struct. This is never inlined so that the parameter block is released after every call when
+             * invoked in a loop.
+             */
+            template <std::size_t... I, typename... A>
+            static FORCENOINLINE R Invoke(UObject *Object, const FDynamicFunctionLayout &Layout,
+                                          std::index_sequence<I...>, A &&...Args) {
+                uint8 *Parms = static_cast<uint8 *>(
+                    FMemory_Alloca_Aligned(FMath::Max(Layout.ParmsSize, 1), Layout.MinAlignment));
+                (new (Parms + Layout.ParamOffsets[I]) TParmType<P>(std::forward<A>(Args)), ...);
+                if constexpr (!std::is_void_v<R>) {
+                    new (Parms + Layout.ReturnOffset) R();
+                }
+
+                InvokeDynamicFunction(Object, Layout, Parms);
+
+                (
+                    [Parms]<typename T, typename B>(B &Arg, int32 Offset) {
+                        auto *Value = reinterpret_cast<TParmType<T> *>(Parms + Offset);
+                        if constexpr (IsWrittenBack<T>) {
+                            Arg = MoveTemp(*Value);
+                        }
+                        DestructItem(Value);
+                    }.template operator()<P>(Args, Layout.ParamOffsets[I]),
+                    ...);
+
+                if constexpr (!std::is_void_v<R>) {
+                    R *ReturnValue = reinterpret_cast<R *>(Parms + Layout.ReturnOffset);
+                    R Result = MoveTemp(*ReturnValue);
+                    DestructItem(ReturnValue);
+                    return Result;
+                }
+            }
+        };
+
+        template <typename W, typename R, typename... P>
+        TDynamicSignature<R, P...> DeduceDynamicSignature(const TBaseDynamicDelegate<W, R, P...> &);
+
+        template <typename W, typename R, typename... P>
+        TDynamicSignature<R, P...> DeduceDynamicSignature(const TBaseDynamicMulticastDelegate<W, R, P...> &);
+    } // namespace Private
+
+    /**
+     * Execute a dynamic delegate, calling native targets directly through their thunk instead of through
+     * ProcessEvent. The bound function is resolved once per cache rather than looked up by name on every call.
+     *
+     * @tparam D The type of delegate
+     * @tparam A The types of the arguments
+     * @param Delegate The delegate to execute, which must be bound
+     * @param Cache The function cache owned by the call site
+     * @param Args The arguments to pass
+     * @return The result of the bound function
+     */
+    template <typename D, typename... A>
+    decltype(auto) ExecuteDynamic(const D &Delegate, FDynamicFunctionCache &Cache, A &&...Args) {
+        using FSignature = decltype(Private::DeduceDynamicSignature(Delegate));
+        return FSignature::Execute(Delegate, Cache, std::forward<A>(Args)...);
+    }
+
+    /**
+     * Broadcast a dynamic multicast delegate, calling native listeners directly through their thunk instead of
+     * through ProcessEvent. Listeners implemented in Blueprint still go through ProcessEvent.
+     *
+     * @tparam D The type of delegate
+     * @tparam A The types of the arguments
+     * @param Delegate The delegate to broadcast
+     * @param Cache The function cache owned by the call site
+     * @param Args The arguments to pass
+     */
+    template <typename D, typename... A>
+    void BroadcastDynamic(const D &Delegate, FDynamicFunctionCache &Cache, A &&...Args) {
+        using FSignature = decltype(Private::DeduceDynamicSignature(Delegate));
+        FSignature::Broadcast(Delegate, Cache, std::forward<A>(Args)...);
+    }
+} // namespace Retro::Delegates
@@ -0,0 +1,203 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Concepts/Delegates.h"
+
+#include <Containers/LockFreeFixedSizeAllocator.h>
+#include <Misc/Optional.h>
+#include <Templates/SharedPointer.h>
+
+#include <atomic>
+#include <tuple>
+
+namespace Retro::Delegates {
+
+    /**
+     * Queue of calls made from any thread that are executed together on the game thread. Producers push onto a
+     * lock-free intrusive stack, and the game thread takes the whole stack in one exchange when it drains, so
+     * enqueuing never blocks and draining never contends with producers. Small calls are carved out of a lock-free
+     * fixed size block allocator that recycles its blocks, so steady-state enqueues do not touch the global allocator.
+     *
+     * The queue is drained once per tick by the module's core ticker, or manually through Flush.
+     */
+    class RETROLIBUE_API FGameThreadDispatcher {
+      public:
+        /**
+         * The size of the pooled blocks. Calls whose payload does not fit fall back to the global allocator.
+         */
+        static constexpr SIZE_T BlockSize = 128;
+
+        /**
+         * A single queued call.
+         */
+        struct FCall {
+            virtual ~FCall() = default;
+
+            /**
+             * Run the call on the game thread.
+             */
+            virtual void Execute() = 0;
+
+            FCall *Next = nullptr;
+            TOptional<uint64> CoalescingKey;
+            uint32 AllocationSize = 0;
+        };
+
+        FGameThreadDispatcher() = default;
+
+        UE_NONCOPYABLE(FGameThreadDispatcher)
+
+        ~FGameThreadDispatcher();
+
+        /**
+         * Get the global dispatcher.
+         *
+         * @return The dispatcher
+         */
+        static FGameThreadDispatcher &Get();
+
+        /**
+         * Queue a call, constructing it in place. Safe to call from any thread.
+         *
+         * @tparam T The type of call to create
+         * @tparam A The types of the constructor arguments
+         * @param CoalescingKey If set, only the most recently queued call with this key is run at the next drain
+         * @param Args The constructor arguments
+         */
+        template <std::derived_from<FCall> T, typename... A>
+        void Enqueue(TOptional<uint64> CoalescingKey, A &&...Args) {
+            static_assert(alignof(T) <= 16, "Queued calls must not be over-aligned");
+            T *Call = new (Allocate(sizeof(T))) T(std::forward<A>(Args)...);
+            Call->CoalescingKey = CoalescingKey;
+            Call->AllocationSize = static_cast<uint32>(sizeof(T));
+            Push(Call);
+        }
+
+        /**
+         * Run every call that was queued before this point. Calls queued while draining are left for the next drain.
+         * Must be called on the game thread.
+         *
+         * @return The number of calls that were run
+         */
+        int32 Flush();
+
+        /**
+         * Destroy every queued call without running it.
+         */
+        void Discard();
+
+        /**
+         * Check if there is anything waiting to be drained. The result may be out of date by the time it is used.
+         *
+         * @return Are there queued calls
+         */
+        bool HasPendingCalls() const {
+            return Head.load(std::memory_order_relaxed) != nullptr;
+        }
+
+      private:
+        void *Allocate(SIZE_T Size);
+
+        void Free(FCall *Call);
+
+        void Push(FCall *Call);
+
+        FCall *TakeAll();
+
+        std::atomic<FCall *> Head = nullptr;
+        TLockFreeFixedSizeAllocator<BlockSize, PLATFORM_CACHE_LINE_SIZE> BlockAllocator;
+    };
+
+    /**
+     * A queued call to a delegate with its arguments copied out.
+     *
+     * @tparam D The type of delegate
+     * @tparam A The types of the stored arguments
+     */
+    template <UEDelegate D, typename... A>
+    struct TMarshalledCall final : FGameThreadDispatcher::FCall {
+        template <typename... B>
+        explicit TMarshalledCall(const TSharedRef<D, ESPMode::ThreadSafe> &Delegate, B &&...Args)
+            : Delegate(Delegate), Args(std::forward<B>(Args)...) {
+        }
+
+        void Execute() override {
+            std::apply(
+                [this](A &...Arguments) {
+                    if constexpr (UnicastDelegate<D>) {
+                        // The target may have been destroyed since the call was queued
+                        if (Delegate->IsBound()) {
+                            Delegate->Execute(Arguments...);
+                        }
+                    } else {
+                        Delegate->Broadcast(Arguments...);
+                    }
+                },
+                Args);
+        }
+
+        TSharedRef<D, ESPMode::ThreadSafe> Delegate;
+        std::tuple<A...> Args;
+    };
+
+    /**
+     * Callable wrapper around a delegate that can be invoked from any thread, and always runs the delegate on the
+     * game thread at the next drain of the FGameThreadDispatcher. The arguments are copied when the wrapper is
+     * invoked and any return value is discarded, so the delegate should not rely on writing through reference
+     * parameters.
+     *
+     * @tparam D The type of delegate
+     */
+    template <UEDelegate D>
+    class TGameThreadMarshaller {
+      public:
+        /**
+         * Wrap a delegate.
+         *
+         * @param Delegate The delegate to call on the game thread
+         * @param CoalescingKey If set, calls through this wrapper that are still waiting when the queue drains are
+         *                      collapsed so that only the most recent one runs. Wrappers that share a key coalesce with
+         *                      each other.
+         */
+        explicit TGameThreadMarshaller(D Delegate, TOptional<uint64> CoalescingKey = NullOpt)
+            : Delegate(MakeShared<D, ESPMode::ThreadSafe>(MoveTemp(Delegate))), CoalescingKey(CoalescingKey) {
+        }
+
+        /**
+         * Queue a call to the delegate. Safe to call from any thread.
+         *
+         * @param Args The arguments to call the delegate with
+         */
+        template <typename... A>
+        void operator()(A &&...Args) const {
+            FGameThreadDispatcher::Get().Enqueue<TMarshalledCall<D, std::decay_t<A>...>>(CoalescingKey, Delegate,
+                                                                                        std::forward<A>(Args)...);
+        }
+
+      private:
+        TSharedRef<D, ESPMode::ThreadSafe> Delegate;
+        TOptional<uint64> CoalescingKey;
+    };
+
+    /**
+     * Wrap a delegate, such as one made with Create, so that invoking it from a worker thread queues the call to run
+     * on the game thread. All of the calls queued during a frame are run back to back by a single drain instead of
+     * spawning one task graph task for each.
+     *
+     *     auto OnPathFound = Retro::Delegates::MarshalToGameThread(
+     *         Retro::Delegates::Create<FOnPathFound>(this, &UNavigator::HandlePath));
+     *     // On a worker
+     *     OnPathFound(MoveTemp(Path));
+     *
+     * @tparam D The type of delegate
+     * @param Delegate The delegate to wrap
+     * @param CoalescingKey Optional key used to collapse pending calls so that only the most recent one runs
+     * @return The callable wrapper
+     */
+    template <UEDelegate D>
+    TGameThreadMarshaller<std::decay_t<D>> MarshalToGameThread(D &&Delegate,
+                                                               TOptional<uint64> CoalescingKey = NullOpt) {
+        return TGameThreadMarshaller<std::decay_t<D>>(std::forward<D>(Delegate), CoalescingKey);
+    }
+} // namespace Retro::Delegates
@@ -0,0 +1,261 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/Delegates.h"
+
+#include <functional>
+#include <tuple>
+
+namespace Retro::Delegates {
+
+    /**
+     * Concept for an object that a member binding can be invoked on. This is either a raw pointer or a smart pointer
+     * that exposes the object through Get(), such as TObjectPtr, TWeakObjectPtr, TSharedRef or TSharedPtr.
+     *
+     * @tparam T The type to check
+     */
+    template <typename T>
+    concept BindingObject = std::is_pointer_v<T> || requires(const T &Object) { Object.Get(); };
+
+    /**
+     * Get the raw pointer that a member binding should be invoked on.
+     *
+     * @tparam T The type of object holder
+     * @param Object The object holder
+     * @return The raw pointer, or nullptr if the object is no longer valid
+     */
+    template <BindingObject T>
+    constexpr auto *GetBindingObject(const T &Object) {
+        if constexpr (std::is_pointer_v<T>) {
+            return Object;
+        } else if constexpr (std::is_pointer_v<decltype(Object.Get())>) {
+            return Object.Get();
+        } else {
+            // TSharedRef hands out a reference, as it can never be null
+            return &Object.Get();
+        }
+    }
+
+    /**
+     * Binding to a free or static function that is known at compile time, along with any payload arguments. Unlike a
+     * delegate there is no delegate instance, so calling the binding is a direct, inlinable call to the function that
+     * requires neither a heap allocation nor a virtual call. The binding has the same IsBound/Execute surface as a
+     * unicast delegate and is callable, so it can be passed anywhere a functor is expected, including CreateBinding
+     * and BindBack.
+     *
+     * @tparam Functor The function to call
+     * @tparam P The types of the payload arguments appended after the call arguments
+     */
+    template <auto Functor, typename... P>
+    class TStaticBinding {
+      public:
+        constexpr TStaticBinding() = default;
+
+        template <typename... B>
+            requires(sizeof...(B) > 0) && std::constructible_from<std::tuple<P...>, B...>
+        constexpr explicit TStaticBinding(B &&...Payload) : Payload(std::forward<B>(Payload)...) {
+        }
+
+        /**
+         * A static binding can never go stale.
+         *
+         * @return Always true
+         */
+        constexpr bool IsBound() const {
+            return true;
+        }
+
+        /**
+         * Call the bound function with the given arguments followed by the payload.
+         *
+         * @param Args The call arguments
+         * @return The result of the function
+         */
+        template <typename... A>
+            requires std::invocable<decltype(Functor), A..., const P &...>
+        constexpr decltype(auto) Execute(A &&...Args) const {
+            return std::apply(
+                [&Args...](const P &...Payload) -> decltype(auto) {
+                    return std::invoke(Functor, std::forward<A>(Args)..., Payload...);
+                },
+                Payload);
+        }
+
+        /**
+         * Call the bound function. Provided for parity with delegates, as the function is always bound.
+         *
+         * @param Args The call arguments
+         * @return Always true
+         */
+        template <typename... A>
+            requires std::invocable<decltype(Functor), A..., const P &...>
+        constexpr bool ExecuteIfBound(A &&...Args) const {
+            Execute(std::forward<A>(Args)...);
+            return true;
+        }
+
+        template <typename... A>
+            requires std::invocable<decltype(Functor), A..., const P &...>
+        constexpr decltype(auto) operator()(A &&...Args) const {
+            return Execute(std::forward<A>(Args)...);
+        }
+
+        /**
+         * Convert the binding into a delegate, for when the callback needs to be stored type-erased.
+         *
+         * @tparam D The type of delegate to create
+         * @return The created delegate
+         */
+        template <UEDelegate D>
+        D ToDelegate() const {
+            return std::apply([](const P &...Payload) { return Create<D>(Functor, Payload...); }, Payload);
+        }
+
+      private:
+        std::tuple<P...> Payload;
+    };
+
+    /**
+     * Binding to a member function that is known at compile time, invoked on an object along with any payload
+     * arguments. As with TStaticBinding, calls are direct and never go through a delegate instance. The binding is
+     * bound for as long as the object holder resolves to a valid pointer, so holding a TWeakObjectPtr gives the same
+     * lifetime semantics as a UObject delegate.
+     *
+     * @tparam Method The member function to call
+     * @tparam O The type of object holder
+     * @tparam P The types of the payload arguments appended after the call arguments
+     */
+    template <auto Method, BindingObject O, typename... P>
+        requires std::is_member_function_pointer_v<decltype(Method)>
+    class TMemberBinding {
+      public:
+        template <typename T, typename... B>
+            requires std::constructible_from<O, T> && std::constructible_from<std::tuple<P...>, B...>
+        constexpr explicit TMemberBinding(T &&Object, B &&...Payload)
+            : Object(std::forward<T>(Object)), Payload(std::forward<B>(Payload)...) {
+        }
+
+        /**
+         * Check if the object the binding calls into is still valid.
+         *
+         * @return Can the binding be executed
+         */
+        constexpr bool IsBound() const {
+            return GetBindingObject(Object) != nullptr;
+        }
+
+        /**
+         * Call the bound method on the object with the given arguments followed by the payload. The object must be
+         * valid.
+         *
+         * @param Args The call arguments
+         * @return The result of the method
+         */
+        template <typename... A>
+            requires std::invocable<decltype(Method), decltype(GetBindingObject(std::declval<const O &>())), A...,
+                                    const P &...>
+        constexpr decltype(auto) Execute(A &&...Args) const {
+            auto *Target = GetBindingObject(Object);
+            check(Target != nullptr);
+            return std::apply(
+                [Target, &Args...](const P &...Payload) -> decltype(auto) {
+                    return std::invoke(Method, Target, std::forward<A>(Args)..., Payload...);
+                },
+                Payload);
+        }
+
+        /**
+         * Call the bound method if the object is still valid.
+         *
+         * @param Args The call arguments
+         * @return Was the method called
+         */
+        template <typename... A>
+            requires std::invocable<decltype(Method), decltype(GetBindingObject(std::declval<const O &>())), A...,
+                                    const P &...>
+        constexpr bool ExecuteIfBound(A &&...Args) const {
+            auto *Target = GetBindingObject(Object);
+            if (Target == nullptr) {
+                return false;
+            }
+
+            std::apply(
+                [Target, &Args...](const P &...Payload) {
+                    std::invoke(Method, Target, std::forward<A>(Args)..., Payload...);
+                },
+                Payload);
+            return true;
+        }
+
+        template <typename... A>
+            requires std::invocable<decltype(Method), decltype(GetBindingObject(std::declval<const O &>())), A...,
+                                    const P &...>
+        constexpr decltype(auto) operator()(A &&...Args) const {
+            return Execute(std::forward<A>(Args)...);
+        }
+
+        /**
+         * Convert the binding into a delegate, for when the callback needs to be stored type-erased. The delegate is
+         * created with the same kind of binding Create would pick for the object, e.g. a UObject binding for
+         * UObjects.
+         *
+         * @tparam D The type of delegate to create
+         * @return The created delegate
+         */
+        template <UEDelegate D>
+        D ToDelegate() const {
+            return std::apply(
+                [this](const P &...Payload) {
+                    if constexpr (CanBindMember<D, const O &, decltype(Method), const P &...>) {
+                        return Create<D>(Object, Method, Payload...);
+                    } else {
+                        return Create<D>(GetBindingObject(Object), Method, Payload...);
+                    }
+                },
+                Payload);
+        }
+
+      private:
+        O Object;
+        std::tuple<P...> Payload;
+    };
+
+    /**
+     * Bind a free or static function as a template parameter, producing a callable that dispatches directly to it.
+     *
+     *     auto Binding = Retro::Delegates::BindStatic<&OnDamaged>(Multiplier);
+     *     Binding.Execute(Target, Amount); // Calls OnDamaged(Target, Amount, Multiplier)
+     *
+     * @tparam Functor The function to bind
+     * @tparam P The types of the payload arguments
+     * @param Payload The payload arguments appended after the call arguments
+     * @return The binding
+     */
+    template <auto Functor, typename... P>
+        requires(!std::is_member_function_pointer_v<decltype(Functor)>)
+    constexpr auto BindStatic(P &&...Payload) {
+        return TStaticBinding<Functor, std::decay_t<P>...>(std::forward<P>(Payload)...);
+    }
+
+    /**
+     * Bind a member function as a template parameter, producing a callable that dispatches directly to it on the given
+     * object.
+     *
+     *     auto Binding = Retro::Delegates::BindMember<&UHealthComponent::ApplyDamage>(MakeWeakObjectPtr(Component));
+     *     Binding.ExecuteIfBound(Amount);
+     *
+     * @tparam Method The member function to bind
+     * @tparam O The type of the object holder
+     * @tparam P The types of the payload arguments
+     * @param Object The object to call the method on
+     * @param Payload The payload arguments appended after the call arguments
+     * @return The binding
+     */
+    template <auto Method, typename O, typename... P>
+        requires std::is_member_function_pointer_v<decltype(Method)> && BindingObject<std::decay_t<O>>
+    constexpr auto BindMember(O &&Object, P &&...Payload) {
+        return TMemberBinding<Method, std::decay_t<O>, std::decay_t<P>...>(std::forward<O>(Object),
+                                                                           std::forward<P>(Payload)...);
+    }
+} // namespace Retro::Delegates
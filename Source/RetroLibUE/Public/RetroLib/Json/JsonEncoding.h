@@ -0,0 +1,419 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Json/JsonStreamWriter.h"
+#include "RetroLib/Ranges/Views/PropertyView.h"
+#include "RetroLib/TypeTraits.h"
+
+#include <Misc/Optional.h>
+#include <Misc/StringBuilder.h>
+#include <Policies/CondensedJsonPrintPolicy.h>
+#include <Serialization/JsonWriter.h>
+
+#include <functional>
+#include <ranges>
+#include <tuple>
+
+namespace Retro::Json {
+
+    /**
+     * Concept for the target of the JSON encoder. FJsonStreamWriter is the fast path, TJsonWriterAdapter lets the
+     * encoder write into an existing TJsonWriter.
+     *
+     * @tparam W The writer type
+     */
+    template <typename W>
+    concept JsonSink = requires(W &Writer, FStringView String) {
+        Writer.BeginObject();
+        Writer.EndObject();
+        Writer.BeginArray();
+        Writer.EndArray();
+        Writer.WriteKey(String);
+        Writer.WriteNull();
+        Writer.WriteBool(true);
+        Writer.WriteInt(int64());
+        Writer.WriteUInt(uint64());
+        Writer.WriteFloat(float());
+        Writer.WriteDouble(double());
+        Writer.WriteString(String);
+    };
+
+    /**
+     * Writes into a TJsonWriter, so that values can be encoded into a document the engine's writer is already
+     * producing.
+     *
+     * @tparam C The character type of the writer
+     * @tparam P The print policy of the writer
+     */
+    template <typename C = TCHAR, typename P = TCondensedJsonPrintPolicy<C>>
+    class TJsonWriterAdapter {
+      public:
+        explicit TJsonWriterAdapter(TJsonWriter<C, P> &Writer) : Writer(&Writer) {
+        }
+
+        void BeginObject() {
+            Writer->WriteObjectStart();
+        }
+
+        void EndObject() {
+            Writer->WriteObjectEnd();
+        }
+
+        void BeginArray() {
+            Writer->WriteArrayStart();
+        }
+
+        void EndArray() {
+            Writer->WriteArrayEnd();
+        }
+
+        void WriteKey(FStringView Key) {
+            Writer->WriteIdentifierPrefix(FString(Key));
+        }
+
+        void WriteNull() {
+            Writer->WriteNull();
+        }
+
+        void WriteBool(bool bValue) {
+            Writer->WriteValue(bValue);
+        }
+
+        void WriteInt(int64 Value) {
+            Writer->WriteValue(Value);
+        }
+
+        void WriteUInt(uint64 Value) {
+            if (Value <= static_cast<uint64>(MAX_int64)) {
+                Writer->WriteValue(static_cast<int64>(Value));
+            } else {
+                Writer->WriteValue(static_cast<double>(Value));
+            }
+        }
+
+        void WriteFloat(float Value) {
+            Writer->WriteValue(Value);
+        }
+
+        void WriteDouble(double Value) {
+            Writer->WriteValue(Value);
+        }
+
+        void WriteString(FStringView Value) {
+            Writer->WriteValue(FString(Value));
+        }
+
+      private:
+        TJsonWriter<C, P> *Writer;
+    };
+
+    /**
+     * A named field of a compile-time JSON descriptor.
+     *
+     * @tparam M The member pointer or projection that reads the field
+     */
+    template <typename M>
+    struct TJsonField {
+        const TCHAR *Name;
+        M Member;
+    };
+
+    /**
+     * Create a field for a JSON descriptor.
+     *
+     * @param Name The key of the field
+     * @param Member The member pointer, or any callable that takes the struct and returns the value
+     * @return The field
+     */
+    template <typename M>
+    constexpr TJsonField<M> Field(const TCHAR *Name, M Member) {
+        return TJsonField<M>{Name, Member};
+    }
+
+    /**
+     * Compile-time description of how a type maps to a JSON object. Specialize this with a static constexpr tuple of
+     * fields named Fields, which takes priority over reflection for USTRUCTs:
+     *
+     *     template <>
+     *     struct Retro::Json::TJsonFields<FHitEvent> {
+     *         static constexpr auto Fields = std::make_tuple(Field(TEXT("time"), &FHitEvent::Time),
+     *                                                        Field(TEXT("damage"), &FHitEvent::Damage));
+     *     };
+     *
+     * @tparam T The described type
+     */
+    template <typename T>
+    struct TJsonFields;
+
+    /**
+     * Concept for a type that has a TJsonFields descriptor.
+     *
+     * @tparam T The type to check
+     */
+    template <typename T>
+    concept HasJsonFields = requires { TJsonFields<std::remove_cvref_t<T>>::Fields; };
+
+    template <JsonSink W>
+    void WriteStruct(W &Writer, const UStruct *Struct, const void *Container);
+
+    namespace Private {
+        template <typename T>
+        struct TIsOptional : std::false_type {};
+
+        template <typename T>
+        struct TIsOptional<TOptional<T>> : std::true_type {};
+
+        template <typename T>
+        concept JsonString = std::same_as<T, FString> || std::same_as<T, FStringView> || std::same_as<T, FName> ||
+                             std::same_as<T, FText> || std::convertible_to<T, const TCHAR *>;
+
+        template <typename T>
+        concept JsonMapRange = std::ranges::input_range<T> && TupleLike<std::ranges::range_value_t<T>> &&
+                               (std::tuple_size_v<std::ranges::range_value_t<T>> == 2) &&
+                               (JsonString<std::decay_t<std::tuple_element_t<0, std::ranges::range_value_t<T>>>> ||
+                                std::integral<std::decay_t<std::tuple_element_t<0, std::ranges::range_value_t<T>>>>);
+
+        template <typename T>
+        concept ReflectedStruct = requires {
+            { std::remove_cvref_t<T>::StaticStruct() } -> std::convertible_to<const UScriptStruct *>;
+        };
+
+        template <JsonSink W, typename T>
+        void WriteStringValue(W &Writer, const T &Value) {
+            if constexpr (std::same_as<T, FName>) {
+                TStringBuilder<FName::StringBufferSize> Builder;
+                Value.AppendString(Builder);
+                Writer.WriteString(Builder.ToView());
+            } else if constexpr (std::same_as<T, FText>) {
+                Writer.WriteString(Value.ToString());
+            } else {
+                Writer.WriteString(FStringView(Value));
+            }
+        }
+
+        template <JsonSink W, typename T>
+        void WriteKeyValue(W &Writer, const T &Key) {
+            if constexpr (std::integral<T>) {
+                TStringBuilder<32> Builder;
+                Builder << Key;
+                Writer.WriteKey(Builder.ToView());
+            } else if constexpr (std::same_as<T, FName>) {
+                TStringBuilder<FName::StringBufferSize> Builder;
+                Key.AppendString(Builder);
+                Writer.WriteKey(Builder.ToView());
+            } else if constexpr (std::same_as<T, FText>) {
+                Writer.WriteKey(Key.ToString());
+            } else {
+                Writer.WriteKey(FStringView(Key));
+            }
+        }
+
+        template <JsonSink W>
+        void WriteEnumValue(W &Writer, const UEnum *Enum, int64 Value) {
+            if (Enum != nullptr && Enum->IsValidEnumValue(Value)) {
+                Writer.WriteString(Enum->GetNameStringByValue(Value));
+            } else {
+                Writer.WriteInt(Value);
+            }
+        }
+
+        template <JsonSink W>
+        void WritePropertyKey(W &Writer, const FProperty *Property, const void *Value) {
+            if (const FStrProperty *String = CastField<FStrProperty>(Property)) {
+                Writer.WriteKey(String->GetPropertyValue(Value));
+            } else if (const FNameProperty *Name = CastField<FNameProperty>(Property)) {
+                WriteKeyValue(Writer, Name->GetPropertyValue(Value));
+            } else {
+                FString Text;
+                Property->ExportTextItem_Direct(Text, Value, nullptr, nullptr, PPF_None);
+                Writer.WriteKey(Text);
+            }
+        }
+
+        /**
+         * Write a single reflected value. Common property types are written directly from memory, anything else falls
+         * back to its exported text.
+         */
+        template <JsonSink W>
+        void WriteProperty(W &Writer, const FProperty *Property, const void *Value) {
+            if (const FBoolProperty *Bool = CastField<FBoolProperty>(Property)) {
+                Writer.WriteBool(Bool->GetPropertyValue(Value));
+            } else if (const FEnumProperty *Enum = CastField<FEnumProperty>(Property)) {
+                WriteEnumValue(Writer, Enum->GetEnum(), Enum->GetUnderlyingProperty()->GetSignedIntPropertyValue(Value));
+            } else if (const FNumericProperty *Numeric = CastField<FNumericProperty>(Property)) {
+                if (const UEnum *IntEnum = Numeric->GetIntPropertyEnum()) {
+                    WriteEnumValue(Writer, IntEnum, Numeric->GetSignedIntPropertyValue(Value));
+                } else if (const FFloatProperty *Float = CastField<FFloatProperty>(Property)) {
+                    Writer.WriteFloat(Float->GetPropertyValue(Value));
+                } else if (Numeric->IsFloatingPoint()) {
+                    Writer.WriteDouble(Numeric->GetFloatingPointPropertyValue(Value));
+                } else if (Property->IsA<FUInt64Property>()) {
+                    Writer.WriteUInt(Numeric->GetUnsignedIntPropertyValue(Value));
+                } else {
+                    Writer.WriteInt(Numeric->GetSignedIntPropertyValue(Value));
+                }
+            } else if (const FStrProperty *String = CastField<FStrProperty>(Property)) {
+                Writer.WriteString(String->GetPropertyValue(Value));
+            } else if (const FNameProperty *Name = CastField<FNameProperty>(Property)) {
+                WriteStringValue(Writer, Name->GetPropertyValue(Value));
+            } else if (const FTextProperty *Text = CastField<FTextProperty>(Property)) {
+                WriteStringValue(Writer, Text->GetPropertyValue(Value));
+            } else if (const FStructProperty *Struct = CastField<FStructProperty>(Property)) {
+                Json::WriteStruct(Writer, Struct->Struct, Value);
+            } else if (const FArrayProperty *Array = CastField<FArrayProperty>(Property)) {
+                FScriptArrayHelper Helper(Array, Value);
+                Writer.BeginArray();
+                for (int32 i = 0; i < Helper.Num(); i++) {
+                    WriteProperty(Writer, Array->Inner, Helper.GetRawPtr(i));
+                }
+                Writer.EndArray();
+            } else if (const FSetProperty *Set = CastField<FSetProperty>(Property)) {
+                FScriptSetHelper Helper(Set, Value);
+                Writer.BeginArray();
+                for (int32 i = 0; i < Helper.GetMaxIndex(); i++) {
+                    if (Helper.IsValidIndex(i)) {
+                        WriteProperty(Writer, Set->ElementProp, Helper.GetElementPtr(i));
+                    }
+                }
+                Writer.EndArray();
+            } else if (const FMapProperty *Map = CastField<FMapProperty>(Property)) {
+                FScriptMapHelper Helper(Map, Value);
+                Writer.BeginObject();
+                for (int32 i = 0; i < Helper.GetMaxIndex(); i++) {
+                    if (Helper.IsValidIndex(i)) {
+                        WritePropertyKey(Writer, Map->KeyProp, Helper.GetKeyPtr(i));
+                        WriteProperty(Writer, Map->ValueProp, Helper.GetValuePtr(i));
+                    }
+                }
+                Writer.EndObject();
+            } else if (const FObjectPropertyBase *Object = CastField<FObjectPropertyBase>(Property)) {
+                if (const UObject *Target = Object->GetObjectPropertyValue(Value)) {
+                    Writer.WriteString(Target->GetPathName());
+                } else {
+                    Writer.WriteNull();
+                }
+            } else {
+                FString Exported;
+                Property->ExportTextItem_Direct(Exported, Value, nullptr, nullptr, PPF_None);
+                Writer.WriteString(Exported);
+            }
+        }
+    } // namespace Private
+
+    /**
+     * Write the properties of a struct instance as an object through reflection, walking the cached flat property
+     * layout rather than the property chain. This is what USTRUCTs without a descriptor are encoded with, and it
+     * can be called directly for types that only expose their struct through TBaseStructure, such as FVector.
+     *
+     * @tparam W The writer type
+     * @param Writer The writer to encode into
+     * @param Struct The type of the instance
+     * @param Container The instance itself
+     */
+    template <JsonSink W>
+    void WriteStruct(W &Writer, const UStruct *Struct, const void *Container) {
+        Ranges::TPropertyView<FProperty, true> Properties(Struct, Container, EFieldIterationFlags::IncludeSuper);
+        int32 Num = static_cast<int32>(Properties.size());
+        TStringBuilder<FName::StringBufferSize> Key;
+
+        Writer.BeginObject();
+        for (int32 i = 0; i < Num;) {
+            const FProperty *Property = Properties[i].Property;
+            Key.Reset();
+            Property->GetFName().AppendString(Key);
+            Writer.WriteKey(Key.ToView());
+
+            // Static arrays are expanded into one layout entry per element, so gather them back into a single array
+            if (i + 1 < Num && Properties[i + 1].Property == Property) {
+                Writer.BeginArray();
+                for (; i < Num && Properties[i].Property == Property; i++) {
+                    Private::WriteProperty(Writer, Property, Properties[i].ValuePtr);
+                }
+                Writer.EndArray();
+            } else {
+                Private::WriteProperty(Writer, Property, Properties[i].ValuePtr);
+                i++;
+            }
+        }
+        Writer.EndObject();
+    }
+
+    /**
+     * Encode a value as JSON. The representation is picked at compile time:
+     *
+     * - Types with a TJsonFields descriptor become objects with the described fields.
+     * - Booleans, numbers and strings, including FName and FText, map to the matching JSON type. Reflected enums are
+     *   written by name, other enums by value.
+     * - An unset TOptional is written as null.
+     * - USTRUCTs without a descriptor are written through reflection.
+     * - Ranges of pairs with string or integer keys, such as a TMap, become objects.
+     * - Other tuples and ranges become arrays.
+     *
+     * @tparam W The writer type
+     * @tparam T The value type
+     * @param Writer The writer to encode into
+     * @param Value The value to encode
+     */
+    template <JsonSink W, typename T>
+    void WriteValue(W &Writer, const T &Value) {
+        using FValue = std::remove_cvref_t<T>;
+        if constexpr (HasJsonFields<FValue>) {
+            Writer.BeginObject();
+            std::apply(
+                [&Writer, &Value](const auto &...Fields) {
+                    ((Writer.WriteKey(Fields.Name), WriteValue(Writer, std::invoke(Fields.Member, Value))), ...);
+                },
+                TJsonFields<FValue>::Fields);
+            Writer.EndObject();
+        } else if constexpr (std::same_as<FValue, bool>) {
+            Writer.WriteBool(Value);
+        } else if constexpr (std::signed_integral<FValue>) {
+            Writer.WriteInt(Value);
+        } else if constexpr (std::unsigned_integral<FValue>) {
+            Writer.WriteUInt(Value);
+        } else if constexpr (std::same_as<FValue, float>) {
+            Writer.WriteFloat(Value);
+        } else if constexpr (std::floating_point<FValue>) {
+            Writer.WriteDouble(static_cast<double>(Value));
+        } else if constexpr (std::is_enum_v<FValue>) {
+            if constexpr (TIsUEnumClass<FValue>::Value) {
+                Private::WriteEnumValue(Writer, StaticEnum<FValue>(), static_cast<int64>(Value));
+            } else {
+                WriteValue(Writer, static_cast<std::underlying_type_t<FValue>>(Value));
+            }
+        } else if constexpr (Private::JsonString<FValue>) {
+            Private::WriteStringValue(Writer, Value);
+        } else if constexpr (Private::TIsOptional<FValue>::value) {
+            if (Value.IsSet()) {
+                WriteValue(Writer, Value.GetValue());
+            } else {
+                Writer.WriteNull();
+            }
+        } else if constexpr (Private::ReflectedStruct<FValue>) {
+            WriteStruct(Writer, FValue::StaticStruct(), &Value);
+        } else if constexpr (Private::JsonMapRange<const FValue &>) {
+            Writer.BeginObject();
+            for (const auto &Pair : Value) {
+                Private::WriteKeyValue(Writer, get<0>(Pair));
+                WriteValue(Writer, get<1>(Pair));
+            }
+            Writer.EndObject();
+        } else if constexpr (TupleLike<FValue>) {
+            Writer.BeginArray();
+            [&Writer, &Value]<size_t... I>(std::index_sequence<I...>) {
+                (WriteValue(Writer, get<I>(Value)), ...);
+            }(std::make_index_sequence<std::tuple_size_v<FValue>>());
+            Writer.EndArray();
+        } else if constexpr (std::ranges::input_range<const FValue &>) {
+            Writer.BeginArray();
+            for (const auto &Element : Value) {
+                WriteValue(Writer, Element);
+            }
+            Writer.EndArray();
+        } else {
+            static_assert(std::ranges::input_range<const FValue &>,
+                          "The type has no JSON representation, add a TJsonFields descriptor for it");
+        }
+    }
+} // namespace Retro::Json
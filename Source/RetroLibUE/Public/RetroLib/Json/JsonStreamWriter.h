@@ -0,0 +1,110 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Containers/StringView.h>
+#include <Serialization/Archive.h>
+
+namespace Retro::Json {
+
+    /**
+     * Forward-only JSON writer that encodes straight to UTF-8, either into a caller owned byte buffer or into a
+     * fixed size buffer that is flushed to an archive whenever it fills up. There is no document model and no per value
+     * allocation, so the memory used to export a file does not grow with the size of the file.
+     *
+     * Output is always condensed. The writer does not validate the structure of the document beyond debug checks on
+     * the nesting depth, keys must only be written directly inside an object, and every value inside an object must be
+     * preceded by a key. Non-finite floating point values have no JSON representation and are written as null.
+     */
+    class RETROLIBUE_API FJsonStreamWriter {
+      public:
+        /**
+         * The default number of bytes that are buffered before they are flushed to the archive.
+         */
+        static constexpr int32 DefaultFlushThreshold = 64 * 1024;
+
+        /**
+         * Create a writer that flushes its output to an archive in chunks.
+         *
+         * @param Ar The archive to write to, which must be saving and outlive the writer
+         * @param FlushThreshold The number of bytes to buffer before flushing
+         */
+        explicit FJsonStreamWriter(FArchive &Ar, int32 FlushThreshold = DefaultFlushThreshold);
+
+        /**
+         * Create a writer that appends its output to a byte buffer, which is never flushed.
+         *
+         * @param Bytes The buffer to append the UTF-8 output to, which must outlive the writer
+         */
+        explicit FJsonStreamWriter(TArray<uint8> &Bytes);
+
+        /**
+         * Flushes any buffered output to the archive.
+         */
+        ~FJsonStreamWriter();
+
+        FJsonStreamWriter(const FJsonStreamWriter &) = delete;
+        FJsonStreamWriter &operator=(const FJsonStreamWriter &) = delete;
+
+        void BeginObject();
+        void EndObject();
+        void BeginArray();
+        void EndArray();
+
+        /**
+         * Write the key of the next value in the current object.
+         *
+         * @param Key The key, which is escaped as required
+         */
+        void WriteKey(FStringView Key);
+
+        void WriteNull();
+        void WriteBool(bool bValue);
+        void WriteInt(int64 Value);
+        void WriteUInt(uint64 Value);
+
+        /**
+         * Write a float with just enough digits to round trip as a float, which keeps single precision telemetry far
+         * shorter than promoting it to double would.
+         *
+         * @param Value The value to write
+         */
+        void WriteFloat(float Value);
+        void WriteDouble(double Value);
+        void WriteString(FStringView Value);
+
+        /**
+         * Write any buffered output to the archive. This does nothing when writing to a byte buffer.
+         */
+        void Flush();
+
+      private:
+        void BeginValue() {
+            if (bNeedsComma) {
+                Output->Add(',');
+            }
+        }
+
+        void EndValue() {
+            bNeedsComma = true;
+            if (Archive != nullptr && Output->Num() >= FlushThreshold) {
+                Flush();
+            }
+        }
+
+        void Append(const ANSICHAR *Data, int32 Num) {
+            Output->Append(reinterpret_cast<const uint8 *>(Data), Num);
+        }
+
+        void AppendInteger(uint64 Magnitude, bool bNegative);
+        void AppendEscaped(FStringView String);
+
+        FArchive *Archive = nullptr;
+        TArray<uint8> *Output;
+        TArray<uint8> Buffer;
+        int32 FlushThreshold = 0;
+        int32 Depth = 0;
+        bool bNeedsComma = false;
+    };
+} // namespace Retro::Json
@@ -0,0 +1,141 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <HAL/Platform.h>
+#include <HAL/PreprocessorHelpers.h>
+#include <Misc/CoreMiscDefines.h>
+
+namespace Retro {
+
+    /**
+     * Scope that counts every call made to the global allocator by the current thread while it is active. Calls
+     * made by other threads are ignored, so the numbers are stable even while the engine is running in the
+     * background. Scopes can be nested, in which case the outer scopes also count everything seen by the inner ones.
+     *
+     * Counting relies on a forwarding proxy in front of GMalloc. It is opt-in, as every allocation in the process
+     * goes through it once installed: the module only installs it on startup when the process is run with
+     * -RetroCountAllocs, so the allocator is never swapped out underneath a running scope. Scopes opened while the
+     * proxy is not installed count nothing, so checks on the counts should be skipped unless IsProxyInstalled.
+     */
+    class RETROLIBUE_API FScopedAllocationCounter {
+      public:
+        FScopedAllocationCounter();
+
+        UE_NONCOPYABLE(FScopedAllocationCounter)
+
+        ~FScopedAllocationCounter();
+
+        /**
+         * Get the number of allocations made since the scope was opened. Reallocations count as an allocation, as
+         * they may have to move the block.
+         *
+         * @return The number of allocations
+         */
+        int64 GetNumAllocations() const {
+            return NumAllocations;
+        }
+
+        /**
+         * Get the number of frees made since the scope was opened.
+         *
+         * @return The number of frees
+         */
+        int64 GetNumFrees() const {
+            return NumFrees;
+        }
+
+        /**
+         * Get the number of bytes requested since the scope was opened.
+         *
+         * @return The number of bytes
+         */
+        int64 GetNumBytes() const {
+            return NumBytes;
+        }
+
+        /**
+         * Install the counting proxy in front of GMalloc. Called by the module on startup when allocation counting
+         * has been requested, and must be called from the game thread. Calling this more than once has no effect.
+         */
+        static void InstallProxy();
+
+        /**
+         * Check if the counting proxy has been installed, and therefore if scopes will see any allocations.
+         *
+         * @return Is allocation counting available?
+         */
+        static bool IsProxyInstalled();
+
+        /**
+         * Record an allocation against every scope active on the current thread.
+         *
+         * @param Size The number of bytes requested
+         */
+        static void RecordAllocation(SIZE_T Size);
+
+        /**
+         * Record a free against every scope active on the current thread.
+         */
+        static void RecordFree();
+
+      private:
+        FScopedAllocationCounter *Previous;
+        int64 NumAllocations = 0;
+        int64 NumFrees = 0;
+        int64 NumBytes = 0;
+    };
+
+    /**
+     * Allocation counter that enforces a maximum number of allocations for the scope. Exceeding the budget raises an
+     * ensure when the scope ends, naming the scope, so budgets on hot paths show up in automated runs without
+     * stopping the process.
+     */
+    class RETROLIBUE_API FScopedAllocationBudget : public FScopedAllocationCounter {
+      public:
+        /**
+         * Open a new budget scope.
+         *
+         * @param Name The name reported if the budget is exceeded
+         * @param MaxAllocations The maximum number of allocations allowed within the scope
+         */
+        FScopedAllocationBudget(const TCHAR *Name, int64 MaxAllocations);
+
+        ~FScopedAllocationBudget();
+
+        /**
+         * Check if the scope has stayed within its budget so far.
+         *
+         * @return Is the number of allocations within the budget
+         */
+        bool IsWithinBudget() const {
+            return GetNumAllocations() <= MaxAllocations;
+        }
+
+        /**
+         * Get the maximum number of allocations allowed within the scope.
+         *
+         * @return The allocation budget
+         */
+        int64 GetMaxAllocations() const {
+            return MaxAllocations;
+        }
+
+      private:
+        const TCHAR *Name;
+        int64 MaxAllocations;
+    };
+} // namespace Retro
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Enforce an allocation budget for the rest of the enclosing block. Compiled out of shipping builds.
+ *
+ * @param Name The name reported if the budget is exceeded
+ * @param MaxAllocations The maximum number of allocations allowed
+ */
+#define RETROLIB_ALLOCATION_BUDGET(Name, MaxAllocations)                                                               \
+    Retro::FScopedAllocationBudget PREPROCESSOR_JOIN(RetroAllocationBudget, __LINE__)(Name, MaxAllocations)
+#else
+#define RETROLIB_ALLOCATION_BUDGET(Name, MaxAllocations)
+#endif
@@ -0,0 +1,265 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Containers/ContainerAllocationPolicies.h>
+#include <HAL/UnrealMemory.h>
+
+namespace Retro {
+
+    /**
+     * Linear allocator that hands out memory by bumping a pointer through a chain of large blocks. Individual
+     * allocations are never freed; instead the arena is rewound to a previous position with an FBumpArenaMark, or
+     * cleared entirely with Reset. Blocks are kept around after a rewind so that steady-state use does not touch the
+     * global allocator at all.
+     *
+     * Each thread has its own arena accessible through Get(). The game thread arena is additionally rewound at the
+     * end of every frame as long as no marks are active on it, so allocations made on the game thread outside of a
+     * mark live until the end of the current frame.
+     */
+    class RETROLIBUE_API FBumpArena {
+      public:
+        /**
+         * The default size of each block requested from the global allocator.
+         */
+        static constexpr SIZE_T DefaultBlockSize = 64 * 1024;
+
+        /**
+         * The alignment used when the caller does not request one.
+         */
+        static constexpr SIZE_T DefaultAlignment = 16;
+
+        explicit FBumpArena(SIZE_T BlockSize = DefaultBlockSize);
+
+        UE_NONCOPYABLE(FBumpArena)
+
+        ~FBumpArena();
+
+        /**
+         * Get the arena owned by the calling thread.
+         *
+         * @return The thread's arena
+         */
+        static FBumpArena &Get();
+
+        /**
+         * Rewind the game thread arena at the end of a frame. This is skipped if there are any marks still active.
+         */
+        static void ResetFrameArena();
+
+        /**
+         * Allocate memory from the arena.
+         *
+         * @param Size The number of bytes to allocate
+         * @param Alignment The alignment of the allocation
+         * @return The allocated memory
+         */
+        void *Allocate(SIZE_T Size, SIZE_T Alignment = DefaultAlignment);
+
+        /**
+         * Resize an allocation previously made by this arena. If it was the most recent allocation and there is room
+         * left in the block it grows in place, otherwise the contents are copied into a new allocation.
+         *
+         * @param Original The allocation to resize, may be null
+         * @param OldSize The current size of the allocation in bytes
+         * @param NewSize The requested size in bytes
+         * @param Alignment The alignment of the allocation
+         * @return The resized allocation
+         */
+        void *Reallocate(void *Original, SIZE_T OldSize, SIZE_T NewSize, SIZE_T Alignment = DefaultAlignment);
+
+        /**
+         * Rewind the arena back to the start, keeping all blocks for reuse.
+         */
+        void Reset();
+
+        /**
+         * Release all blocks that are not currently in use back to the global allocator.
+         */
+        void Trim();
+
+        /**
+         * Get the number of marks currently active on this arena.
+         *
+         * @return The number of active marks
+         */
+        int32 GetNumMarks() const {
+            return NumMarks;
+        }
+
+        /**
+         * Get the total number of bytes reserved from the global allocator.
+         *
+         * @return The reserved size in bytes
+         */
+        SIZE_T GetReservedSize() const;
+
+      private:
+        friend class FBumpArenaMark;
+
+        struct FBlock {
+            FBlock *Next;
+            SIZE_T Size;
+
+            uint8 *GetData() {
+                return reinterpret_cast<uint8 *>(this + 1);
+            }
+        };
+
+        void AdvanceBlock(SIZE_T Size, SIZE_T Alignment);
+
+        void Rewind(FBlock *Block, uint8 *Position);
+
+        SIZE_T BlockSize;
+        FBlock *FirstBlock = nullptr;
+        FBlock *CurrentBlock = nullptr;
+        uint8 *Top = nullptr;
+        uint8 *End = nullptr;
+        int32 NumMarks = 0;
+    };
+
+    /**
+     * Scope that records the current position of an arena and rewinds back to it when destroyed, releasing every
+     * allocation made within the scope. Works the same way as FMemMark does for FMemStack.
+     */
+    class RETROLIBUE_API FBumpArenaMark {
+      public:
+        explicit FBumpArenaMark(FBumpArena &Arena = FBumpArena::Get());
+
+        UE_NONCOPYABLE(FBumpArenaMark)
+
+        ~FBumpArenaMark();
+
+        /**
+         * Rewind the arena early. Calling this more than once has no effect.
+         */
+        void Pop();
+
+      private:
+        FBumpArena &Arena;
+        FBumpArena::FBlock *SavedBlock;
+        uint8 *SavedTop;
+        bool bPopped = false;
+    };
+
+    /**
+     * Container allocator policy that takes its memory from the calling thread's FBumpArena. Containers using this
+     * allocator must not outlive the FBumpArenaMark (or frame) they were filled in, and must be destroyed on the
+     * thread that created them.
+     *
+     * @tparam Alignment The minimum alignment of the allocation
+     */
+    template <uint32 Alignment = DEFAULT_ALIGNMENT>
+    class TBumpArenaAllocator {
+      public:
+        using SizeType = int32;
+
+        enum { NeedsElementType = true };
+
+        enum { RequireRangeCheck = true };
+
+        class ForAnyElementType {
+          public:
+            ForAnyElementType() = default;
+
+            UE_NONCOPYABLE(ForAnyElementType)
+
+            void MoveToEmpty(ForAnyElementType &Other) {
+                checkSlow(this != &Other);
+                Data = Other.Data;
+                AllocatedBytes = Other.AllocatedBytes;
+                Other.Data = nullptr;
+                Other.AllocatedBytes = 0;
+            }
+
+            FScriptContainerElement *GetAllocation() const {
+                return Data;
+            }
+
+            void ResizeAllocation(SizeType PreviousNumElements, SizeType NumElements, SIZE_T NumBytesPerElement) {
+                ResizeAllocation(PreviousNumElements, NumElements, NumBytesPerElement,
+                                 static_cast<uint32>(FBumpArena::DefaultAlignment));
+            }
+
+            void ResizeAllocation(SizeType PreviousNumElements, SizeType NumElements, SIZE_T NumBytesPerElement,
+                                  uint32 AlignmentOfElement) {
+                SIZE_T NewBytes = static_cast<SIZE_T>(NumElements) * NumBytesPerElement;
+                if (NewBytes == 0) {
+                    Data = nullptr;
+                    AllocatedBytes = 0;
+                    return;
+                }
+
+                SIZE_T EffectiveAlignment = FMath::Max<SIZE_T>(Alignment, AlignmentOfElement);
+                Data = static_cast<FScriptContainerElement *>(
+                    FBumpArena::Get().Reallocate(Data, AllocatedBytes, NewBytes, EffectiveAlignment));
+                AllocatedBytes = NewBytes;
+            }
+
+            SizeType CalculateSlackReserve(SizeType NumElements, SIZE_T NumBytesPerElement) const {
+                return DefaultCalculateSlackReserve(NumElements, NumBytesPerElement, false, Alignment);
+            }
+
+            SizeType CalculateSlackReserve(SizeType NumElements, SIZE_T NumBytesPerElement,
+                                           uint32 AlignmentOfElement) const {
+                return DefaultCalculateSlackReserve(NumElements, NumBytesPerElement, false,
+                                                    FMath::Max<uint32>(Alignment, AlignmentOfElement));
+            }
+
+            SizeType CalculateSlackShrink(SizeType NumElements, SizeType NumAllocatedElements,
+                                          SIZE_T NumBytesPerElement) const {
+                return DefaultCalculateSlackShrink(NumElements, NumAllocatedElements, NumBytesPerElement, false,
+                                                   Alignment);
+            }
+
+            SizeType CalculateSlackShrink(SizeType NumElements, SizeType NumAllocatedElements,
+                                          SIZE_T NumBytesPerElement, uint32 AlignmentOfElement) const {
+                return DefaultCalculateSlackShrink(NumElements, NumAllocatedElements, NumBytesPerElement, false,
+                                                   FMath::Max<uint32>(Alignment, AlignmentOfElement));
+            }
+
+            SizeType CalculateSlackGrow(SizeType NumElements, SizeType NumAllocatedElements,
+                                        SIZE_T NumBytesPerElement) const {
+                return DefaultCalculateSlackGrow(NumElements, NumAllocatedElements, NumBytesPerElement, false,
+                                                 Alignment);
+            }
+
+            SizeType CalculateSlackGrow(SizeType NumElements, SizeType NumAllocatedElements,
+                                        SIZE_T NumBytesPerElement, uint32 AlignmentOfElement) const {
+                return DefaultCalculateSlackGrow(NumElements, NumAllocatedElements, NumBytesPerElement, false,
+                                                 FMath::Max<uint32>(Alignment, AlignmentOfElement));
+            }
+
+            SIZE_T GetAllocatedSize(SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const {
+                return NumAllocatedElements * NumBytesPerElement;
+            }
+
+            bool HasAllocation() const {
+                return Data != nullptr;
+            }
+
+            SizeType GetInitialCapacity() const {
+                return 0;
+            }
+
+          private:
+            FScriptContainerElement *Data = nullptr;
+            SIZE_T AllocatedBytes = 0;
+        };
+
+        template <typename ElementType>
+        class ForElementType : public ForAnyElementType {
+          public:
+            ElementType *GetAllocation() const {
+                return reinterpret_cast<ElementType *>(ForAnyElementType::GetAllocation());
+            }
+        };
+    };
+} // namespace Retro
+
+template <uint32 Alignment>
+struct TAllocatorTraits<Retro::TBumpArenaAllocator<Alignment>>
+    : TAllocatorTraitsBase<Retro::TBumpArenaAllocator<Alignment>> {
+    enum { SupportsMove = true };
+    enum { SupportsElementAlignment = true };
+};
@@ -0,0 +1,610 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Optionals/Compatiblity/UnrealOptional.h"
+
+#include <Containers/Array.h>
+#include <Containers/BitArray.h>
+#include <Templates/TypeCompatibleBytes.h>
+#include <UObject/ObjectPtr.h>
+
+namespace Retro::Optionals {
+
+    /**
+     * Trait used to describe types that have a spare value that can be used to represent an empty optional. Types
+     * that specialize this trait are stored in a TOptionalColumn without a presence mask. A specialization must
+     * provide a static GetEmptyValue() and IsEmpty(const T&).
+     *
+     * @tparam T The type being described
+     */
+    template <typename T>
+    struct TOptionalNiche {
+        static constexpr bool bHasNiche = false;
+    };
+
+    /**
+     * Helper for specializing TOptionalNiche for types that reserve a single sentinel value, such as INDEX_NONE
+     * for indices.
+     *
+     * @tparam T The type being described
+     * @tparam Sentinel The value that represents an empty optional
+     */
+    template <typename T, T Sentinel>
+    struct TSentinelOptionalNiche {
+        static constexpr bool bHasNiche = true;
+
+        static constexpr T GetEmptyValue() {
+            return Sentinel;
+        }
+
+        static constexpr bool IsEmpty(const T &Value) {
+            return Value == Sentinel;
+        }
+    };
+
+    template <typename T>
+    struct TOptionalNiche<T *> : TSentinelOptionalNiche<T *, nullptr> {};
+
+    template <typename T>
+    struct TOptionalNiche<TObjectPtr<T>> {
+        static constexpr bool bHasNiche = true;
+
+        static TObjectPtr<T> GetEmptyValue() {
+            return nullptr;
+        }
+
+        static bool IsEmpty(const TObjectPtr<T> &Value) {
+            return Value == nullptr;
+        }
+    };
+
+    /**
+     * Checks if a type has a niche value that can be used to represent an empty optional.
+     *
+     * @tparam T The type to check
+     */
+    template <typename T>
+    concept HasOptionalNiche = TOptionalNiche<T>::bHasNiche;
+
+    /**
+     * Container of optional values that stores the values densely and tracks which entries are set separately. For
+     * most types this means a TBitArray alongside an array of uninitialized storage, which removes the padding that
+     * a TArray<TOptional<T>> pays for the bool on every element. Types that specialize TOptionalNiche are stored
+     * as-is, using their empty value to mark the unset entries.
+     *
+     * Iterating the container directly yields a TOptional<T&> for every entry, set or not. To only visit the set
+     * entries use GetSetValues(), which skips over the empty entries 32 at a time using the presence mask.
+     *
+     * @tparam T The type of value stored
+     */
+    template <typename T>
+    class TOptionalColumn {
+        static constexpr bool bUsesNiche = HasOptionalNiche<T>;
+        using FNiche = TOptionalNiche<T>;
+        using FStorageType = std::conditional_t<bUsesNiche, T, TTypeCompatibleBytes<T>>;
+
+        struct FNoPresenceMask {};
+        using FPresenceMask = std::conditional_t<bUsesNiche, FNoPresenceMask, TBitArray<>>;
+
+        static constexpr int32 BitsPerWord = NumBitsPerDWORD;
+
+      public:
+        using ElementType = T;
+
+        template <bool bConst>
+        class TEntryIterator {
+            using FOwner = std::conditional_t<bConst, const TOptionalColumn, TOptionalColumn>;
+            using FReference = std::conditional_t<bConst, const T &, T &>;
+
+          public:
+            using value_type = TOptional<FReference>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+
+            TEntryIterator() = default;
+
+            TEntryIterator(FOwner &Owner, int32 Index) : Owner(&Owner), Index(Index) {
+            }
+
+            value_type operator*() const {
+                return (*Owner)[Index];
+            }
+
+            value_type operator[](difference_type Offset) const {
+                return (*Owner)[Index + static_cast<int32>(Offset)];
+            }
+
+            TEntryIterator &operator++() {
+                ++Index;
+                return *this;
+            }
+
+            TEntryIterator operator++(int) {
+                auto Copy = *this;
+                ++Index;
+                return Copy;
+            }
+
+            TEntryIterator &operator--() {
+                --Index;
+                return *this;
+            }
+
+            TEntryIterator operator--(int) {
+                auto Copy = *this;
+                --Index;
+                return Copy;
+            }
+
+            TEntryIterator &operator+=(difference_type Offset) {
+                Index += static_cast<int32>(Offset);
+                return *this;
+            }
+
+            TEntryIterator &operator-=(difference_type Offset) {
+                Index -= static_cast<int32>(Offset);
+                return *this;
+            }
+
+            friend TEntryIterator operator+(TEntryIterator Iterator, difference_type Offset) {
+                return Iterator += Offset;
+            }
+
+            friend TEntryIterator operator+(difference_type Offset, TEntryIterator Iterator) {
+                return Iterator += Offset;
+            }
+
+            friend TEntryIterator operator-(TEntryIterator Iterator, difference_type Offset) {
+                return Iterator -= Offset;
+            }
+
+            friend difference_type operator-(const TEntryIterator &LHS, const TEntryIterator &RHS) {
+                return LHS.Index - RHS.Index;
+            }
+
+            friend bool operator==(const TEntryIterator &LHS, const TEntryIterator &RHS) {
+                return LHS.Index == RHS.Index;
+            }
+
+            friend auto operator<=>(const TEntryIterator &LHS, const TEntryIterator &RHS) {
+                return LHS.Index <=> RHS.Index;
+            }
+
+          private:
+            FOwner *Owner = nullptr;
+            int32 Index = 0;
+        };
+
+        /**
+         * Iterator that only visits the entries of the column that are set. Empty entries are skipped a whole word
+         * of the presence mask at a time.
+         *
+         * @tparam bConst Is the column being iterated const
+         */
+        template <bool bConst>
+        class TSetValueIterator {
+            using FOwner = std::conditional_t<bConst, const TOptionalColumn, TOptionalColumn>;
+
+          public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<bConst, const T &, T &>;
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+
+            TSetValueIterator() = default;
+
+            explicit TSetValueIterator(FOwner &Owner) : Owner(&Owner) {
+                if constexpr (bUsesNiche) {
+                    Index = -1;
+                    AdvanceNiche();
+                } else {
+                    NumWords = FMath::DivideAndRoundUp(Owner.Num(), BitsPerWord);
+                    WordIndex = -1;
+                    CurrentWord = 0;
+                    AdvanceWord();
+                }
+            }
+
+            reference operator*() const {
+                return Owner->GetValueUnchecked(GetIndex());
+            }
+
+            auto operator->() const {
+                return &**this;
+            }
+
+            TSetValueIterator &operator++() {
+                if constexpr (bUsesNiche) {
+                    AdvanceNiche();
+                } else {
+                    CurrentWord &= CurrentWord - 1;
+                    if (CurrentWord == 0) {
+                        AdvanceWord();
+                    }
+                }
+                return *this;
+            }
+
+            TSetValueIterator operator++(int) {
+                auto Copy = *this;
+                ++*this;
+                return Copy;
+            }
+
+            /**
+             * Get the index within the column of the entry currently pointed to.
+             *
+             * @return The index of the entry
+             */
+            int32 GetIndex() const {
+                if constexpr (bUsesNiche) {
+                    return Index;
+                } else {
+                    return WordIndex * BitsPerWord + static_cast<int32>(FMath::CountTrailingZeros(CurrentWord));
+                }
+            }
+
+            friend bool operator==(const TSetValueIterator &LHS, const TSetValueIterator &RHS) {
+                if constexpr (bUsesNiche) {
+                    return LHS.Index == RHS.Index;
+                } else {
+                    return LHS.WordIndex == RHS.WordIndex && LHS.CurrentWord == RHS.CurrentWord;
+                }
+            }
+
+            friend bool operator==(const TSetValueIterator &Iterator, std::default_sentinel_t) {
+                if constexpr (bUsesNiche) {
+                    return Iterator.Index >= Iterator.Owner->Num();
+                } else {
+                    return Iterator.WordIndex >= Iterator.NumWords;
+                }
+            }
+
+          private:
+            void AdvanceNiche() {
+                int32 Num = Owner->Num();
+                do {
+                    ++Index;
+                } while (Index < Num && FNiche::IsEmpty(Owner->Values[Index]));
+            }
+
+            void AdvanceWord() {
+                const uint32 *Words = Owner->Presence.GetData();
+                while (++WordIndex < NumWords) {
+                    CurrentWord = Words[WordIndex];
+                    if (CurrentWord != 0) {
+                        return;
+                    }
+                }
+                CurrentWord = 0;
+            }
+
+            FOwner *Owner = nullptr;
+            int32 Index = 0;
+            int32 WordIndex = 0;
+            int32 NumWords = 0;
+            uint32 CurrentWord = 0;
+        };
+
+        using FIterator = TEntryIterator<false>;
+        using FConstIterator = TEntryIterator<true>;
+
+        TOptionalColumn() = default;
+
+        /**
+         * Construct a column from a list of optionals.
+         *
+         * @param Entries The entries to add
+         */
+        TOptionalColumn(std::initializer_list<TOptional<T>> Entries) {
+            Reserve(static_cast<int32>(Entries.size()));
+            for (const TOptional<T> &Entry : Entries) {
+                if (Entry.IsSet()) {
+                    Add(Entry.GetValue());
+                } else {
+                    AddUnset();
+                }
+            }
+        }
+
+        TOptionalColumn(const TOptionalColumn &Other) : Presence(Other.Presence) {
+            if constexpr (bUsesNiche) {
+                Values = Other.Values;
+            } else {
+                Values.SetNumUninitialized(Other.Num());
+                for (auto It = Other.GetSetValues().begin(); It != std::default_sentinel; ++It) {
+                    new (Values[It.GetIndex()].GetTypedPtr()) T(*It);
+                }
+            }
+        }
+
+        TOptionalColumn(TOptionalColumn &&Other) noexcept
+            : Values(MoveTemp(Other.Values)), Presence(MoveTemp(Other.Presence)) {
+            Other.Values.Reset();
+            if constexpr (!bUsesNiche) {
+                Other.Presence.Reset();
+            }
+        }
+
+        ~TOptionalColumn() {
+            DestroyValues();
+        }
+
+        TOptionalColumn &operator=(const TOptionalColumn &Other) {
+            if (this != &Other) {
+                TOptionalColumn Copy(Other);
+                *this = MoveTemp(Copy);
+            }
+            return *this;
+        }
+
+        TOptionalColumn &operator=(TOptionalColumn &&Other) noexcept {
+            if (this != &Other) {
+                DestroyValues();
+                Values = MoveTemp(Other.Values);
+                Presence = MoveTemp(Other.Presence);
+                Other.Values.Reset();
+                if constexpr (!bUsesNiche) {
+                    Other.Presence.Reset();
+                }
+            }
+            return *this;
+        }
+
+        /**
+         * Get the number of entries in the column, set or not.
+         *
+         * @return The number of entries
+         */
+        int32 Num() const {
+            return Values.Num();
+        }
+
+        /**
+         * Count the number of entries that are set.
+         *
+         * @return The number of set entries
+         */
+        int32 NumSet() const {
+            if constexpr (bUsesNiche) {
+                int32 Result = 0;
+                for (const T &Value : Values) {
+                    Result += FNiche::IsEmpty(Value) ? 0 : 1;
+                }
+                return Result;
+            } else {
+                const uint32 *Words = Presence.GetData();
+                int32 NumWords = FMath::DivideAndRoundUp(Num(), BitsPerWord);
+                int32 Result = 0;
+                for (int32 i = 0; i < NumWords; i++) {
+                    Result += static_cast<int32>(FMath::CountBits(Words[i]));
+                }
+                return Result;
+            }
+        }
+
+        /**
+         * Check if the entry at the given index is set.
+         *
+         * @param Index The index of the entry
+         * @return Is the entry set
+         */
+        bool IsSet(int32 Index) const {
+            check(Values.IsValidIndex(Index));
+            if constexpr (bUsesNiche) {
+                return !FNiche::IsEmpty(Values[Index]);
+            } else {
+                return Presence[Index];
+            }
+        }
+
+        /**
+         * Get the entry at the given index.
+         *
+         * @param Index The index of the entry
+         * @return An optional referencing the value, or an empty optional if the entry is not set
+         */
+        TOptional<T &> operator[](int32 Index) {
+            return IsSet(Index) ? TOptional<T &>(GetValueUnchecked(Index)) : TOptional<T &>();
+        }
+
+        /**
+         * Get the entry at the given index.
+         *
+         * @param Index The index of the entry
+         * @return An optional referencing the value, or an empty optional if the entry is not set
+         */
+        TOptional<const T &> operator[](int32 Index) const {
+            return IsSet(Index) ? TOptional<const T &>(GetValueUnchecked(Index)) : TOptional<const T &>();
+        }
+
+        /**
+         * Reserve space for a number of entries.
+         *
+         * @param Number The number of entries to reserve space for
+         */
+        void Reserve(int32 Number) {
+            Values.Reserve(Number);
+            if constexpr (!bUsesNiche) {
+                Presence.Reserve(Number);
+            }
+        }
+
+        /**
+         * Add a new set entry to the end of the column.
+         *
+         * @tparam A The types of the constructor arguments
+         * @param Args The arguments to construct the value from
+         * @return The index of the new entry
+         */
+        template <typename... A>
+            requires std::constructible_from<T, A...>
+        int32 Add(A &&...Args) {
+            if constexpr (bUsesNiche) {
+                int32 Index = Values.Emplace(std::forward<A>(Args)...);
+                check(!FNiche::IsEmpty(Values[Index]));
+                return Index;
+            } else {
+                int32 Index = Values.AddUninitialized();
+                new (Values[Index].GetTypedPtr()) T(std::forward<A>(Args)...);
+                Presence.Add(true);
+                return Index;
+            }
+        }
+
+        /**
+         * Add a new empty entry to the end of the column.
+         *
+         * @return The index of the new entry
+         */
+        int32 AddUnset() {
+            if constexpr (bUsesNiche) {
+                return Values.Add(FNiche::GetEmptyValue());
+            } else {
+                Presence.Add(false);
+                return Values.AddUninitialized();
+            }
+        }
+
+        /**
+         * Resize the column. New entries are added unset, and any values in the removed entries are destroyed.
+         *
+         * @param NewNum The new number of entries
+         */
+        void SetNum(int32 NewNum) {
+            for (int32 i = NewNum; i < Num(); i++) {
+                Unset(i);
+            }
+
+            if constexpr (bUsesNiche) {
+                int32 OldNum = Num();
+                Values.SetNumUninitialized(NewNum);
+                for (int32 i = OldNum; i < NewNum; i++) {
+                    new (&Values[i]) T(FNiche::GetEmptyValue());
+                }
+            } else {
+                Values.SetNumUninitialized(NewNum);
+                Presence.SetNum(NewNum, false);
+            }
+        }
+
+        /**
+         * Set the value of an existing entry, replacing the old value if there is one.
+         *
+         * @tparam A The types of the constructor arguments
+         * @param Index The index of the entry
+         * @param Args The arguments to construct the value from
+         * @return A reference to the new value
+         */
+        template <typename... A>
+            requires std::constructible_from<T, A...>
+        T &Emplace(int32 Index, A &&...Args) {
+            Unset(Index);
+            if constexpr (bUsesNiche) {
+                Values[Index] = T(std::forward<A>(Args)...);
+                check(!FNiche::IsEmpty(Values[Index]));
+            } else {
+                new (Values[Index].GetTypedPtr()) T(std::forward<A>(Args)...);
+                Presence[Index] = true;
+            }
+
+            return GetValueUnchecked(Index);
+        }
+
+        /**
+         * Clear the entry at the given index, destroying the value if there is one.
+         *
+         * @param Index The index of the entry
+         */
+        void Unset(int32 Index) {
+            if (!IsSet(Index)) {
+                return;
+            }
+
+            if constexpr (bUsesNiche) {
+                Values[Index] = FNiche::GetEmptyValue();
+            } else {
+                DestructItem(Values[Index].GetTypedPtr());
+                Presence[Index] = false;
+            }
+        }
+
+        /**
+         * Remove all entries from the column.
+         */
+        void Empty() {
+            DestroyValues();
+            Values.Empty();
+            if constexpr (!bUsesNiche) {
+                Presence.Empty();
+            }
+        }
+
+        /**
+         * Get a range over only the set values of the column, skipping the unset entries. The index of each entry
+         * can be retrieved from the iterator with GetIndex().
+         *
+         * @return The range of set values
+         */
+        auto GetSetValues() {
+            return std::ranges::subrange(TSetValueIterator<false>(*this), std::default_sentinel);
+        }
+
+        /**
+         * Get a range over only the set values of the column, skipping the unset entries. The index of each entry
+         * can be retrieved from the iterator with GetIndex().
+         *
+         * @return The range of set values
+         */
+        auto GetSetValues() const {
+            return std::ranges::subrange(TSetValueIterator<true>(*this), std::default_sentinel);
+        }
+
+        FIterator begin() {
+            return FIterator(*this, 0);
+        }
+
+        FIterator end() {
+            return FIterator(*this, Num());
+        }
+
+        FConstIterator begin() const {
+            return FConstIterator(*this, 0);
+        }
+
+        FConstIterator end() const {
+            return FConstIterator(*this, Num());
+        }
+
+      private:
+        T &GetValueUnchecked(int32 Index) {
+            if constexpr (bUsesNiche) {
+                return Values[Index];
+            } else {
+                return *Values[Index].GetTypedPtr();
+            }
+        }
+
+        const T &GetValueUnchecked(int32 Index) const {
+            if constexpr (bUsesNiche) {
+                return Values[Index];
+            } else {
+                return *Values[Index].GetTypedPtr();
+            }
+        }
+
+        void DestroyValues() {
+            if constexpr (!bUsesNiche && !std::is_trivially_destructible_v<T>) {
+                for (auto It = GetSetValues().begin(); It != std::default_sentinel; ++It) {
+                    DestructItem(&*It);
+                }
+            }
+        }
+
+        TArray<FStorageType> Values;
+        FPresenceMask Presence;
+    };
+} // namespace Retro::Optionals
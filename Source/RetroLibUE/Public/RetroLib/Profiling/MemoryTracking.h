@@ -0,0 +1,17 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <HAL/LowLevelMemTracker.h>
+
+/**
+ * Low-level memory tracker tag that every allocation made by Retro conversions and delegate factories is attributed
+ * to. Shows up as RetroLib in the LLM reports when running with -llm.
+ */
+LLM_DECLARE_TAG_API(RetroLib, RETROLIBUE_API);
+
+/**
+ * Attribute all allocations for the rest of the enclosing block to the RetroLib LLM tag. Expands to nothing when LLM
+ * is compiled out.
+ */
+#define RETROLIB_LLM_SCOPE() LLM_SCOPE_BYTAG(RetroLib)
@@ -0,0 +1,123 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <ProfilingDebugging/CountersTrace.h>
+#include <ProfilingDebugging/CpuProfilerTrace.h>
+#include <Trace/Trace.h>
+
+#include <utility>
+
+#ifndef RETROLIB_WITH_TRACE
+#define RETROLIB_WITH_TRACE 0
+#endif
+
+/**
+ * Whether the Retro instrumentation is compiled in. When this is zero every macro in this file expands to nothing
+ * and the traced types carry no extra state. When it is one, the events are still only emitted if the RetroLib trace
+ * channel is enabled at runtime, e.g. with -trace=cpu,retrolib.
+ */
+#define RETROLIB_TRACE_ENABLED (RETROLIB_WITH_TRACE && CPUPROFILERTRACE_ENABLED)
+
+#if RETROLIB_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(RetroLibChannel, RETROLIBUE_API);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(RetroLib_ElementsVisited);
+TRACE_DECLARE_INT_COUNTER_EXTERN(RetroLib_ElementsFiltered);
+TRACE_DECLARE_INT_COUNTER_EXTERN(RetroLib_BytesAllocated);
+
+namespace Retro::Trace {
+
+    /**
+     * Element counts that are owned by an iterator rather than a block, so that the whole enumeration of a view is
+     * reported in one go. The counts are accumulated locally and written to the trace counters either explicitly once
+     * the iterator reaches the end of the view, or when the iterator is destroyed, whichever comes first.
+     *
+     * This deliberately emits no CPU profiler event. Those have to nest strictly on each thread, and an iterator can
+     * outlive the scopes around it or be interleaved with another one, e.g. when it is stashed inside a cache or a
+     * type-erased view. Timing belongs to the block scope of whatever operation drives the iteration.
+     */
+    class FEnumerationCounters {
+      public:
+        FEnumerationCounters() : bActive(UE_TRACE_CHANNELEXPR_IS_ENABLED(RetroLibChannel)) {
+        }
+
+        FEnumerationCounters(const FEnumerationCounters &) = delete;
+
+        FEnumerationCounters(FEnumerationCounters &&Other) noexcept
+            : bActive(std::exchange(Other.bActive, false)), NumVisited(std::exchange(Other.NumVisited, 0)),
+              NumFiltered(std::exchange(Other.NumFiltered, 0)) {
+        }
+
+        ~FEnumerationCounters() {
+            End();
+        }
+
+        FEnumerationCounters &operator=(const FEnumerationCounters &) = delete;
+
+        FEnumerationCounters &operator=(FEnumerationCounters &&Other) noexcept {
+            if (this != &Other) {
+                End();
+                bActive = std::exchange(Other.bActive, false);
+                NumVisited = std::exchange(Other.NumVisited, 0);
+                NumFiltered = std::exchange(Other.NumFiltered, 0);
+            }
+            return *this;
+        }
+
+        /**
+         * Record that an element was produced by the view.
+         */
+        void Visit() {
+            NumVisited++;
+        }
+
+        /**
+         * Record that an element was skipped by the view.
+         */
+        void Filter() {
+            NumFiltered++;
+        }
+
+        /**
+         * Write the counts out early. Calling this more than once has no effect.
+         */
+        void End() {
+            if (!bActive) {
+                return;
+            }
+
+            TRACE_COUNTER_ADD(RetroLib_ElementsVisited, NumVisited);
+            TRACE_COUNTER_ADD(RetroLib_ElementsFiltered, NumFiltered);
+            bActive = false;
+        }
+
+      private:
+        bool bActive;
+        int64 NumVisited = 0;
+        int64 NumFiltered = 0;
+    };
+} // namespace Retro::Trace
+
+/**
+ * Emit a CPU profiler event on the RetroLib channel for the rest of the enclosing block.
+ *
+ * @param Name The static name of the event
+ */
+#define RETROLIB_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, RetroLibChannel)
+
+/**
+ * Add a value to one of the RetroLib trace counters.
+ *
+ * @param Counter The name of the counter, one of ElementsVisited, ElementsFiltered or BytesAllocated
+ * @param Amount The value to add
+ */
+#define RETROLIB_TRACE_COUNTER_ADD(Counter, Amount) TRACE_COUNTER_ADD(RetroLib_##Counter, Amount)
+
+#else
+
+#define RETROLIB_TRACE_SCOPE(Name)
+#define RETROLIB_TRACE_COUNTER_ADD(Counter, Amount)
+
+#endif
@@ -0,0 +1,419 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Containers/GroupedArray.h"
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+#include "RetroLib/Ranges/Concepts/SizeHint.h"
+
+#include <Async/ParallelFor.h>
+#include <Containers/Map.h>
+
+#include <functional>
+#include <ranges>
+#include <type_traits>
+
+namespace Retro::Ranges {
+
+    /**
+     * How a grouping operation should process its input.
+     */
+    enum class EGroupingMode : uint8 {
+        /**
+         * Group on the calling thread. Groups are ordered by the first appearance of their key.
+         */
+        Sequential,
+
+        /**
+         * Partition the input by the hash of each key and group the partitions on the task graph. The key selector,
+         * and the fold of AggregateBy, are called from several threads at once and must not touch shared state. Groups
+         * are ordered by partition and then by first appearance, which is deterministic but not the sequential order.
+         */
+        Parallel
+    };
+
+    /**
+     * Below this many elements the parallel mode groups sequentially, as the fixed cost of partitioning outweighs the
+     * work being split.
+     */
+    constexpr int32 ParallelGroupingThreshold = 16 * 1024;
+
+    namespace Private {
+        template <typename R, typename F>
+        using TGroupKey = std::decay_t<std::invoke_result_t<F &, std::ranges::range_reference_t<R>>>;
+
+        constexpr int32 GroupingPartitionBits = 4;
+        constexpr int32 NumGroupingPartitions = 1 << GroupingPartitionBits;
+
+        /**
+         * GetTypeHash is the identity for integers and enums, so take the partition from the high bits of a
+         * multiplicative hash rather than the low bits of the raw one.
+         */
+        constexpr int32 GetGroupingPartition(uint32 Hash) {
+            return static_cast<int32>((Hash * 0x9E3779B9u) >> (32 - GroupingPartitionBits));
+        }
+
+        /**
+         * The indices of the elements of a random access range, bucketed by the hash of their key. Every key lands in
+         * exactly one partition and the indices keep their input order within it, so the partitions can be grouped
+         * independently and the result does not depend on how the work was scheduled.
+         */
+        struct FHashPartitions {
+            TArray<uint32> Hashes;
+            TArray<int32> Indices;
+            int32 Starts[NumGroupingPartitions + 1];
+        };
+
+        template <std::ranges::random_access_range R, typename F>
+        FHashPartitions PartitionByKeyHash(R &Range, F &KeySelector) {
+            auto First = std::ranges::begin(Range);
+            int32 Num = static_cast<int32>(std::ranges::size(Range));
+            int32 SliceSize = (Num + NumGroupingPartitions - 1) / NumGroupingPartitions;
+
+            FHashPartitions Result;
+            Result.Hashes.SetNumUninitialized(Num);
+            Result.Indices.SetNumUninitialized(Num);
+            RETROLIB_TRACE_COUNTER_ADD(BytesAllocated,
+                                       Result.Hashes.GetAllocatedSize() + Result.Indices.GetAllocatedSize());
+
+            // Each slice of the input counts how many of its elements fall in each partition
+            int32 Counts[NumGroupingPartitions][NumGroupingPartitions] = {};
+            ParallelFor(NumGroupingPartitions, [&](int32 Slice) {
+                int32 End = FMath::Min(Num, (Slice + 1) * SliceSize);
+                for (int32 i = FMath::Min(Num, Slice * SliceSize); i < End; i++) {
+                    uint32 Hash = GetTypeHash(std::invoke(KeySelector, First[i]));
+                    Result.Hashes[i] = Hash;
+                    Counts[Slice][GetGroupingPartition(Hash)]++;
+                }
+            });
+
+            // Turn the counts into write positions, partition major, so that every slice scatters its share of a
+            // partition right after the share of the slice before it
+            int32 Total = 0;
+            for (int32 Partition = 0; Partition < NumGroupingPartitions; Partition++) {
+                Result.Starts[Partition] = Total;
+                for (int32 Slice = 0; Slice < NumGroupingPartitions; Slice++) {
+                    int32 Count = Counts[Slice][Partition];
+                    Counts[Slice][Partition] = Total;
+                    Total += Count;
+                }
+            }
+            Result.Starts[NumGroupingPartitions] = Total;
+
+            ParallelFor(NumGroupingPartitions, [&](int32 Slice) {
+                int32 End = FMath::Min(Num, (Slice + 1) * SliceSize);
+                for (int32 i = FMath::Min(Num, Slice * SliceSize); i < End; i++) {
+                    Result.Indices[Counts[Slice][GetGroupingPartition(Result.Hashes[i])]++] = i;
+                }
+            });
+
+            return Result;
+        }
+
+        /**
+         * Apply a fold to an accumulator. Folds that return nothing update the accumulator in place, and anything
+         * else is assigned back to it.
+         */
+        template <typename T, typename F, typename E>
+        void ApplyFold(T &Accumulator, F &Fold, E &&Element) {
+            if constexpr (std::is_void_v<std::invoke_result_t<F &, T &, E>>) {
+                std::invoke(Fold, Accumulator, std::forward<E>(Element));
+            } else {
+                Accumulator = std::invoke(Fold, MoveTemp(Accumulator), std::forward<E>(Element));
+            }
+        }
+    } // namespace Private
+
+    template <typename A>
+    struct TGroupByInvoker {
+        template <std::ranges::input_range R, typename F>
+            requires std::invocable<F &, std::ranges::range_reference_t<R>>
+        auto operator()(R &&Range, F KeySelector, EGroupingMode Mode = EGroupingMode::Sequential) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::GroupBy"));
+            RETROLIB_LLM_SCOPE();
+            using FKey = Private::TGroupKey<R, F>;
+            using FValue = std::ranges::range_value_t<R>;
+
+            if (Mode == EGroupingMode::Parallel) {
+                if constexpr (std::ranges::random_access_range<R> && std::ranges::sized_range<R>) {
+                    if (static_cast<int32>(std::ranges::size(Range)) >= ParallelGroupingThreshold) {
+                        return GroupParallel<FKey, FValue>(Range, KeySelector);
+                    }
+                } else {
+                    TArray<FValue, A> Elements;
+                    if (int32 SizeHint = GetSizeHint(Range); SizeHint > 0) {
+                        Elements.Reserve(SizeHint);
+                    }
+
+                    for (auto &&Element : Range) {
+                        Elements.Emplace(std::forward<decltype(Element)>(Element));
+                    }
+                    return (*this)(Elements, MoveTemp(KeySelector), Mode);
+                }
+            }
+
+            return GroupSequential<FKey, FValue>(std::forward<R>(Range), KeySelector);
+        }
+
+      private:
+        template <typename K, typename V, typename R, typename F>
+        static TGroupedArray<K, V, A> GroupSequential(R &&Range, F &KeySelector) {
+            // Values are staged in input order alongside the group they belong to, then relocated bitwise into their
+            // group's slice once the size of every group is known
+            TMap<K, int32> GroupIndices;
+            TArray<K, A> Keys;
+            TArray<int32, A> Offsets;
+            TArray<int32, A> GroupOf;
+            TArray<TTypeCompatibleBytes<V>, A> Staging;
+            if (int32 SizeHint = GetSizeHint(Range); SizeHint > 0) {
+                // There can be no more groups than elements, and the excess is given back once the groups are known
+                GroupIndices.Reserve(SizeHint);
+                GroupOf.Reserve(SizeHint);
+                Staging.Reserve(SizeHint);
+            }
+
+            for (auto &&Element : Range) {
+                K Key = std::invoke(KeySelector, Element);
+                uint32 Hash = GetTypeHash(Key);
+                int32 *Group = GroupIndices.FindByHash(Hash, Key);
+                if (Group == nullptr) {
+                    Group = &GroupIndices.AddByHash(Hash, Key, Keys.Num());
+                    Keys.Emplace(MoveTemp(Key));
+                    Offsets.Add(0);
+                }
+
+                Offsets[*Group]++;
+                GroupOf.Add(*Group);
+                new (Staging.AddUninitialized_GetRef().GetTypedPtr()) V(std::forward<decltype(Element)>(Element));
+            }
+
+            int32 Num = Staging.Num();
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+            GroupIndices.Shrink();
+
+            int32 Total = 0;
+            for (int32 &Offset : Offsets) {
+                int32 Count = Offset;
+                Offset = Total;
+                Total += Count;
+            }
+            Offsets.Add(Total);
+
+            TArray<V, A> Values;
+            Values.SetNumUninitialized(Num);
+            RETROLIB_TRACE_COUNTER_ADD(BytesAllocated, Values.GetAllocatedSize() + Staging.GetAllocatedSize());
+            for (int32 i = 0; i < Num; i++) {
+                FMemory::Memcpy(Values.GetData() + Offsets[GroupOf[i]]++, Staging[i].GetTypedPtr(), sizeof(V));
+            }
+
+            // The scatter advanced every offset to the start of the next group
+            for (int32 i = Offsets.Num() - 2; i > 0; i--) {
+                Offsets[i] = Offsets[i - 1];
+            }
+            Offsets[0] = 0;
+
+            return TGroupedArray<K, V, A>(MoveTemp(Keys), MoveTemp(Offsets), MoveTemp(Values), MoveTemp(GroupIndices));
+        }
+
+        template <typename K, typename V, typename R, typename F>
+        static TGroupedArray<K, V, A> GroupParallel(R &Range, F &KeySelector) {
+            auto First = std::ranges::begin(Range);
+            int32 Num = static_cast<int32>(std::ranges::size(Range));
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+            Private::FHashPartitions Partitions = Private::PartitionByKeyHash(Range, KeySelector);
+
+            // A partition's values occupy the same span of the output as its indices do of the partitioned indices,
+            // so each partition can write its values in place without waiting for the others
+            TArray<V, A> Values;
+            Values.SetNumUninitialized(Num);
+            RETROLIB_TRACE_COUNTER_ADD(BytesAllocated, Values.GetAllocatedSize());
+
+            TArray<K> PartitionKeys[Private::NumGroupingPartitions];
+            TArray<uint32> PartitionHashes[Private::NumGroupingPartitions];
+            TArray<int32> PartitionOffsets[Private::NumGroupingPartitions];
+            ParallelFor(Private::NumGroupingPartitions, [&](int32 Partition) {
+                int32 Start = Partitions.Starts[Partition];
+                int32 End = Partitions.Starts[Partition + 1];
+                TArray<K> &Keys = PartitionKeys[Partition];
+                TArray<uint32> &Hashes = PartitionHashes[Partition];
+                TArray<int32> &Offsets = PartitionOffsets[Partition];
+                TMap<K, int32> GroupIndices;
+                GroupIndices.Reserve(End - Start);
+                TArray<int32> GroupOf;
+                GroupOf.SetNumUninitialized(End - Start);
+
+                for (int32 i = Start; i < End; i++) {
+                    int32 Index = Partitions.Indices[i];
+                    uint32 Hash = Partitions.Hashes[Index];
+                    K Key = std::invoke(KeySelector, First[Index]);
+                    int32 *Group = GroupIndices.FindByHash(Hash, Key);
+                    if (Group == nullptr) {
+                        Group = &GroupIndices.AddByHash(Hash, Key, Keys.Num());
+                        Keys.Emplace(MoveTemp(Key));
+                        Hashes.Add(Hash);
+                        Offsets.Add(0);
+                    }
+
+                    Offsets[*Group]++;
+                    GroupOf[i - Start] = *Group;
+                }
+
+                int32 Total = Start;
+                for (int32 &Offset : Offsets) {
+                    int32 Count = Offset;
+                    Offset = Total;
+                    Total += Count;
+                }
+
+                TArray<int32> Cursors = Offsets;
+                for (int32 i = Start; i < End; i++) {
+                    new (Values.GetData() + Cursors[GroupOf[i - Start]]++) V(First[Partitions.Indices[i]]);
+                }
+            });
+
+            int32 NumGroups = 0;
+            for (const TArray<K> &Keys : PartitionKeys) {
+                NumGroups += Keys.Num();
+            }
+
+            // The partitions already hashed every key, so the combined lookup reuses their hashes
+            TArray<K, A> Keys;
+            TArray<int32, A> Offsets;
+            TMap<K, int32> GroupIndices;
+            Keys.Reserve(NumGroups);
+            Offsets.Reserve(NumGroups + 1);
+            GroupIndices.Reserve(NumGroups);
+            for (int32 Partition = 0; Partition < Private::NumGroupingPartitions; Partition++) {
+                TArray<K> &KeysOfPartition = PartitionKeys[Partition];
+                for (int32 i = 0; i < KeysOfPartition.Num(); i++) {
+                    GroupIndices.AddByHash(PartitionHashes[Partition][i], KeysOfPartition[i], Keys.Num());
+                    Keys.Emplace(MoveTemp(KeysOfPartition[i]));
+                }
+                Offsets.Append(PartitionOffsets[Partition]);
+            }
+            Offsets.Add(Num);
+
+            return TGroupedArray<K, V, A>(MoveTemp(Keys), MoveTemp(Offsets), MoveTemp(Values), MoveTemp(GroupIndices));
+        }
+    };
+
+    /**
+     * Group the elements of a range by a key into a TGroupedArray. The result is built in a single pass over the
+     * input: each element is staged as it is read, and once the size of every group is known the elements are
+     * relocated into one shared buffer in which each group is a contiguous slice. Within a group the elements keep
+     * their input order.
+     *
+     *     auto ByTeam = Entities | Retro::Ranges::GroupBy(&FEntityRecord::Team);
+     *     for (const FEntityRecord &Member : ByTeam.FindGroup(ETeam::Red)) { ... }
+     *
+     * Pass EGroupingMode::Parallel to partition large inputs by key hash and group the partitions on worker threads.
+     * Inputs that are not random access are collected into an array first.
+     *
+     * @tparam A The allocator policy of the result
+     * @tparam T The argument types, either the range, the key selector and optionally the mode, or the same without
+     *           the range to produce a pipe
+     * @param Args The range, the key selector and optionally the mode, or the same without the range
+     * @return The grouped elements, or the pipe closure
+     */
+    template <typename A = FDefaultAllocator, typename... T>
+    constexpr auto GroupBy(T &&...Args) {
+        return ExtensionMethod<TGroupByInvoker<A>{}>(std::forward<T>(Args)...);
+    }
+
+    struct FAggregateByInvoker {
+        template <std::ranges::input_range R, typename F, typename T, typename G>
+            requires std::invocable<F &, std::ranges::range_reference_t<R>>
+        auto operator()(R &&Range, F KeySelector, T Initial, G Fold,
+                        EGroupingMode Mode = EGroupingMode::Sequential) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::AggregateBy"));
+            RETROLIB_LLM_SCOPE();
+            using FKey = Private::TGroupKey<R, F>;
+
+            if (Mode == EGroupingMode::Parallel) {
+                if constexpr (std::ranges::random_access_range<R> && std::ranges::sized_range<R>) {
+                    if (static_cast<int32>(std::ranges::size(Range)) >= ParallelGroupingThreshold) {
+                        return AggregateParallel<FKey>(Range, KeySelector, Initial, Fold);
+                    }
+                }
+            }
+
+            TMap<FKey, T> Result;
+            int32 Num = 0;
+            for (auto &&Element : Range) {
+                FKey Key = std::invoke(KeySelector, Element);
+                uint32 Hash = GetTypeHash(Key);
+                T *Accumulator = Result.FindByHash(Hash, Key);
+                if (Accumulator == nullptr) {
+                    Accumulator = &Result.AddByHash(Hash, MoveTemp(Key), Initial);
+                }
+
+                Private::ApplyFold(*Accumulator, Fold, std::forward<decltype(Element)>(Element));
+                Num++;
+            }
+
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+            return Result;
+        }
+
+      private:
+        template <typename K, typename R, typename F, typename T, typename G>
+        static TMap<K, T> AggregateParallel(R &Range, F &KeySelector, const T &Initial, G &Fold) {
+            auto First = std::ranges::begin(Range);
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, static_cast<int32>(std::ranges::size(Range)));
+            Private::FHashPartitions Partitions = Private::PartitionByKeyHash(Range, KeySelector);
+
+            // Partitions never share a key, so their accumulators can be moved into the result without combining
+            TMap<K, T> PartitionResults[Private::NumGroupingPartitions];
+            ParallelFor(Private::NumGroupingPartitions, [&](int32 Partition) {
+                TMap<K, T> &Result = PartitionResults[Partition];
+                for (int32 i = Partitions.Starts[Partition]; i < Partitions.Starts[Partition + 1]; i++) {
+                    int32 Index = Partitions.Indices[i];
+                    uint32 Hash = Partitions.Hashes[Index];
+                    K Key = std::invoke(KeySelector, First[Index]);
+                    T *Accumulator = Result.FindByHash(Hash, Key);
+                    if (Accumulator == nullptr) {
+                        Accumulator = &Result.AddByHash(Hash, MoveTemp(Key), Initial);
+                    }
+
+                    Private::ApplyFold(*Accumulator, Fold, First[Index]);
+                }
+            });
+
+            int32 NumGroups = 0;
+            for (const TMap<K, T> &Partition : PartitionResults) {
+                NumGroups += Partition.Num();
+            }
+
+            TMap<K, T> Result;
+            Result.Reserve(NumGroups);
+            for (TMap<K, T> &Partition : PartitionResults) {
+                for (auto &[Key, Accumulator] : Partition) {
+                    Result.Add(MoveTemp(Key), MoveTemp(Accumulator));
+                }
+            }
+            return Result;
+        }
+    };
+
+    /**
+     * Fold the elements of a range into one accumulator per key, in a single pass and without materializing the
+     * groups. Every accumulator starts as a copy of the initial value. The fold either takes the accumulator by
+     * reference and updates it in place, or takes it by value and returns the new value.
+     *
+     *     TMap<EZone, int32> HealthByZone = Entities | Retro::Ranges::AggregateBy(&FEntityRecord::Zone, 0,
+     *         [](int32 &Total, const FEntityRecord &Entity) { Total += Entity.Health; });
+     *
+     * In EGroupingMode::Parallel the input, which must be random access and sized to benefit, is partitioned by key
+     * hash and every partition is folded on its own thread. Each key is folded on a single thread in input order, so
+     * the result is the same as the sequential one even for folds that are not associative.
+     *
+     * @tparam T The argument types, either the range, the key selector, the initial value, the fold and optionally
+     *           the mode, or the same without the range to produce a pipe
+     * @param Args The range, the key selector, the initial value, the fold and optionally the mode, or the same
+     *             without the range
+     * @return The map of keys to their accumulators, or the pipe closure
+     */
+    constexpr auto AggregateBy = ExtensionMethod<FAggregateByInvoker{}>;
+} // namespace Retro::Ranges
@@ -0,0 +1,326 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+
+#include <Async/ParallelFor.h>
+#include <Containers/Array.h>
+#include <Hash/CityHash.h>
+#include <Hash/xxhash.h>
+#include <Misc/Crc.h>
+
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace Retro::Ranges {
+
+    /**
+     * Inputs longer than this are hashed as a tree: each chunk of this many bytes is hashed on its own, in parallel
+     * when the input is contiguous, and the result is the hash of the chunk digests. The chunk boundaries are fixed, so
+     * the result does not depend on the number of threads or on how the bytes were delivered.
+     */
+    constexpr uint64 HashChunkBytes = 1024 * 1024;
+
+    /**
+     * Opt-in trait for element types whose bytes fully determine their value, so that a contiguous block of them can
+     * be hashed as raw memory. This holds by default for types without padding, such as integers and packed structs of
+     * them, and for floating point types, which are hashed by bit pattern. Specialize it for other types that are
+     * safe to hash bytewise.
+     *
+     * @tparam T The element type
+     */
+    template <typename T>
+    struct TIsBytewiseHashable
+        : std::bool_constant<std::has_unique_object_representations_v<T> || std::is_floating_point_v<T>> {};
+
+    template <typename T>
+    concept BytewiseHashable = TIsBytewiseHashable<std::remove_cv_t<T>>::value;
+
+    /**
+     * Concept for a hashing algorithm that can be used with HashRange. Algorithms provide a one shot HashBuffer and an
+     * incremental FBuilder that must produce the same digest for the same bytes.
+     *
+     * @tparam H The algorithm type
+     */
+    template <typename H>
+    concept HashAlgorithm = std::is_trivially_copyable_v<typename H::FDigest> &&
+                            requires(typename H::FBuilder &Builder, const void *Data, uint64 Size) {
+                                { H::HashBuffer(Data, Size) } -> std::same_as<typename H::FDigest>;
+                                Builder.Update(Data, Size);
+                                { std::as_const(Builder).Finalize() } -> std::same_as<typename H::FDigest>;
+                            };
+
+    /**
+     * 64 bit XXH3. The default, as it is the fastest of the engine's hashes and vectorized on every platform.
+     */
+    struct FXxHash64Hasher {
+        using FDigest = uint64;
+
+        static FDigest HashBuffer(const void *Data, uint64 Size) {
+            return FXxHash64::HashBuffer(Data, Size).Hash;
+        }
+
+        struct FBuilder {
+            void Update(const void *Data, uint64 Size) {
+                Builder.Update(Data, Size);
+            }
+
+            FDigest Finalize() const {
+                return Builder.Finalize().Hash;
+            }
+
+          private:
+            FXxHash64Builder Builder;
+        };
+    };
+
+    /**
+     * 128 bit XXH3, for fingerprints where a 64 bit collision would be a correctness problem, such as cache keys.
+     */
+    struct FXxHash128Hasher {
+        using FDigest = FXxHash128;
+
+        static FDigest HashBuffer(const void *Data, uint64 Size) {
+            return FXxHash128::HashBuffer(Data, Size);
+        }
+
+        struct FBuilder {
+            void Update(const void *Data, uint64 Size) {
+                Builder.Update(Data, Size);
+            }
+
+            FDigest Finalize() const {
+                return Builder.Finalize();
+            }
+
+          private:
+            FXxHash128Builder Builder;
+        };
+    };
+
+    /**
+     * 64 bit CityHash. The algorithm has no incremental form, so the builder buffers its input, which never exceeds
+     * one chunk.
+     */
+    struct FCityHash64Hasher {
+        using FDigest = uint64;
+
+        static FDigest HashBuffer(const void *Data, uint64 Size) {
+            check(Size <= MAX_uint32);
+            return CityHash64(static_cast<const char *>(Data), static_cast<uint32>(Size));
+        }
+
+        struct FBuilder {
+            void Update(const void *Data, uint64 Size) {
+                Pending.Append(static_cast<const uint8 *>(Data), static_cast<int32>(Size));
+            }
+
+            FDigest Finalize() const {
+                return HashBuffer(Pending.GetData(), Pending.Num());
+            }
+
+          private:
+            TArray<uint8> Pending;
+        };
+    };
+
+    /**
+     * CRC32 as computed by FCrc::MemCrc32, for compatibility with existing checksums. Slower than the other algorithms
+     * and only 32 bits wide, so prefer XXH3 for new fingerprints.
+     */
+    struct FCrc32Hasher {
+        using FDigest = uint32;
+
+        static FDigest HashBuffer(const void *Data, uint64 Size) {
+            FBuilder Builder;
+            Builder.Update(Data, Size);
+            return Builder.Finalize();
+        }
+
+        struct FBuilder {
+            void Update(const void *Data, uint64 Size) {
+                check(Size <= MAX_int32);
+                Crc = FCrc::MemCrc32(Data, static_cast<int32>(Size), Crc);
+            }
+
+            FDigest Finalize() const {
+                return Crc;
+            }
+
+          private:
+            uint32 Crc = 0;
+        };
+    };
+
+    /**
+     * Incremental hash that follows the same chunking as the contiguous path, so that streaming a sequence of bytes
+     * in any number of pieces gives the same digest as hashing it in one go.
+     *
+     * @tparam H The hashing algorithm
+     */
+    template <HashAlgorithm H>
+    class THashStream {
+      public:
+        using FDigest = typename H::FDigest;
+
+        void Update(const void *Data, uint64 Size) {
+            const uint8 *Bytes = static_cast<const uint8 *>(Data);
+            while (Size > 0) {
+                uint64 Count = FMath::Min(Size, HashChunkBytes - ChunkSize);
+                Builder.Update(Bytes, Count);
+                ChunkSize += Count;
+                Bytes += Count;
+                Size -= Count;
+
+                if (ChunkSize == HashChunkBytes) {
+                    Digests.Add(Builder.Finalize());
+                    Builder = typename H::FBuilder();
+                    ChunkSize = 0;
+                }
+            }
+        }
+
+        template <typename T>
+            requires std::is_trivially_copyable_v<T>
+        void UpdateValue(const T &Value) {
+            Update(&Value, sizeof(T));
+        }
+
+        FDigest Finalize() const {
+            if (Digests.IsEmpty()) {
+                return Builder.Finalize();
+            }
+
+            if (ChunkSize == 0 && Digests.Num() == 1) {
+                return Digests[0];
+            }
+
+            TArray<FDigest> AllDigests = Digests;
+            if (ChunkSize > 0) {
+                AllDigests.Add(Builder.Finalize());
+            }
+            return H::HashBuffer(AllDigests.GetData(), AllDigests.Num() * sizeof(FDigest));
+        }
+
+      private:
+        typename H::FBuilder Builder;
+        uint64 ChunkSize = 0;
+        TArray<FDigest> Digests;
+    };
+
+    namespace Private {
+        template <typename R>
+        concept BytewiseContiguousRange = std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                                          BytewiseHashable<std::ranges::range_value_t<R>>;
+
+        template <HashAlgorithm H>
+        typename H::FDigest HashBytes(const uint8 *Data, uint64 Size) {
+            if (Size <= HashChunkBytes) {
+                return H::HashBuffer(Data, Size);
+            }
+
+            int32 NumChunks = static_cast<int32>((Size + HashChunkBytes - 1) / HashChunkBytes);
+            TArray<typename H::FDigest> Digests;
+            Digests.SetNumUninitialized(NumChunks);
+            RETROLIB_TRACE_COUNTER_ADD(BytesAllocated, Digests.GetAllocatedSize());
+            ParallelFor(
+                NumChunks,
+                [Data, Size, &Digests](int32 Index) {
+                    uint64 Offset = static_cast<uint64>(Index) * HashChunkBytes;
+                    Digests[Index] = H::HashBuffer(Data + Offset, FMath::Min(HashChunkBytes, Size - Offset));
+                },
+                NumChunks < 4 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+            return H::HashBuffer(Digests.GetData(), Digests.Num() * sizeof(typename H::FDigest));
+        }
+
+        /**
+         * Feed one element of a range that cannot be hashed as a single block. Nested strings and arrays of plain data
+         * are prefixed with their length, and other nested ranges followed by their element count, so that, for
+         * example, {"ab", "c"} and {"a", "bc"} hash differently.
+         */
+        template <HashAlgorithm H, typename T>
+        void HashElement(THashStream<H> &Stream, const T &Element) {
+            if constexpr (BytewiseHashable<T>) {
+                Stream.UpdateValue(Element);
+            } else if constexpr (BytewiseContiguousRange<const T &>) {
+                uint64 Size = std::ranges::size(Element) * sizeof(std::ranges::range_value_t<const T &>);
+                Stream.UpdateValue(Size);
+                Stream.Update(std::ranges::data(Element), Size);
+            } else if constexpr (std::ranges::input_range<const T &>) {
+                uint64 Num = 0;
+                for (const auto &Nested : Element) {
+                    HashElement(Stream, Nested);
+                    Num++;
+                }
+                Stream.UpdateValue(Num);
+            } else {
+                Stream.UpdateValue(GetTypeHash(Element));
+            }
+        }
+    } // namespace Private
+
+    struct FHashRangeInvoker {
+        template <std::ranges::input_range R, HashAlgorithm H = FXxHash64Hasher>
+        typename H::FDigest operator()(R &&Range, H = {}) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::HashRange"));
+            RETROLIB_LLM_SCOPE();
+            using FElement = std::ranges::range_value_t<R>;
+
+            if constexpr (Private::BytewiseContiguousRange<R>) {
+                uint64 Num = std::ranges::size(Range);
+                RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+                return Private::HashBytes<H>(reinterpret_cast<const uint8 *>(std::ranges::data(Range)),
+                                             Num * sizeof(FElement));
+            } else {
+                THashStream<H> Stream;
+                int32 Num = 0;
+                if constexpr (BytewiseHashable<FElement>) {
+                    // Stage plain elements into blocks so that a lazy pipeline is still hashed a block at a time
+                    constexpr int32 BlockSize =
+                        sizeof(FElement) < 4096 ? static_cast<int32>(4096 / sizeof(FElement)) : 1;
+                    TArray<FElement, TInlineAllocator<BlockSize>> Block;
+                    for (auto &&Element : Range) {
+                        Block.Add(std::forward<decltype(Element)>(Element));
+                        if (Block.Num() == BlockSize) {
+                            Stream.Update(Block.GetData(), Block.Num() * sizeof(FElement));
+                            Num += Block.Num();
+                            Block.Reset();
+                        }
+                    }
+                    Stream.Update(Block.GetData(), Block.Num() * sizeof(FElement));
+                    Num += Block.Num();
+                } else {
+                    for (auto &&Element : Range) {
+                        Private::HashElement(Stream, Element);
+                        Num++;
+                    }
+                }
+
+                RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+                return Stream.Finalize();
+            }
+        }
+    };
+
+    /**
+     * Reduce a range to a content fingerprint. Contiguous ranges of plain data, including TArray, TArrayView and
+     * FString, are hashed as raw bytes in a single vectorized call, with inputs over HashChunkBytes split into chunks
+     * that are hashed in parallel. Any other pipeline is streamed through the same chunking, so the digest only
+     * depends on the bytes of the elements and never on how the range was produced:
+     *
+     *     uint64 Key = Retro::Ranges::HashRange(Payload);
+     *     FXxHash128 Fingerprint = Indices | std::views::filter(IsLive) | Retro::Ranges::HashRange(FXxHash128Hasher());
+     *
+     * Elements that are not plain data are hashed through nested contiguous storage where they have it, such as the
+     * characters of an FString, and through GetTypeHash otherwise. GetTypeHash is not stable between runs for every
+     * type, FName being the notable example, so such digests should not be persisted.
+     *
+     * The algorithm defaults to 64 bit XXH3. FXxHash128Hasher, FCityHash64Hasher and FCrc32Hasher are also provided.
+     */
+    constexpr auto HashRange = ExtensionMethod<FHashRangeInvoker{}>;
+} // namespace Retro::Ranges
@@ -0,0 +1,205 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+
+#include <Containers/Array.h>
+#include <Templates/IdentityFunctor.h>
+#include <Templates/TypeCompatibleBytes.h>
+#include <UObject/NameTypes.h>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    /**
+     * Maps a sort key onto an unsigned integer whose natural order matches the order of the key, which is what the
+     * radix sort operates on. Specialize this to sort by additional key types.
+     *
+     * @tparam T The key type
+     */
+    template <typename T>
+    struct TRadixSortKey;
+
+    template <std::unsigned_integral T>
+    struct TRadixSortKey<T> {
+        using FKey = T;
+
+        static constexpr FKey Encode(T Value) {
+            return Value;
+        }
+    };
+
+    template <std::signed_integral T>
+    struct TRadixSortKey<T> {
+        using FKey = std::make_unsigned_t<T>;
+
+        static constexpr FKey Encode(T Value) {
+            // Flipping the sign bit moves the negative values below the positive ones
+            return static_cast<FKey>(Value) ^ (FKey(1) << (sizeof(T) * 8 - 1));
+        }
+    };
+
+    template <>
+    struct TRadixSortKey<bool> {
+        using FKey = uint8;
+
+        static constexpr FKey Encode(bool Value) {
+            return Value ? 1 : 0;
+        }
+    };
+
+    template <std::floating_point T>
+        requires(sizeof(T) == 4 || sizeof(T) == 8)
+    struct TRadixSortKey<T> {
+        using FKey = std::conditional_t<sizeof(T) == 4, uint32, uint64>;
+
+        static constexpr FKey Encode(T Value) {
+            // Negative values have every bit flipped so that larger magnitudes sort first, positive values only have the
+            // sign bit set so that they sort after all of the negatives
+            constexpr FKey SignBit = FKey(1) << (sizeof(T) * 8 - 1);
+            FKey Bits = std::bit_cast<FKey>(Value);
+            return (Bits & SignBit) != 0 ? ~Bits : Bits | SignBit;
+        }
+    };
+
+    template <typename T>
+        requires std::is_enum_v<T>
+    struct TRadixSortKey<T> {
+        using FUnderlying = std::underlying_type_t<T>;
+        using FKey = typename TRadixSortKey<FUnderlying>::FKey;
+
+        static constexpr FKey Encode(T Value) {
+            return TRadixSortKey<FUnderlying>::Encode(static_cast<FUnderlying>(Value));
+        }
+    };
+
+    /**
+     * Names are sorted by their comparison index and then their number, the same order as FNameFastLess. This groups
+     * equal names together cheaply, but is not alphabetical and is not stable between runs.
+     */
+    template <>
+    struct TRadixSortKey<FName> {
+        using FKey = uint64;
+
+        static FKey Encode(const FName &Value) {
+            return static_cast<uint64>(Value.GetComparisonIndex().ToUnstableInt()) << 32 |
+                   static_cast<uint32>(Value.GetNumber());
+        }
+    };
+
+    /**
+     * Concept for a key type that has a TRadixSortKey specialization.
+     *
+     * @tparam T The key type
+     */
+    template <typename T>
+    concept RadixSortable = requires(const T &Value) {
+        { TRadixSortKey<std::remove_cvref_t<T>>::Encode(Value) } -> std::unsigned_integral;
+    };
+
+    /**
+     * Below this many elements a comparison sort on the encoded keys is cheaper than clearing the histograms.
+     */
+    constexpr int32 RadixSortThreshold = 256;
+
+    /**
+     * Stable least significant digit radix sort over a contiguous range, ordering the elements by a key extracted with
+     * the projection. The key can be any integer, floating point, enum or bool type, or FName, and the sort takes
+     * O(n * sizeof(Key) / DigitBits) time. All digit histograms are built in a single pass up front, and passes whose
+     * digit has the same value for every element are skipped entirely, so keys that only use their low bits cost
+     * proportionally less.
+     *
+     * Elements are relocated bitwise between the range and a scratch buffer of the same size taken from the allocator
+     * policy A, as every Unreal container assumes that elements are trivially relocatable. Passing a
+     * TMemStackAllocator or TBumpArenaAllocator keeps per-frame sorts off the global heap.
+     *
+     *     Retro::Ranges::RadixSort(Primitives, [](const FPrimitiveSortItem &Item) { return Item.Depth; });
+     *
+     * @tparam A The allocator policy for the scratch buffer
+     * @tparam DigitBits The number of key bits consumed by each pass, at most 16. 8 is a good default, 11 halves the
+     *                   passes for 32 bit keys at the cost of larger histograms.
+     * @tparam R The range type
+     * @tparam J The key projection type
+     * @param Range The range to sort in place
+     * @param Projection Extracts the key from an element
+     */
+    template <typename A = FDefaultAllocator, uint32 DigitBits = 8, std::ranges::contiguous_range R,
+              typename J = FIdentityFunctor>
+        requires std::ranges::sized_range<R> &&
+                 RadixSortable<std::invoke_result_t<J &, const std::ranges::range_value_t<R> &>>
+    void RadixSort(R &&Range, J Projection = {}) {
+        static_assert(DigitBits > 0 && DigitBits <= 16, "Digits must be between 1 and 16 bits");
+        RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::RadixSort"));
+        RETROLIB_LLM_SCOPE();
+
+        using FElement = std::ranges::range_value_t<R>;
+        using FKeyTraits = TRadixSortKey<std::remove_cvref_t<std::invoke_result_t<J &, const FElement &>>>;
+        using FKey = typename FKeyTraits::FKey;
+        constexpr uint32 NumBuckets = 1u << DigitBits;
+        constexpr uint32 NumPasses = (sizeof(FKey) * 8 + DigitBits - 1) / DigitBits;
+        constexpr FKey DigitMask = static_cast<FKey>(NumBuckets - 1);
+
+        FElement *Data = std::ranges::data(Range);
+        int32 Num = static_cast<int32>(std::ranges::size(Range));
+        RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+        auto GetKey = [&Projection](const FElement &Element) {
+            return FKeyTraits::Encode(std::invoke(Projection, Element));
+        };
+
+        if (Num < RadixSortThreshold) {
+            std::stable_sort(Data, Data + Num,
+                             [&GetKey](const FElement &Lhs, const FElement &Rhs) { return GetKey(Lhs) < GetKey(Rhs); });
+            return;
+        }
+
+        TArray<uint32, A> Histograms;
+        Histograms.SetNumZeroed(NumPasses * NumBuckets);
+        for (int32 i = 0; i < Num; i++) {
+            FKey Key = GetKey(Data[i]);
+            for (uint32 Pass = 0; Pass < NumPasses; Pass++) {
+                Histograms[Pass * NumBuckets + static_cast<uint32>((Key >> (Pass * DigitBits)) & DigitMask)]++;
+            }
+        }
+
+        TArray<TTypeCompatibleBytes<FElement>, A> Scratch;
+        Scratch.SetNumUninitialized(Num);
+        RETROLIB_TRACE_COUNTER_ADD(BytesAllocated, Scratch.GetAllocatedSize() + Histograms.GetAllocatedSize());
+
+        FElement *Source = Data;
+        FElement *Destination = Scratch.GetData()->GetTypedPtr();
+        for (uint32 Pass = 0; Pass < NumPasses; Pass++) {
+            uint32 *Offsets = Histograms.GetData() + Pass * NumBuckets;
+            uint32 Shift = Pass * DigitBits;
+
+            // If every element has the same digit the pass would leave the order unchanged
+            if (Offsets[static_cast<uint32>((GetKey(Source[0]) >> Shift) & DigitMask)] == static_cast<uint32>(Num)) {
+                continue;
+            }
+
+            uint32 Total = 0;
+            for (uint32 Bucket = 0; Bucket < NumBuckets; Bucket++) {
+                uint32 Count = Offsets[Bucket];
+                Offsets[Bucket] = Total;
+                Total += Count;
+            }
+
+            for (int32 i = 0; i < Num; i++) {
+                uint32 Digit = static_cast<uint32>((GetKey(Source[i]) >> Shift) & DigitMask);
+                FMemory::Memcpy(Destination + Offsets[Digit]++, Source + i, sizeof(FElement));
+            }
+
+            std::swap(Source, Destination);
+        }
+
+        // An odd number of passes leaves the sorted elements in the scratch buffer
+        if (Source != Data) {
+            FMemory::Memcpy(Data, Source, sizeof(FElement) * Num);
+        }
+    }
+} // namespace Retro::Ranges
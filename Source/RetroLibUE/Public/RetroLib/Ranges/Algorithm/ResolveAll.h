@@ -0,0 +1,92 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+#include "RetroLib/Ranges/Concepts/SizeHint.h"
+#include "RetroLib/Ranges/Views/ResolveWeak.h"
+
+#include <Containers/Array.h>
+
+namespace Retro::Ranges {
+
+    template <typename A>
+    struct TResolveAllInvoker {
+        template <std::ranges::input_range R>
+            requires WeakHandle<std::ranges::range_reference_t<R>>
+        auto operator()(R &&Range) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::ResolveAll"));
+            RETROLIB_LLM_SCOPE();
+            using FPointer = TResolvedPointer<std::ranges::range_reference_t<R>>;
+            TArray<FPointer, A> Result;
+            if (int32 SizeHint = GetSizeHint(Range); SizeHint > 0) {
+                Result.Reserve(SizeHint);
+            }
+
+            for (auto &&Handle : Range) {
+                if (FPointer Resolved = Handle.Get(); Resolved != nullptr) {
+                    Result.Add(Resolved);
+                }
+            }
+
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Result.Num());
+            return Result;
+        }
+    };
+
+    /**
+     * Resolve every weak handle in a range and collect the pointers of the objects that are still alive into a
+     * TArray. Storage for every handle is reserved up front, so the whole resolution makes at most one allocation.
+     *
+     * @tparam A The allocator policy of the resulting array
+     * @tparam T The argument types, either the range to resolve or nothing to produce a pipe
+     * @param Args Either the range to resolve or nothing to produce a pipe
+     * @return The resolved pointers, or the pipe closure
+     */
+    template <typename A = FDefaultAllocator, typename... T>
+    constexpr auto ResolveAll(T &&...Args) {
+        return ExtensionMethod<TResolveAllInvoker<A>{}>(std::forward<T>(Args)...);
+    }
+
+    /**
+     * Resolve every weak handle in an array, removing the stale ones from the array in the same pass. The surviving
+     * handles keep their relative order, so the array and the result line up index for index afterwards. This is
+     * intended for long-lived caches of weak pointers that are re-resolved every frame.
+     *
+     * @tparam H The weak handle type
+     * @tparam A The allocator policy of the handle array
+     * @tparam B The allocator policy of the resulting array
+     * @param Handles The handles to resolve and compact
+     * @return The resolved pointers
+     */
+    template <typename B = FDefaultAllocator, WeakHandle H, typename A>
+    auto ResolveAndCompact(TArray<H, A> &Handles) {
+        RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::ResolveAndCompact"));
+        RETROLIB_LLM_SCOPE();
+        TArray<TResolvedPointer<H>, B> Result;
+        Result.Reserve(Handles.Num());
+
+        H *Data = Handles.GetData();
+        int32 Num = Handles.Num();
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < Num; ReadIndex++) {
+            auto Resolved = Data[ReadIndex].Get();
+            if (Resolved == nullptr) {
+                continue;
+            }
+
+            if (WriteIndex != ReadIndex) {
+                Data[WriteIndex] = MoveTemp(Data[ReadIndex]);
+            }
+            Result.Add(Resolved);
+            WriteIndex++;
+        }
+
+        RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, WriteIndex);
+        RETROLIB_TRACE_COUNTER_ADD(ElementsFiltered, Num - WriteIndex);
+        Handles.SetNum(WriteIndex);
+        return Result;
+    }
+} // namespace Retro::Ranges
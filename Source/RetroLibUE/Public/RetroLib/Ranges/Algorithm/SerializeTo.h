@@ -0,0 +1,141 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+#include "RetroLib/Ranges/Concepts/Serialization.h"
+
+#include <Containers/Array.h>
+
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    namespace Private {
+        /**
+         * Archives take the value by non-const reference for both directions. The sink only ever saves, so it is safe
+         * to hand it an element the range only exposes as const or as a temporary.
+         */
+        template <typename T>
+        std::remove_cvref_t<T> &AsSavable(T &&Element) {
+            return const_cast<std::remove_cvref_t<T> &>(Element);
+        }
+
+        template <typename T, typename R>
+        int32 SerializeElements(R &Range, FArchive &Ar) {
+            int32 Num = 0;
+            if constexpr (BulkSerializable<T>) {
+                if (!Ar.IsByteSwapping()) {
+                    // Gather the elements into fixed size chunks so that a lazy range still costs one Serialize call
+                    // per chunk rather than one per element
+                    TArray<T, TInlineAllocator<SerializationChunkSize<T>>> Chunk;
+                    for (auto &&Element : Range) {
+                        Chunk.Add(std::forward<decltype(Element)>(Element));
+                        if (Chunk.Num() == SerializationChunkSize<T>) {
+                            Ar.Serialize(Chunk.GetData(), Chunk.Num() * sizeof(T));
+                            Num += Chunk.Num();
+                            Chunk.Reset();
+                        }
+                    }
+
+                    if (Chunk.Num() > 0) {
+                        Ar.Serialize(Chunk.GetData(), Chunk.Num() * sizeof(T));
+                        Num += Chunk.Num();
+                    }
+                    return Num;
+                }
+            }
+
+            for (auto &&Element : Range) {
+                Ar << AsSavable(std::forward<decltype(Element)>(Element));
+                Num++;
+            }
+            return Num;
+        }
+    } // namespace Private
+
+    struct FSerializeToInvoker {
+        template <std::ranges::input_range R>
+            requires ArchiveSerializable<std::ranges::range_value_t<R>>
+        int32 operator()(R &&Range, FArchive *Ar) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::SerializeTo"));
+            RETROLIB_LLM_SCOPE();
+            using FElement = std::ranges::range_value_t<R>;
+            check(Ar != nullptr && Ar->IsSaving());
+
+            if constexpr (std::ranges::sized_range<R>) {
+                int32 Num = static_cast<int32>(std::ranges::size(Range));
+                *Ar << Num;
+                RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+                if constexpr (std::ranges::contiguous_range<R> && BulkSerializable<FElement>) {
+                    if (!Ar->IsByteSwapping()) {
+                        // Saving never writes through the pointer, so it is safe to drop the const
+                        Ar->Serialize(const_cast<FElement *>(std::ranges::data(Range)), Num * sizeof(FElement));
+                        return Num;
+                    }
+                }
+
+                Private::SerializeElements<FElement>(Range, *Ar);
+                return Num;
+            } else {
+                // The count is not known up front, so write a placeholder and patch it once the range is exhausted
+                int64 CountOffset = Ar->Tell();
+                if (CountOffset == INDEX_NONE) {
+                    TArray<FElement> Buffer;
+                    for (auto &&Element : Range) {
+                        Buffer.Add(std::forward<decltype(Element)>(Element));
+                    }
+                    RETROLIB_TRACE_COUNTER_ADD(BytesAllocated, Buffer.GetAllocatedSize());
+                    return (*this)(Buffer, Ar);
+                }
+
+                int32 Num = 0;
+                *Ar << Num;
+                Num = Private::SerializeElements<FElement>(Range, *Ar);
+                RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+
+                int64 EndOffset = Ar->Tell();
+                Ar->Seek(CountOffset);
+                *Ar << Num;
+                Ar->Seek(EndOffset);
+                return Num;
+            }
+        }
+    };
+
+    /**
+     * Write a range to an archive in the same layout as a TArray: an int32 count followed by the elements. Ranges of
+     * arithmetic, enum or TCanBulkSerialize elements are written a chunk at a time with a single Serialize call, or in
+     * one call if the range is contiguous, instead of going through operator<< for every element. If the range cannot
+     * report its size, a placeholder count is written and patched once the range is exhausted, so nothing is buffered
+     * unless the archive cannot seek.
+     *
+     *     Retro::Ranges::Views::Deserialize<int32>(Reader)
+     *         | std::views::filter([](int32 Id) { return Id != INDEX_NONE; })
+     *         | Retro::Ranges::SerializeTo(Writer);
+     *
+     * The result can be read back with Views::Deserialize, or directly into a TArray with operator<<.
+     *
+     * @param Ar The archive to write to, which must be saving
+     * @return The pipe closure, which returns the number of elements written
+     */
+    inline auto SerializeTo(FArchive &Ar) {
+        return ExtensionMethod<FSerializeToInvoker{}>(&Ar);
+    }
+
+    /**
+     * Write a range to an archive in the same layout as a TArray.
+     *
+     * @tparam R The range type
+     * @param Range The range to write
+     * @param Ar The archive to write to, which must be saving
+     * @return The number of elements written
+     */
+    template <std::ranges::input_range R>
+        requires ArchiveSerializable<std::ranges::range_value_t<R>>
+    int32 SerializeTo(R &&Range, FArchive &Ar) {
+        return FSerializeToInvoker{}(std::forward<R>(Range), &Ar);
+    }
+} // namespace Retro::Ranges
@@ -0,0 +1,73 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Memory/BumpArena.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+#include "RetroLib/Ranges/Concepts/SizeHint.h"
+
+#include <Containers/Array.h>
+#include <Misc/MemStack.h>
+
+namespace Retro::Ranges {
+
+    /**
+     * TArray that takes its memory from the thread's FMemStack. It must be destroyed before the enclosing FMemMark.
+     * The alias can be passed straight to To, e.g. To<TMemStackArray>().
+     *
+     * @tparam T The element type
+     */
+    template <typename T>
+    using TMemStackArray = TArray<T, TMemStackAllocator<>>;
+
+    /**
+     * TArray that takes its memory from the thread's FBumpArena. It must be destroyed before the enclosing
+     * FBumpArenaMark, or before the end of the frame on the game thread. The alias can be passed straight to To, e.g.
+     * To<TBumpArenaArray>().
+     *
+     * @tparam T The element type
+     */
+    template <typename T>
+    using TBumpArenaArray = TArray<T, TBumpArenaAllocator<>>;
+
+    template <typename A>
+    struct TToArrayInvoker {
+        // The return type is spelled out rather than deduced so that common instantiations can be declared extern
+        template <std::ranges::input_range R>
+        TArray<std::ranges::range_value_t<R>, A> operator()(R &&Range) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::ToArray"));
+            RETROLIB_LLM_SCOPE();
+            TArray<std::ranges::range_value_t<R>, A> Result;
+            if (int32 SizeHint = GetSizeHint(Range); SizeHint > 0) {
+                Result.Reserve(SizeHint);
+            }
+
+            for (auto &&Element : Range) {
+                Result.Emplace(std::forward<decltype(Element)>(Element));
+            }
+
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Result.Num());
+            RETROLIB_TRACE_COUNTER_ADD(BytesAllocated, Result.GetAllocatedSize());
+
+            return Result;
+        }
+    };
+
+    /**
+     * Collect a range into a TArray that uses the given allocator policy, such as TInlineAllocator<N>,
+     * TMemStackAllocator<> or TBumpArenaAllocator<>. Storage is reserved up front from the exact size of the range
+     * if it is known, or from its size hint otherwise, so that arena-backed targets do not leave abandoned
+     * allocations behind as they grow.
+     *
+     * @tparam A The allocator policy of the resulting array
+     * @tparam T The argument types, either the range to collect or nothing to produce a pipe
+     * @param Args Either the range to collect or nothing to produce a pipe
+     * @return The collected array, or the pipe closure
+     */
+    template <typename A = FDefaultAllocator, typename... T>
+    constexpr auto ToArray(T &&...Args) {
+        return ExtensionMethod<TToArrayInvoker<A>{}>(std::forward<T>(Args)...);
+    }
+} // namespace Retro::Ranges
@@ -0,0 +1,52 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+#include "RetroLib/Ranges/Views/SetBits.h"
+
+namespace Retro::Ranges {
+
+    template <typename A>
+    struct TToBitArrayInvoker {
+        template <BitOperand T>
+        TBitArray<A> operator()(T &&Bits) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::ToBitArray"));
+            RETROLIB_LLM_SCOPE();
+            auto Source = AsBitWordSource(std::forward<T>(Bits));
+            int32 NumBits = Source.NumBits();
+            int32 NumDWords = FMath::DivideAndRoundUp(NumBits, NumBitsPerDWORD);
+
+            TBitArray<A> Result(false, NumBits);
+            uint32 *Data = Result.GetData();
+            for (int32 i = 0; i < GetNumBitWords(NumBits); i++) {
+                uint64 Word = Source.GetWord(i);
+                Data[i * 2] = static_cast<uint32>(Word);
+                if (i * 2 + 1 < NumDWords) {
+                    Data[i * 2 + 1] = static_cast<uint32>(Word >> 32);
+                }
+            }
+
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, NumBits);
+            return Result;
+        }
+    };
+
+    /**
+     * Materialize a bit view, such as a combination made with BitAnd or BitOr, into a TBitArray. The result is written
+     * a whole word at a time rather than a bit at a time as To<TBitArray> would.
+     *
+     *     TBitArray<> Visible = Retro::Ranges::Views::BitAndNot(Spawned, Hidden) | Retro::Ranges::ToBitArray();
+     *
+     * @tparam A The allocator of the resulting bit array
+     * @tparam T The argument types, either the bits to materialize or nothing to produce a pipe
+     * @param Args Either the bits to materialize or nothing to produce a pipe
+     * @return The bit array, or the pipe closure
+     */
+    template <typename A = FDefaultBitArrayAllocator, typename... T>
+    constexpr auto ToBitArray(T &&...Args) {
+        return ExtensionMethod<TToBitArrayInvoker<A>{}>(std::forward<T>(Args)...);
+    }
+} // namespace Retro::Ranges
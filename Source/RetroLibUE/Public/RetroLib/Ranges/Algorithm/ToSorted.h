@@ -0,0 +1,156 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Containers/FlatSortedMap.h"
+#include "RetroLib/Containers/FlatSortedSet.h"
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+#include "RetroLib/Ranges/Concepts/SizeHint.h"
+#include "RetroLib/TypeTraits.h"
+
+#include <Containers/SortedMap.h>
+
+namespace Retro::Ranges {
+
+    /**
+     * Concept for a range of key/value pairs, such as the elements of a TMap or a range of TTuples.
+     *
+     * @tparam R The range type
+     */
+    template <typename R>
+    concept PairRange = std::ranges::input_range<R> && TupleLike<std::ranges::range_value_t<R>> &&
+                        (std::tuple_size_v<std::ranges::range_value_t<R>> == 2);
+
+    namespace Private {
+        template <PairRange R>
+        using TPairKey = std::decay_t<std::tuple_element_t<0, std::ranges::range_value_t<R>>>;
+
+        template <PairRange R>
+        using TPairValue = std::decay_t<std::tuple_element_t<1, std::ranges::range_value_t<R>>>;
+
+        template <typename P, typename D>
+        using TPredicateOrDefault = std::conditional_t<std::is_void_v<P>, D, P>;
+
+        /**
+         * Gather every pair of a range into an array, ready to be sorted in one pass.
+         */
+        template <PairRange R>
+        TArray<TPair<TPairKey<R>, TPairValue<R>>> CollectPairs(R &&Range) {
+            TArray<TPair<TPairKey<R>, TPairValue<R>>> Pairs;
+            if (int32 SizeHint = GetSizeHint(Range); SizeHint > 0) {
+                Pairs.Reserve(SizeHint);
+            }
+
+            for (auto &&Pair : Range) {
+                Pairs.Emplace(get<0>(std::forward<decltype(Pair)>(Pair)), get<1>(std::forward<decltype(Pair)>(Pair)));
+            }
+
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Pairs.Num());
+            return Pairs;
+        }
+    } // namespace Private
+
+    template <typename A, typename P>
+    struct TToSortedMapInvoker {
+        template <PairRange R>
+        auto operator()(R &&Range) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::ToSortedMap"));
+            RETROLIB_LLM_SCOPE();
+            using FKey = Private::TPairKey<R>;
+            using FPredicate =
+                Private::TPredicateOrDefault<P, TLess<typename TTypeTraits<FKey>::ConstPointerType>>;
+            auto Pairs = Private::CollectPairs(std::forward<R>(Range));
+            SortAndRemoveDuplicates(Pairs, [](const auto &Pair) -> const FKey & { return Pair.Key; }, FPredicate());
+
+            // Every pair lands past the end of the map, so each insert is a binary search and an append rather than a
+            // shift of the whole backing array
+            TSortedMap<FKey, Private::TPairValue<R>, A, FPredicate> Result;
+            Result.Reserve(Pairs.Num());
+            for (auto &Pair : Pairs) {
+                Result.Emplace(MoveTemp(Pair.Key), MoveTemp(Pair.Value));
+            }
+
+            return Result;
+        }
+    };
+
+    /**
+     * Collect a range of pairs into a TSortedMap. The pairs are gathered, sorted and deduplicated in one pass and only
+     * then inserted in key order, which makes construction O(n log n) instead of the O(n^2) of adding them one by
+     * one in arbitrary order. If a key appears more than once the last pair wins, as with To<TMap>.
+     *
+     * @tparam A The allocator policy of the resulting map
+     * @tparam P The key predicate of the resulting map, or void to use the TSortedMap default
+     * @tparam T The argument types, either the range to collect or nothing to produce a pipe
+     * @param Args Either the range to collect or nothing to produce a pipe
+     * @return The collected map, or the pipe closure
+     */
+    template <typename A = FDefaultAllocator, typename P = void, typename... T>
+    constexpr auto ToSortedMap(T &&...Args) {
+        return ExtensionMethod<TToSortedMapInvoker<A, P>{}>(std::forward<T>(Args)...);
+    }
+
+    template <typename A, typename P>
+    struct TToFlatSortedMapInvoker {
+        template <PairRange R>
+        auto operator()(R &&Range) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::ToFlatSortedMap"));
+            RETROLIB_LLM_SCOPE();
+            using FKey = Private::TPairKey<R>;
+            return TFlatSortedMap<FKey, Private::TPairValue<R>, A, Private::TPredicateOrDefault<P, TLess<FKey>>>(
+                Private::CollectPairs(std::forward<R>(Range)));
+        }
+    };
+
+    /**
+     * Collect a range of pairs into a TFlatSortedMap, sorting and deduplicating them once. If a key appears more than
+     * once the last pair wins.
+     *
+     * @tparam A The allocator policy of the resulting map
+     * @tparam P The key predicate of the resulting map, or void to use TLess
+     * @tparam T The argument types, either the range to collect or nothing to produce a pipe
+     * @param Args Either the range to collect or nothing to produce a pipe
+     * @return The collected map, or the pipe closure
+     */
+    template <typename A = FDefaultAllocator, typename P = void, typename... T>
+    constexpr auto ToFlatSortedMap(T &&...Args) {
+        return ExtensionMethod<TToFlatSortedMapInvoker<A, P>{}>(std::forward<T>(Args)...);
+    }
+
+    template <typename A, typename P>
+    struct TToFlatSortedSetInvoker {
+        template <std::ranges::input_range R>
+        auto operator()(R &&Range) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::ToFlatSortedSet"));
+            RETROLIB_LLM_SCOPE();
+            using FElement = std::ranges::range_value_t<R>;
+            TArray<FElement, A> Elements;
+            if (int32 SizeHint = GetSizeHint(Range); SizeHint > 0) {
+                Elements.Reserve(SizeHint);
+            }
+
+            for (auto &&Element : Range) {
+                Elements.Emplace(std::forward<decltype(Element)>(Element));
+            }
+
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Elements.Num());
+            return TFlatSortedSet<FElement, A, Private::TPredicateOrDefault<P, TLess<FElement>>>(MoveTemp(Elements));
+        }
+    };
+
+    /**
+     * Collect a range into a TFlatSortedSet, sorting and deduplicating the elements once.
+     *
+     * @tparam A The allocator policy of the resulting set
+     * @tparam P The predicate of the resulting set, or void to use TLess
+     * @tparam T The argument types, either the range to collect or nothing to produce a pipe
+     * @param Args Either the range to collect or nothing to produce a pipe
+     * @return The collected set, or the pipe closure
+     */
+    template <typename A = FDefaultAllocator, typename P = void, typename... T>
+    constexpr auto ToFlatSortedSet(T &&...Args) {
+        return ExtensionMethod<TToFlatSortedSetInvoker<A, P>{}>(std::forward<T>(Args)...);
+    }
+} // namespace Retro::Ranges
@@ -0,0 +1,106 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Json/JsonEncoding.h"
+#include "RetroLib/Json/JsonStreamWriter.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    struct FWriteJsonInvoker {
+        template <std::ranges::input_range R, Json::JsonSink W>
+        int32 operator()(R &&Range, W *Writer) const {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::WriteJsonTo"));
+            RETROLIB_LLM_SCOPE();
+            check(Writer != nullptr);
+
+            int32 Num = 0;
+            Writer->BeginArray();
+            for (auto &&Element : Range) {
+                Json::WriteValue(*Writer, Element);
+                Num++;
+            }
+            Writer->EndArray();
+
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Num);
+            return Num;
+        }
+
+        template <std::ranges::input_range R>
+        int32 operator()(R &&Range, FArchive *Ar) const {
+            Json::FJsonStreamWriter Writer(*Ar);
+            return (*this)(std::forward<R>(Range), &Writer);
+        }
+
+        template <std::ranges::input_range R>
+        int32 operator()(R &&Range, TArray<uint8> *Bytes) const {
+            Json::FJsonStreamWriter Writer(*Bytes);
+            return (*this)(std::forward<R>(Range), &Writer);
+        }
+
+        template <std::ranges::input_range R, typename C, typename P>
+        int32 operator()(R &&Range, TJsonWriter<C, P> *JsonWriter) const {
+            Json::TJsonWriterAdapter<C, P> Writer(*JsonWriter);
+            return (*this)(std::forward<R>(Range), &Writer);
+        }
+    };
+
+    /**
+     * Write a range to an archive as a UTF-8 JSON array, one element at a time, without building a document. Output
+     * is buffered and flushed to the archive in 64KB chunks, so the memory used does not depend on the size of the
+     * range. See Json::WriteValue for how each element is encoded.
+     *
+     *     TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*Path));
+     *     Session.Events | std::views::filter(&FTelemetryEvent::bExported) | Retro::Ranges::WriteJsonTo(*File);
+     *
+     * @param Ar The archive to write to, which must be saving
+     * @return The pipe closure, which returns the number of elements written
+     */
+    inline auto WriteJsonTo(FArchive &Ar) {
+        return ExtensionMethod<FWriteJsonInvoker{}>(&Ar);
+    }
+
+    /**
+     * Append a range to a byte buffer as a UTF-8 JSON array.
+     *
+     * @param Bytes The buffer to append to
+     * @return The pipe closure, which returns the number of elements written
+     */
+    inline auto WriteJsonTo(TArray<uint8> &Bytes) {
+        return ExtensionMethod<FWriteJsonInvoker{}>(&Bytes);
+    }
+
+    /**
+     * Write a range as a JSON array into a document that is already being written, such as the value of a key.
+     *
+     * @param Writer The writer to write to
+     * @return The pipe closure, which returns the number of elements written
+     */
+    inline auto WriteJsonTo(Json::FJsonStreamWriter &Writer) {
+        return ExtensionMethod<FWriteJsonInvoker{}>(&Writer);
+    }
+
+    /**
+     * Write a range as a JSON array into one of the engine's JSON writers. Values are passed straight to the writer
+     * without creating any FJsonValue objects.
+     *
+     * @tparam C The character type of the writer
+     * @tparam P The print policy of the writer
+     * @param Writer The writer to write to
+     * @return The pipe closure, which returns the number of elements written
+     */
+    template <typename C, typename P>
+    auto WriteJsonTo(TJsonWriter<C, P> &Writer) {
+        return ExtensionMethod<FWriteJsonInvoker{}>(&Writer);
+    }
+
+    template <typename C, typename P>
+    auto WriteJsonTo(const TSharedRef<TJsonWriter<C, P>> &Writer) {
+        return ExtensionMethod<FWriteJsonInvoker{}>(&Writer.Get());
+    }
+} // namespace Retro::Ranges
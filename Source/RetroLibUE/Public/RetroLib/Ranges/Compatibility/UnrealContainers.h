@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Containers/Map.h"
+#include "Containers/SortedMap.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
 #include "RetroLib/Ranges/Algorithm/To.h"
 #include "RetroLib/Ranges/Compatibility/ForEachRange.h"
 #include "RetroLib/TypeTraits.h"
@@ -52,6 +54,9 @@ namespace Retro::Ranges {
 
     template <>
     struct IsMap<TMap> : std::true_type {};
+
+    template <>
+    struct IsMap<TSortedMap> : std::true_type {};
 } // namespace Retro::Ranges
 
 template <Retro::Ranges::UnrealSizedContainer R>
@@ -103,9 +108,26 @@ namespace Retro::Ranges {
         }
     };
 
+    /**
+     * Appending to a TSortedMap one pair at a time is O(n) per pair for unordered input. To<TSortedMap> works through
+     * this, but ToSortedMap in ToSorted.h sorts the pairs once up front and should be preferred for bulk construction.
+     */
+    template <typename K, typename V, typename A, typename P>
+    struct AppendableContainerType<TSortedMap<K, V, A, P>> : ValidType {
+        template <typename T>
+            requires TupleLike<std::decay_t<T>> && (std::tuple_size_v<std::decay_t<T>> == 2)
+        static constexpr decltype(auto) Append(TSortedMap<K, V, A, P> &Container, T &&Value) {
+            Container.Emplace(get<0>(std::forward<T>(Value)), get<1>(std::forward<T>(Value)));
+        }
+    };
+
+    // The LLM tag is applied in Reserve rather than Append, as To calls Reserve once per conversion but Append once
+    // per element. For sized ranges this covers the one allocation the conversion makes, while containers that grow
+    // while being filled from an unsized range are attributed to the caller. ToArray tags the whole fill instead.
     template <UnrealReservable T>
     struct ReservableContainerType<T> : ValidType {
-        static constexpr void Reserve(T &Container, int32 Size) {
+        static void Reserve(T &Container, int32 Size) {
+            RETROLIB_LLM_SCOPE();
             Container.Reserve(Size);
         }
 
@@ -121,7 +143,8 @@ namespace Retro::Ranges {
     template <UnrealStringReservable T>
         requires(!UnrealReservable<T>)
     struct ReservableContainerType<T> : ValidType {
-        static constexpr void Reserve(T &Container, int32 Size) {
+        static void Reserve(T &Container, int32 Size) {
+            RETROLIB_LLM_SCOPE();
             Container.Reserve(Size);
         }
 
@@ -0,0 +1,49 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Serialization/Archive.h>
+#include <Templates/UnrealTypeTraits.h>
+
+#include <concepts>
+#include <type_traits>
+
+namespace Retro::Ranges {
+
+    /**
+     * Concept for a type that can be written to and read back from an FArchive with operator<<.
+     *
+     * @tparam T The type to check
+     */
+    template <typename T>
+    concept ArchiveSerializable = std::default_initializable<T> && requires(FArchive &Ar, T &Value) { Ar << Value; };
+
+    /**
+     * Concept for a type whose serialized form is exactly its in-memory bytes, so that a contiguous block of them can be
+     * moved in or out of an archive with a single Serialize call. This covers arithmetic types, enums and anything that
+     * opts in with TCanBulkSerialize. Bool is excluded, as archives store it as a 32 bit value.
+     *
+     * Bulk serialization is only valid when the archive is not byte swapping, which has to be checked at runtime.
+     *
+     * @tparam T The type to check
+     */
+    template <typename T>
+    concept BulkSerializable = ArchiveSerializable<T> && std::is_trivially_copyable_v<T> &&
+                               ((std::is_arithmetic_v<T> && !std::same_as<T, bool>) || std::is_enum_v<T> ||
+                                TCanBulkSerialize<T>::Value);
+
+    /**
+     * The number of bytes that are gathered into a single Serialize call when bulk serializing elements that are not
+     * already laid out contiguously.
+     */
+    constexpr int32 SerializationChunkBytes = 4096;
+
+    /**
+     * The number of elements of the given type that fit in one serialization chunk.
+     *
+     * @tparam T The element type
+     */
+    template <typename T>
+    constexpr int32 SerializationChunkSize =
+        sizeof(T) < SerializationChunkBytes ? static_cast<int32>(SerializationChunkBytes / sizeof(T)) : 1;
+} // namespace Retro::Ranges
@@ -0,0 +1,39 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    /**
+     * Concept for a range that cannot report its exact size, but can give an upper bound on the number of elements it
+     * will produce. Views like set operations over sorted ranges use this so that terminal operations can reserve
+     * storage up front.
+     *
+     * @tparam R The range type to check
+     */
+    template <typename R>
+    concept HasSizeHint = requires(R &Range) {
+        { Range.GetSizeHint() } -> std::convertible_to<int32>;
+    };
+
+    /**
+     * Get the number of elements that should be reserved when collecting the given range into a container. This is
+     * the exact size for sized ranges, the upper bound for ranges that provide a size hint, and 0 for everything
+     * else.
+     *
+     * @param Range The range to check
+     * @return The number of elements to reserve
+     */
+    template <std::ranges::range R>
+    constexpr int32 GetSizeHint(R &Range) {
+        if constexpr (std::ranges::sized_range<R>) {
+            return static_cast<int32>(std::ranges::size(Range));
+        } else if constexpr (HasSizeHint<R>) {
+            return static_cast<int32>(Range.GetSizeHint());
+        } else {
+            return 0;
+        }
+    }
+} // namespace Retro::Ranges
@@ -0,0 +1,470 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <HAL/UnrealMemory.h>
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    /**
+     * The iteration guarantees offered by a type-erased view.
+     */
+    enum class EAnyViewCategory : uint8 {
+        /**
+         * The view can be iterated once, and its iterators cannot be copied.
+         */
+        Input,
+
+        /**
+         * The view can be iterated any number of times, and its iterators can be copied and compared.
+         */
+        Forward
+    };
+
+    /**
+     * Polymorphic object storage that keeps small objects inside of an inline buffer and only falls back to the
+     * heap for objects that are too large or that cannot be moved without throwing.
+     *
+     * The stored type must derive from I and provide the Clone and MoveTo members generated by
+     * TInlinePolymorphicImpl.
+     *
+     * @tparam I The interface type that is exposed
+     * @tparam InlineSize The size of the inline buffer in bytes
+     */
+    template <typename I, int32 InlineSize>
+    class TInlinePolymorphic {
+      public:
+        TInlinePolymorphic() = default;
+
+        TInlinePolymorphic(const TInlinePolymorphic &Other) {
+            if (Other.Ptr != nullptr) {
+                Ptr = Other.Ptr->Clone(Buffer);
+            }
+        }
+
+        TInlinePolymorphic(TInlinePolymorphic &&Other) noexcept {
+            MoveFrom(Other);
+        }
+
+        ~TInlinePolymorphic() {
+            Reset();
+        }
+
+        TInlinePolymorphic &operator=(const TInlinePolymorphic &Other) {
+            if (this != &Other) {
+                Reset();
+                if (Other.Ptr != nullptr) {
+                    Ptr = Other.Ptr->Clone(Buffer);
+                }
+            }
+
+            return *this;
+        }
+
+        TInlinePolymorphic &operator=(TInlinePolymorphic &&Other) noexcept {
+            if (this != &Other) {
+                Reset();
+                MoveFrom(Other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * Construct a new object in this storage, destroying whatever was held before.
+         *
+         * @tparam T The concrete type to construct
+         * @param Args The arguments to forward to the constructor
+         * @return A reference to the constructed object
+         */
+        template <std::derived_from<I> T, typename... A>
+        T &Emplace(A &&...Args) {
+            Reset();
+            T *Result;
+            if constexpr (FitsInline<T>) {
+                Result = new (Buffer) T(std::forward<A>(Args)...);
+            } else {
+                Result = new T(std::forward<A>(Args)...);
+            }
+            Ptr = Result;
+            return *Result;
+        }
+
+        /**
+         * Destroy the held object, if there is one.
+         */
+        void Reset() {
+            if (Ptr == nullptr) {
+                return;
+            }
+
+            if (IsInline()) {
+                Ptr->~I();
+            } else {
+                delete Ptr;
+            }
+            Ptr = nullptr;
+        }
+
+        bool IsSet() const {
+            return Ptr != nullptr;
+        }
+
+        I *operator->() const {
+            check(Ptr != nullptr);
+            return Ptr;
+        }
+
+        I &operator*() const {
+            check(Ptr != nullptr);
+            return *Ptr;
+        }
+
+        /**
+         * Check if an object of the given type would be stored without touching the heap.
+         *
+         * @tparam T The type to check
+         */
+        template <typename T>
+        static constexpr bool FitsInline = sizeof(T) <= InlineSize && alignof(T) <= alignof(std::max_align_t) &&
+                                           std::is_nothrow_move_constructible_v<T>;
+
+      private:
+        bool IsInline() const {
+            return static_cast<const void *>(Ptr) == static_cast<const void *>(Buffer);
+        }
+
+        void MoveFrom(TInlinePolymorphic &Other) {
+            if (Other.Ptr == nullptr) {
+                return;
+            }
+
+            if (Other.IsInline()) {
+                Ptr = Other.Ptr->MoveTo(Buffer);
+                Other.Reset();
+            } else {
+                Ptr = Other.Ptr;
+                Other.Ptr = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) uint8 Buffer[InlineSize];
+        I *Ptr = nullptr;
+    };
+
+    /**
+     * Helper base that implements the copy and move hooks required by TInlinePolymorphic for a concrete type.
+     *
+     * @tparam I The interface type
+     * @tparam T The concrete type that is deriving from this
+     * @tparam InlineSize The size of the inline buffer the object is stored in
+     */
+    template <typename I, typename T, int32 InlineSize>
+    struct TInlinePolymorphicImpl : I {
+        I *Clone(void *InlineBuffer) const override {
+            if constexpr (std::copy_constructible<T>) {
+                if constexpr (TInlinePolymorphic<I, InlineSize>::template FitsInline<T>) {
+                    return new (InlineBuffer) T(static_cast<const T &>(*this));
+                } else {
+                    return new T(static_cast<const T &>(*this));
+                }
+            } else {
+                checkNoEntry();
+                return nullptr;
+            }
+        }
+
+        I *MoveTo(void *InlineBuffer) override {
+            return new (InlineBuffer) T(std::move(static_cast<T &>(*this)));
+        }
+    };
+
+    /**
+     * Fixed capacity buffer that a type-erased view fills through a single virtual call. References are stored as
+     * pointers, while values are stored directly. Storing pointers is only sound when the referenced elements outlive
+     * the iterator that produced them, which is why a reference batch may only be filled from a forward range.
+     *
+     * @tparam T The reference type of the view
+     * @tparam BatchSize The maximum number of elements in one batch
+     */
+    template <typename T, int32 BatchSize>
+    class TAnyViewBatch {
+        using FStorageType = std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T> *, T>;
+
+      public:
+        using ReferenceType = std::conditional_t<std::is_reference_v<T>, T, const T &>;
+
+        template <typename U>
+        void Add(U &&Value) {
+            if constexpr (std::is_reference_v<T>) {
+                Items.Add(std::addressof(static_cast<T>(Value)));
+            } else {
+                Items.Emplace(std::forward<U>(Value));
+            }
+        }
+
+        ReferenceType operator[](int32 Index) const {
+            if constexpr (std::is_reference_v<T>) {
+                return *Items[Index];
+            } else {
+                return Items[Index];
+            }
+        }
+
+        int32 Num() const {
+            return Items.Num();
+        }
+
+        bool IsFull() const {
+            return Items.Num() >= BatchSize;
+        }
+
+        void Reset() {
+            Items.Reset();
+        }
+
+      private:
+        TArray<FStorageType, TInlineAllocator<BatchSize>> Items;
+    };
+
+    /**
+     * Type-erased cursor into the wrapped range.
+     */
+    template <typename T, int32 BatchSize>
+    class IAnyViewCursor {
+      public:
+        virtual ~IAnyViewCursor() = default;
+
+        /**
+         * Fill the batch with the next elements in the range. If the batch is not full when this returns then the
+         * range has been exhausted.
+         *
+         * @param Batch The batch to fill
+         */
+        virtual void NextBatch(TAnyViewBatch<T, BatchSize> &Batch) = 0;
+
+        virtual IAnyViewCursor *Clone(void *InlineBuffer) const = 0;
+
+        virtual IAnyViewCursor *MoveTo(void *InlineBuffer) = 0;
+    };
+
+    /**
+     * The number of bytes reserved for a cursor inside of each iterator.
+     */
+    constexpr int32 AnyViewCursorInlineSize = 6 * sizeof(void *);
+
+    template <typename T, int32 BatchSize>
+    using TAnyViewCursorStorage = TInlinePolymorphic<IAnyViewCursor<T, BatchSize>, AnyViewCursorInlineSize>;
+
+    /**
+     * Type-erased holder for the wrapped range.
+     */
+    template <typename T, int32 BatchSize>
+    class IAnyViewSource {
+      public:
+        virtual ~IAnyViewSource() = default;
+
+        virtual void CreateCursor(TAnyViewCursorStorage<T, BatchSize> &Storage) = 0;
+
+        virtual IAnyViewSource *Clone(void *InlineBuffer) const = 0;
+
+        virtual IAnyViewSource *MoveTo(void *InlineBuffer) = 0;
+    };
+
+    template <std::ranges::view V, typename T, int32 BatchSize>
+    class TAnyViewCursor final
+        : public TInlinePolymorphicImpl<IAnyViewCursor<T, BatchSize>, TAnyViewCursor<V, T, BatchSize>,
+                                        AnyViewCursorInlineSize> {
+      public:
+        TAnyViewCursor(std::ranges::iterator_t<V> Iterator, std::ranges::sentinel_t<V> Sentinel)
+            : Iterator(std::move(Iterator)), Sentinel(std::move(Sentinel)) {
+        }
+
+        void NextBatch(TAnyViewBatch<T, BatchSize> &Batch) override {
+            for (; !Batch.IsFull() && Iterator != Sentinel; ++Iterator) {
+                Batch.Add(*Iterator);
+            }
+        }
+
+      private:
+        std::ranges::iterator_t<V> Iterator;
+        std::ranges::sentinel_t<V> Sentinel;
+    };
+
+    template <std::ranges::view V, typename T, int32 BatchSize, int32 InlineSize>
+    class TAnyViewSource final
+        : public TInlinePolymorphicImpl<IAnyViewSource<T, BatchSize>, TAnyViewSource<V, T, BatchSize, InlineSize>,
+                                        InlineSize> {
+      public:
+        explicit TAnyViewSource(V Base) : Base(std::move(Base)) {
+        }
+
+        void CreateCursor(TAnyViewCursorStorage<T, BatchSize> &Storage) override {
+            Storage.template Emplace<TAnyViewCursor<V, T, BatchSize>>(std::ranges::begin(Base),
+                                                                      std::ranges::end(Base));
+        }
+
+      private:
+        V Base;
+    };
+
+    /**
+     * A type-erased view over any range whose elements are convertible to T. This allows pipelines to be returned
+     * from virtual functions, stored as members, and passed across module boundaries without materializing them
+     * into a container.
+     *
+     * The wrapped pipeline is kept in an inline buffer when it is small enough, and the elements are pulled out of
+     * it in batches so that only one virtual call is made per BatchSize elements instead of one per element.
+     *
+     * @tparam T The reference type of the erased range. If this is a value type, the view yields const references
+     *           to the values held in the current batch. If this is a reference type, the wrapped range must be a
+     *           forward range, as a single pass iterator may hand out references into itself that are invalidated
+     *           when the batch advances past it.
+     * @tparam Category The iteration guarantees of the view
+     * @tparam InlineSize The size of the inline buffer for the wrapped pipeline in bytes
+     * @tparam BatchSize The number of elements fetched per virtual call
+     */
+    template <typename T, EAnyViewCategory Category, int32 InlineSize = 64, int32 BatchSize = 16>
+    class TAnyView : public std::ranges::view_interface<TAnyView<T, Category, InlineSize, BatchSize>> {
+        static constexpr bool bMultipass = Category == EAnyViewCategory::Forward;
+
+        using FBatch = TAnyViewBatch<T, BatchSize>;
+        using FSourceStorage = TInlinePolymorphic<IAnyViewSource<T, BatchSize>, InlineSize>;
+
+        template <typename R>
+        static constexpr bool IsCompatibleRange =
+            std::ranges::viewable_range<R> && std::convertible_to<std::ranges::range_reference_t<R>, T> &&
+            (!bMultipass ||
+             (std::ranges::forward_range<R> && std::copy_constructible<std::views::all_t<R>>)) &&
+            (!std::is_reference_v<T> ||
+             (std::ranges::forward_range<R> && std::is_lvalue_reference_v<std::ranges::range_reference_t<R>>));
+
+        class FIterator {
+          public:
+            using value_type = std::remove_cvref_t<T>;
+            using difference_type = std::ptrdiff_t;
+
+            FIterator() = default;
+
+            explicit FIterator(IAnyViewSource<T, BatchSize> &Source) {
+                Source.CreateCursor(Cursor);
+                Fill();
+            }
+
+            FIterator(const FIterator &) requires bMultipass = default;
+            FIterator(FIterator &&) = default;
+
+            ~FIterator() = default;
+
+            FIterator &operator=(const FIterator &) requires bMultipass = default;
+            FIterator &operator=(FIterator &&) = default;
+
+            typename FBatch::ReferenceType operator*() const {
+                return Batch[Index];
+            }
+
+            FIterator &operator++() {
+                ++Index;
+                ++Position;
+                if (Index == Batch.Num() && Batch.IsFull()) {
+                    Fill();
+                }
+
+                return *this;
+            }
+
+            FIterator operator++(int) requires bMultipass {
+                auto Tmp = *this;
+                ++*this;
+                return Tmp;
+            }
+
+            void operator++(int) requires(!bMultipass) {
+                ++*this;
+            }
+
+            bool operator==(const FIterator &Other) const requires bMultipass {
+                return Position == Other.Position;
+            }
+
+            bool operator==(std::default_sentinel_t) const {
+                return Index >= Batch.Num();
+            }
+
+          private:
+            void Fill() {
+                Batch.Reset();
+                Index = 0;
+                Cursor->NextBatch(Batch);
+            }
+
+            TAnyViewCursorStorage<T, BatchSize> Cursor;
+            FBatch Batch;
+            int32 Index = 0;
+            int64 Position = 0;
+        };
+
+      public:
+        TAnyView() = default;
+
+        TAnyView(const TAnyView &) requires bMultipass = default;
+        TAnyView(TAnyView &&) = default;
+
+        ~TAnyView() = default;
+
+        TAnyView &operator=(const TAnyView &) requires bMultipass = default;
+        TAnyView &operator=(TAnyView &&) = default;
+
+        /**
+         * Wrap a range into this view.
+         *
+         * @param Range The range to wrap
+         */
+        template <typename R>
+            requires(!std::same_as<std::decay_t<R>, TAnyView>) && IsCompatibleRange<R>
+        explicit(false) TAnyView(R &&Range) {
+            using FViewType = std::views::all_t<R>;
+            Source.template Emplace<TAnyViewSource<FViewType, T, BatchSize, InlineSize>>(
+                std::views::all(std::forward<R>(Range)));
+        }
+
+        FIterator begin() const {
+            check(Source.IsSet());
+            return FIterator(*Source);
+        }
+
+        std::default_sentinel_t end() const {
+            return std::default_sentinel;
+        }
+
+        /**
+         * Check if the wrapped range was small enough to be stored without a heap allocation.
+         *
+         * @tparam R The range type to check
+         */
+        template <typename R>
+        static constexpr bool StoresInline =
+            FSourceStorage::template FitsInline<TAnyViewSource<std::views::all_t<R>, T, BatchSize, InlineSize>>;
+
+      private:
+        FSourceStorage Source;
+    };
+
+    /**
+     * Type-erased view that can be iterated once.
+     *
+     * @tparam T The reference type of the erased range
+     */
+    template <typename T>
+    using TAnyInputView = TAnyView<T, EAnyViewCategory::Input>;
+
+    /**
+     * Type-erased view that can be iterated multiple times.
+     *
+     * @tparam T The reference type of the erased range
+     */
+    template <typename T>
+    using TAnyForwardView = TAnyView<T, EAnyViewCategory::Forward>;
+} // namespace Retro::Ranges
@@ -0,0 +1,164 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <AssetRegistry/ARFilter.h>
+#include <AssetRegistry/AssetData.h>
+#include <Misc/Optional.h>
+#include <Templates/Function.h>
+
+class IAssetRegistry;
+
+namespace Retro::Ranges {
+
+    /**
+     * Streaming query over the Asset Registry. Class, path and tag constraints are accumulated into an FARFilter so
+     * that the registry applies them while enumerating, and results are handed to the caller by reference straight out
+     * of the registry's callback. Nothing is copied into an intermediate TArray<FAssetData>, so peak memory stays flat
+     * no matter how many assets match.
+     *
+     * The registry only supports push-style enumeration, so the query is consumed through ForEach and the other
+     * terminal operations rather than through iterators, and the FAssetData references are only valid for the duration
+     * of the callback. Take and the callback's return value both stop the enumeration early.
+     *
+     *     int32 Broken = Retro::Ranges::FAssetQuery()
+     *         .OfClass<UDataTable>()
+     *         .UnderPath(TEXT("/Game/Data"))
+     *         .Where([](const FAssetData &Asset) { return !Asset.IsRedirector(); })
+     *         .Count();
+     */
+    class RETROLIBUE_API FAssetQuery {
+      public:
+        /**
+         * Create a query against the given registry, or the global one if none is given.
+         *
+         * @param Registry The registry to enumerate
+         */
+        explicit FAssetQuery(IAssetRegistry *Registry = nullptr) : Registry(Registry) {
+        }
+
+        /**
+         * Only include assets of the given class. This can be called more than once to include several classes.
+         *
+         * @param ClassPath The path of the class
+         * @param bRecursive Include subclasses as well. The registry has a single flag for this, so it applies to every
+         *                   class in the query.
+         * @return This query
+         */
+        FAssetQuery &OfClass(FTopLevelAssetPath ClassPath, bool bRecursive = true);
+
+        /**
+         * Only include assets of the given class.
+         *
+         * @tparam T The class
+         * @param bRecursive Include subclasses as well
+         * @return This query
+         */
+        template <std::derived_from<UObject> T>
+        FAssetQuery &OfClass(bool bRecursive = true) {
+            return OfClass(T::StaticClass()->GetClassPathName(), bRecursive);
+        }
+
+        /**
+         * Only include assets within the given package path. This can be called more than once to include several
+         * paths.
+         *
+         * @param PackagePath The path, such as /Game/Maps
+         * @param bRecursive Include sub-paths as well. As with classes, this applies to every path in the query.
+         * @return This query
+         */
+        FAssetQuery &UnderPath(FName PackagePath, bool bRecursive = true);
+
+        /**
+         * Only include assets that have the given tag, optionally with a specific value.
+         *
+         * @param Tag The tag name
+         * @param Value The required value, or unset to accept any value
+         * @return This query
+         */
+        FAssetQuery &WithTag(FName Tag, TOptional<FString> Value = NullOpt);
+
+        /**
+         * Skip assets that only exist in memory and have not been saved.
+         *
+         * @return This query
+         */
+        FAssetQuery &OnDiskOnly();
+
+        /**
+         * Add a predicate that is run against each asset the registry yields. Predicates run in the order they were
+         * added, after the registry's own filtering, and an asset is only counted towards Take once it passes them all.
+         *
+         * @param Predicate The predicate to add
+         * @return This query
+         */
+        FAssetQuery &Where(TFunction<bool(const FAssetData &)> Predicate);
+
+        /**
+         * Stop the enumeration once this many assets have been produced.
+         *
+         * @param Count The maximum number of assets
+         * @return This query
+         */
+        FAssetQuery &Take(int32 Count);
+
+        /**
+         * Visit every matching asset. The callback returns whether to continue.
+         *
+         * @param Callback Called with each asset, return false to stop
+         * @return The number of assets passed to the callback
+         */
+        int32 ForEach(TFunctionRef<bool(const FAssetData &)> Callback) const;
+
+        /**
+         * Visit every matching asset.
+         *
+         * @param Callback Called with each asset
+         * @return The number of assets passed to the callback
+         */
+        template <std::invocable<const FAssetData &> F>
+            requires std::is_void_v<std::invoke_result_t<F, const FAssetData &>>
+        int32 ForEach(F &&Callback) const {
+            return ForEach([&Callback](const FAssetData &Asset) {
+                std::invoke(Callback, Asset);
+                return true;
+            });
+        }
+
+        /**
+         * Count the matching assets without copying any of them.
+         *
+         * @return The number of matching assets
+         */
+        int32 Count() const;
+
+        /**
+         * Find the first matching asset.
+         *
+         * @return A copy of the first asset, or unset if nothing matched
+         */
+        TOptional<FAssetData> First() const;
+
+        /**
+         * Copy the matching assets into an array, for when the results do need to outlive the enumeration.
+         *
+         * @return The matching assets
+         */
+        TArray<FAssetData> ToArray() const;
+
+        /**
+         * Get the filter that is handed to the registry.
+         *
+         * @return The filter
+         */
+        const FARFilter &GetFilter() const {
+            return Filter;
+        }
+
+      private:
+        IAssetRegistry *Registry;
+        FARFilter Filter;
+        TArray<TFunction<bool(const FAssetData &)>, TInlineAllocator<2>> Predicates;
+        int32 Limit = INDEX_NONE;
+    };
+} // namespace Retro::Ranges
@@ -0,0 +1,397 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+
+#include <Containers/Array.h>
+#include <HAL/UnrealMemory.h>
+#include <Misc/Optional.h>
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    /**
+     * Growable buffer that stores its elements in fixed size chunks, so that the address of an element never
+     * changes once it has been added. Chunk memory is retained when the buffer is reset, so refilling a buffer after
+     * invalidation does not go back to the allocator.
+     *
+     * @tparam T The element type
+     */
+    template <typename T>
+    class TStableChunkedBuffer {
+      public:
+        /**
+         * The number of elements stored in each chunk, targeting roughly 16KB per chunk.
+         */
+        static constexpr int32 ElementsPerChunk = sizeof(T) >= 16384 ? 1 : static_cast<int32>(16384 / sizeof(T));
+
+        TStableChunkedBuffer() = default;
+
+        TStableChunkedBuffer(const TStableChunkedBuffer &) = delete;
+
+        TStableChunkedBuffer(TStableChunkedBuffer &&Other) noexcept
+            : Chunks(std::move(Other.Chunks)), NumElements(Other.NumElements) {
+            Other.NumElements = 0;
+        }
+
+        ~TStableChunkedBuffer() {
+            Empty();
+        }
+
+        TStableChunkedBuffer &operator=(const TStableChunkedBuffer &) = delete;
+
+        TStableChunkedBuffer &operator=(TStableChunkedBuffer &&Other) noexcept {
+            if (this != &Other) {
+                Empty();
+                Chunks = std::move(Other.Chunks);
+                NumElements = Other.NumElements;
+                Other.NumElements = 0;
+            }
+
+            return *this;
+        }
+
+        /**
+         * Construct a new element at the end of the buffer.
+         *
+         * @param Args The arguments to forward to the constructor
+         * @return A reference to the new element, which will stay valid until the buffer is reset
+         */
+        template <typename... A>
+        T &Emplace(A &&...Args) {
+            int32 ChunkIndex = NumElements / ElementsPerChunk;
+            if (ChunkIndex == Chunks.Num()) {
+                Chunks.Add(static_cast<T *>(FMemory::Malloc(sizeof(T) * ElementsPerChunk, alignof(T))));
+            }
+
+            T *Result = new (Chunks[ChunkIndex] + NumElements % ElementsPerChunk) T(std::forward<A>(Args)...);
+            ++NumElements;
+            return *Result;
+        }
+
+        T &operator[](int32 Index) {
+            check(Index >= 0 && Index < NumElements);
+            return Chunks[Index / ElementsPerChunk][Index % ElementsPerChunk];
+        }
+
+        const T &operator[](int32 Index) const {
+            check(Index >= 0 && Index < NumElements);
+            return Chunks[Index / ElementsPerChunk][Index % ElementsPerChunk];
+        }
+
+        int32 Num() const {
+            return NumElements;
+        }
+
+        /**
+         * Destroy all elements, but keep the chunk memory around for reuse.
+         */
+        void Reset() {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (int32 i = 0; i < NumElements; i++) {
+                    (*this)[i].~T();
+                }
+            }
+            NumElements = 0;
+        }
+
+        /**
+         * Destroy all elements and release the chunk memory.
+         */
+        void Empty() {
+            Reset();
+            for (T *Chunk : Chunks) {
+                FMemory::Free(Chunk);
+            }
+            Chunks.Empty();
+        }
+
+      private:
+        TArray<T *> Chunks;
+        int32 NumElements = 0;
+    };
+
+    /**
+     * View that computes each element of the underlying range at most once. Elements are stored the first time
+     * they are reached, so later passes over the view (and random access lookups) read the stored values instead of
+     * re-running expensive stages such as a Transform. This also makes a single pass source like TClassView safe to
+     * iterate multiple times.
+     *
+     * The stored elements live at stable addresses, so references obtained from the view remain valid until the
+     * cache is invalidated. Because the view owns mutable state it cannot be copied, and any outstanding iterators
+     * are invalidated if the view is moved. The position in the underlying view cannot follow it across a move, so
+     * moving a partially cached view discards what was cached and restarts iteration on the next access, while a
+     * fully cached view keeps its elements.
+     *
+     * @tparam V The underlying view type
+     */
+    template <std::ranges::view V>
+        requires std::ranges::input_range<V>
+    class TCacheView : public std::ranges::view_interface<TCacheView<V>> {
+        using ValueType = std::ranges::range_value_t<V>;
+
+        class FIterator {
+          public:
+            using value_type = ValueType;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+
+            FIterator() = default;
+
+            FIterator(TCacheView &Owner, int32 Index) : Owner(&Owner), Index(Index) {
+            }
+
+            const ValueType &operator*() const {
+                return Owner->At(Index);
+            }
+
+            const ValueType *operator->() const {
+                return &Owner->At(Index);
+            }
+
+            const ValueType &operator[](difference_type Offset) const {
+                return Owner->At(Index + static_cast<int32>(Offset));
+            }
+
+            FIterator &operator++() {
+                ++Index;
+                return *this;
+            }
+
+            FIterator operator++(int) {
+                auto Tmp = *this;
+                ++Index;
+                return Tmp;
+            }
+
+            FIterator &operator--() {
+                --Index;
+                return *this;
+            }
+
+            FIterator operator--(int) {
+                auto Tmp = *this;
+                --Index;
+                return Tmp;
+            }
+
+            FIterator &operator+=(difference_type Offset) {
+                Index += static_cast<int32>(Offset);
+                return *this;
+            }
+
+            FIterator &operator-=(difference_type Offset) {
+                Index -= static_cast<int32>(Offset);
+                return *this;
+            }
+
+            FIterator operator+(difference_type Offset) const {
+                auto Tmp = *this;
+                Tmp += Offset;
+                return Tmp;
+            }
+
+            friend FIterator operator+(difference_type Offset, const FIterator &Other) {
+                return Other + Offset;
+            }
+
+            FIterator operator-(difference_type Offset) const {
+                auto Tmp = *this;
+                Tmp -= Offset;
+                return Tmp;
+            }
+
+            difference_type operator-(const FIterator &Other) const {
+                return Index - Other.Index;
+            }
+
+            bool operator==(const FIterator &Other) const {
+                return Index == Other.Index;
+            }
+
+            std::strong_ordering operator<=>(const FIterator &Other) const {
+                return Index <=> Other.Index;
+            }
+
+            bool operator==(std::default_sentinel_t) const {
+                return !Owner->CacheUpTo(Index);
+            }
+
+          private:
+            TCacheView *Owner = nullptr;
+            int32 Index = 0;
+        };
+
+      public:
+        TCacheView() = default;
+
+        /**
+         * Construct a new cache over the given view. Nothing is computed until the view is first iterated.
+         *
+         * @param Base The view to cache the results of
+         */
+        explicit TCacheView(V Base) : Base(std::move(Base)) {
+        }
+
+        TCacheView(const TCacheView &) = delete;
+
+        TCacheView(TCacheView &&Other) noexcept(std::is_nothrow_move_constructible_v<V>)
+            : Base(std::move(Other.Base)) {
+            MoveCacheFrom(Other);
+        }
+
+        ~TCacheView() = default;
+
+        TCacheView &operator=(const TCacheView &) = delete;
+
+        TCacheView &operator=(TCacheView &&Other) noexcept(std::is_nothrow_move_assignable_v<V>) {
+            if (this != &Other) {
+                Base = std::move(Other.Base);
+                Invalidate();
+                MoveCacheFrom(Other);
+            }
+
+            return *this;
+        }
+
+        FIterator begin() {
+            return FIterator(*this, 0);
+        }
+
+        std::default_sentinel_t end() {
+            return std::default_sentinel;
+        }
+
+        /**
+         * Get the element at the given position, computing it and all of the elements before it if they have not
+         * been reached yet.
+         *
+         * @param Index The position of the element
+         * @return A reference to the cached element
+         */
+        const ValueType &At(int32 Index) {
+            verify(CacheUpTo(Index));
+            return Cache[Index];
+        }
+
+        /**
+         * Check if the underlying view has an element at the given position, computing elements up to that point
+         * if needed.
+         *
+         * @param Index The position to check
+         * @return Is there an element at that position?
+         */
+        bool IsValidIndex(int32 Index) {
+            return Index >= 0 && CacheUpTo(Index);
+        }
+
+        /**
+         * Compute and store every remaining element of the underlying view.
+         *
+         * @return The total number of elements
+         */
+        int32 CacheAll() {
+            while (CacheUpTo(Cache.Num())) {
+            }
+
+            return Cache.Num();
+        }
+
+        /**
+         * Get the number of elements that have been computed so far.
+         *
+         * @return The number of cached elements
+         */
+        int32 NumCached() const {
+            return Cache.Num();
+        }
+
+        /**
+         * Check if the underlying view has been fully consumed.
+         *
+         * @return Have all elements been cached?
+         */
+        bool IsFullyCached() const {
+            return bExhausted;
+        }
+
+        /**
+         * Discard all cached elements. The next access will restart iteration of the underlying view, so this must
+         * be called whenever the inputs of the pipeline change. Any references previously obtained from the view
+         * are invalidated.
+         */
+        void Invalidate() {
+            Cache.Reset();
+            Current.Reset();
+            bExhausted = false;
+        }
+
+      private:
+        /**
+         * Take over the cached elements of a view whose base has just been moved into this one. The iterator into the
+         * underlying view still refers to the moved-from base, so it is never carried over, which means only a
+         * fully cached view can keep its elements.
+         */
+        void MoveCacheFrom(TCacheView &Other) {
+            if (Other.bExhausted) {
+                Cache = std::move(Other.Cache);
+                bExhausted = true;
+            }
+            Other.Invalidate();
+        }
+
+        bool CacheUpTo(int32 Index) {
+            while (Index >= Cache.Num()) {
+                if (bExhausted) {
+                    return false;
+                }
+
+                if (!Current.IsSet()) {
+                    Current.Emplace(std::ranges::begin(Base));
+                } else {
+                    ++*Current;
+                }
+
+                if (*Current == std::ranges::end(Base)) {
+                    bExhausted = true;
+                    return false;
+                }
+
+                Cache.Emplace(**Current);
+            }
+
+            return true;
+        }
+
+        V Base;
+        TOptional<std::ranges::iterator_t<V>> Current;
+        TStableChunkedBuffer<ValueType> Cache;
+        bool bExhausted = false;
+    };
+
+    template <typename R>
+    TCacheView(R &&) -> TCacheView<std::views::all_t<R>>;
+
+    namespace Views {
+        struct FCacheInvoker {
+            template <std::ranges::viewable_range R>
+                requires std::ranges::input_range<R>
+            constexpr auto operator()(R &&Range) const {
+                return TCacheView(std::forward<R>(Range));
+            }
+        };
+
+        /**
+         * Store each element of a pipeline the first time it is computed, so that later passes read the stored
+         * value instead of recomputing it.
+         */
+        constexpr auto Cache = ExtensionMethod<FCacheInvoker{}>;
+
+        /**
+         * Alias of Cache.
+         */
+        constexpr auto Memoize = Cache;
+    } // namespace Views
+} // namespace Retro::Ranges
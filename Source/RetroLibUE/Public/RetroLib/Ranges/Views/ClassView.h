@@ -2,6 +2,7 @@
 
 #include <UObject/UObjectIterator.h>
 #include "RetroLib/Concepts/Interfaces.h"
+#include "RetroLib/Profiling/Trace.h"
 
 namespace Retro::Ranges {
 	
@@ -16,10 +17,16 @@ namespace Retro::Ranges {
 				if constexpr (UnrealInterface<T>) {
 					while (Source && !Source->ImplementsInterface(typename T::UClassType::StaticClass())) {
 						++Source;
+#if RETROLIB_TRACE_ENABLED
+						Counters.Filter();
+#endif
 					}
 				} else {
 					while (Source && !Source->IsChildOf<T>()) {
 						++Source;
+#if RETROLIB_TRACE_ENABLED
+						Counters.Filter();
+#endif
 					}
 				}
 			}
@@ -45,7 +52,16 @@ namespace Retro::Ranges {
 			}
 
 			bool operator==(const std::default_sentinel_t&) const {
+#if RETROLIB_TRACE_ENABLED
+				if (!Source) {
+					Counters.End();
+					return true;
+				}
+
+				return false;
+#else
 				return !Source;
+#endif
 			}
 
 			FIterator &operator++() requires std::derived_from<T, UObject> {
@@ -54,7 +70,13 @@ namespace Retro::Ranges {
 					if (!Source || Source->IsChildOf<T>()) {
 						break;
 					}
+#if RETROLIB_TRACE_ENABLED
+					Counters.Filter();
+#endif
 				}
+#if RETROLIB_TRACE_ENABLED
+				Counters.Visit();
+#endif
 				
 				return *this;
 			}
@@ -65,7 +87,13 @@ namespace Retro::Ranges {
 					if (!Source || Source->ImplementsInterface(typename T::UClassType::StaticClass())) {
 						break;
 					}
+#if RETROLIB_TRACE_ENABLED
+					Counters.Filter();
+#endif
 				}
+#if RETROLIB_TRACE_ENABLED
+				Counters.Visit();
+#endif
 				
 				return *this;
 			}
@@ -75,6 +103,9 @@ namespace Retro::Ranges {
 			}
 
 		private:
+#if RETROLIB_TRACE_ENABLED
+			mutable Trace::FEnumerationCounters Counters;
+#endif
 			TObjectIterator<UClass> Source;
 		};
 		
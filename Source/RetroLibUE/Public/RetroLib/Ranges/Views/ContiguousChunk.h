@@ -0,0 +1,184 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+
+#include <Containers/ArrayView.h>
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    /**
+     * Concept for a range whose elements are laid out in one block of memory with a known length, such as a
+     * TArray, TArrayView or FString. Views that hand out sub-spans of the source require this.
+     *
+     * @tparam R The range type to check
+     */
+    template <typename R>
+    concept ContiguousSizedRange = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>;
+
+    /**
+     * Random access iterator that walks a block of memory in fixed size steps, yielding each step as a
+     * TArrayView. The final step is truncated to whatever is left over.
+     *
+     * @tparam T The element type of the underlying memory
+     */
+    template <typename T>
+    struct TChunkIterator {
+        using value_type = TArrayView<T>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+        constexpr TChunkIterator() = default;
+
+        constexpr TChunkIterator(T *Data, int32 Num, int32 ChunkSize, int32 Index)
+            : Data(Data), Num(Num), ChunkSize(ChunkSize), Index(Index) {
+        }
+
+        constexpr TArrayView<T> operator*() const {
+            int32 Offset = Index * ChunkSize;
+            return TArrayView<T>(Data + Offset, FMath::Min(ChunkSize, Num - Offset));
+        }
+
+        constexpr TArrayView<T> operator[](difference_type Offset) const {
+            return *(*this + Offset);
+        }
+
+        constexpr TChunkIterator &operator++() {
+            ++Index;
+            return *this;
+        }
+
+        constexpr TChunkIterator operator++(int) {
+            auto Tmp = *this;
+            ++Index;
+            return Tmp;
+        }
+
+        constexpr TChunkIterator &operator--() {
+            --Index;
+            return *this;
+        }
+
+        constexpr TChunkIterator operator--(int) {
+            auto Tmp = *this;
+            --Index;
+            return Tmp;
+        }
+
+        constexpr TChunkIterator &operator+=(difference_type Offset) {
+            Index += static_cast<int32>(Offset);
+            return *this;
+        }
+
+        constexpr TChunkIterator &operator-=(difference_type Offset) {
+            Index -= static_cast<int32>(Offset);
+            return *this;
+        }
+
+        constexpr TChunkIterator operator+(difference_type Offset) const {
+            auto Tmp = *this;
+            Tmp += Offset;
+            return Tmp;
+        }
+
+        constexpr friend TChunkIterator operator+(difference_type Offset, const TChunkIterator &Other) {
+            return Other + Offset;
+        }
+
+        constexpr TChunkIterator operator-(difference_type Offset) const {
+            auto Tmp = *this;
+            Tmp -= Offset;
+            return Tmp;
+        }
+
+        constexpr difference_type operator-(const TChunkIterator &Other) const {
+            return Index - Other.Index;
+        }
+
+        constexpr bool operator==(const TChunkIterator &Other) const {
+            return Index == Other.Index;
+        }
+
+        constexpr std::strong_ordering operator<=>(const TChunkIterator &Other) const {
+            return Index <=> Other.Index;
+        }
+
+      private:
+        T *Data = nullptr;
+        int32 Num = 0;
+        int32 ChunkSize = 1;
+        int32 Index = 0;
+    };
+
+    /**
+     * View that splits a contiguous range into consecutive sub-spans of a fixed size. Every chunk except possibly
+     * the last one contains exactly ChunkSize elements, and each one is handed out as a TArrayView so that
+     * hand-written kernels can operate on the raw memory.
+     *
+     * @tparam V The underlying view type
+     */
+    template <std::ranges::view V>
+        requires ContiguousSizedRange<V>
+    class TChunkView : public std::ranges::view_interface<TChunkView<V>> {
+        using ElementType = std::remove_reference_t<std::ranges::range_reference_t<V>>;
+
+      public:
+        TChunkView() = default;
+
+        /**
+         * Construct a new chunk view.
+         *
+         * @param Base The view to split up
+         * @param ChunkSize The number of elements in each chunk
+         */
+        constexpr TChunkView(V Base, int32 ChunkSize) : Base(std::move(Base)), ChunkSize(ChunkSize) {
+            check(ChunkSize > 0);
+        }
+
+        constexpr TChunkIterator<ElementType> begin() {
+            return TChunkIterator<ElementType>(std::ranges::data(Base), GetNum(), ChunkSize, 0);
+        }
+
+        constexpr TChunkIterator<ElementType> end() {
+            return TChunkIterator<ElementType>(std::ranges::data(Base), GetNum(), ChunkSize, NumChunks());
+        }
+
+        constexpr auto size() {
+            return static_cast<std::make_unsigned_t<int32>>(NumChunks());
+        }
+
+      private:
+        constexpr int32 GetNum() {
+            return static_cast<int32>(std::ranges::size(Base));
+        }
+
+        constexpr int32 NumChunks() {
+            return FMath::DivideAndRoundUp(GetNum(), ChunkSize);
+        }
+
+        V Base;
+        int32 ChunkSize = 1;
+    };
+
+    template <typename R>
+    TChunkView(R &&, int32) -> TChunkView<std::views::all_t<R>>;
+
+    namespace Views {
+        struct FChunkInvoker {
+            template <std::ranges::viewable_range R>
+                requires ContiguousSizedRange<R>
+            constexpr auto operator()(R &&Range, int32 ChunkSize) const {
+                return TChunkView(std::forward<R>(Range), ChunkSize);
+            }
+        };
+
+        /**
+         * Split a contiguous range into TArrayView chunks of the given size, with a shorter chunk at the end for
+         * any leftover elements.
+         */
+        constexpr auto Chunk = ExtensionMethod<FChunkInvoker{}>;
+    } // namespace Views
+} // namespace Retro::Ranges
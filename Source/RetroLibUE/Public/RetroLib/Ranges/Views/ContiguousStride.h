@@ -0,0 +1,166 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Ranges/Views/ContiguousChunk.h"
+
+namespace Retro::Ranges {
+
+    /**
+     * Random access iterator that visits every Nth element in a block of memory.
+     *
+     * @tparam T The element type of the underlying memory
+     */
+    template <typename T>
+    struct TStrideIterator {
+        using value_type = std::remove_cv_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr TStrideIterator() = default;
+
+        constexpr TStrideIterator(T *Data, int32 Stride, int32 Index) : Data(Data), Stride(Stride), Index(Index) {
+        }
+
+        constexpr T &operator*() const {
+            return Data[Index * Stride];
+        }
+
+        constexpr T *operator->() const {
+            return Data + Index * Stride;
+        }
+
+        constexpr T &operator[](difference_type Offset) const {
+            return Data[(Index + Offset) * Stride];
+        }
+
+        constexpr TStrideIterator &operator++() {
+            ++Index;
+            return *this;
+        }
+
+        constexpr TStrideIterator operator++(int) {
+            auto Tmp = *this;
+            ++Index;
+            return Tmp;
+        }
+
+        constexpr TStrideIterator &operator--() {
+            --Index;
+            return *this;
+        }
+
+        constexpr TStrideIterator operator--(int) {
+            auto Tmp = *this;
+            --Index;
+            return Tmp;
+        }
+
+        constexpr TStrideIterator &operator+=(difference_type Offset) {
+            Index += static_cast<int32>(Offset);
+            return *this;
+        }
+
+        constexpr TStrideIterator &operator-=(difference_type Offset) {
+            Index -= static_cast<int32>(Offset);
+            return *this;
+        }
+
+        constexpr TStrideIterator operator+(difference_type Offset) const {
+            auto Tmp = *this;
+            Tmp += Offset;
+            return Tmp;
+        }
+
+        constexpr friend TStrideIterator operator+(difference_type Offset, const TStrideIterator &Other) {
+            return Other + Offset;
+        }
+
+        constexpr TStrideIterator operator-(difference_type Offset) const {
+            auto Tmp = *this;
+            Tmp -= Offset;
+            return Tmp;
+        }
+
+        constexpr difference_type operator-(const TStrideIterator &Other) const {
+            return Index - Other.Index;
+        }
+
+        constexpr bool operator==(const TStrideIterator &Other) const {
+            return Index == Other.Index;
+        }
+
+        constexpr std::strong_ordering operator<=>(const TStrideIterator &Other) const {
+            return Index <=> Other.Index;
+        }
+
+      private:
+        T *Data = nullptr;
+        int32 Stride = 1;
+        int32 Index = 0;
+    };
+
+    /**
+     * View over every Nth element of a contiguous range, starting with the first one. Because the source is
+     * contiguous the view is random access and knows its size up front, unlike a generic stride adaptor that has
+     * to step through the source one element at a time.
+     *
+     * @tparam V The underlying view type
+     */
+    template <std::ranges::view V>
+        requires ContiguousSizedRange<V>
+    class TStrideView : public std::ranges::view_interface<TStrideView<V>> {
+        using ElementType = std::remove_reference_t<std::ranges::range_reference_t<V>>;
+
+      public:
+        TStrideView() = default;
+
+        /**
+         * Construct a new stride view.
+         *
+         * @param Base The view to step through
+         * @param Stride The distance between consecutive elements of the view
+         */
+        constexpr TStrideView(V Base, int32 Stride) : Base(std::move(Base)), Stride(Stride) {
+            check(Stride > 0);
+        }
+
+        constexpr TStrideIterator<ElementType> begin() {
+            return TStrideIterator<ElementType>(std::ranges::data(Base), Stride, 0);
+        }
+
+        constexpr TStrideIterator<ElementType> end() {
+            return TStrideIterator<ElementType>(std::ranges::data(Base), Stride, GetNum());
+        }
+
+        constexpr auto size() {
+            return static_cast<std::make_unsigned_t<int32>>(GetNum());
+        }
+
+      private:
+        constexpr int32 GetNum() {
+            return FMath::DivideAndRoundUp(static_cast<int32>(std::ranges::size(Base)), Stride);
+        }
+
+        V Base;
+        int32 Stride = 1;
+    };
+
+    template <typename R>
+    TStrideView(R &&, int32) -> TStrideView<std::views::all_t<R>>;
+
+    namespace Views {
+        struct FStrideInvoker {
+            template <std::ranges::viewable_range R>
+                requires ContiguousSizedRange<R>
+            constexpr auto operator()(R &&Range, int32 Stride) const {
+                return TStrideView(std::forward<R>(Range), Stride);
+            }
+        };
+
+        /**
+         * Visit every Nth element of a contiguous range.
+         */
+        constexpr auto Stride = ExtensionMethod<FStrideInvoker{}>;
+    } // namespace Views
+} // namespace Retro::Ranges
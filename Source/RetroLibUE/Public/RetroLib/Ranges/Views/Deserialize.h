@@ -0,0 +1,180 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Ranges/Concepts/Serialization.h"
+
+#include <Containers/Array.h>
+
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    /**
+     * Input range that reads elements out of an archive on demand, in the layout written by SerializeTo or by
+     * operator<< on a TArray. Only the count is read up front. Bulk serializable elements are then read a chunk at a
+     * time with a single Serialize call, everything else one element at a time, so at most one chunk is ever held in
+     * memory however many elements the archive holds. A corrupt count therefore cannot trigger a huge allocation, and
+     * one that runs past the end of the archive sets the archive's error flag and ends the range early.
+     *
+     * The view is single pass and the iterators refer back to it, so it must not be moved once iteration has started.
+     *
+     * @tparam T The element type
+     */
+    template <ArchiveSerializable T>
+    class TDeserializeView : public std::ranges::view_interface<TDeserializeView<T>> {
+      public:
+        class FIterator {
+          public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::input_iterator_tag;
+
+            FIterator() = default;
+
+            explicit FIterator(TDeserializeView &View) : View(&View) {
+            }
+
+            /**
+             * The element is owned by the view until the iterator is advanced, so it can be moved out.
+             */
+            T &operator*() const {
+                return View->Buffer[View->Index];
+            }
+
+            FIterator &operator++() {
+                View->Advance();
+                return *this;
+            }
+
+            void operator++(int) {
+                ++*this;
+            }
+
+            friend bool operator==(const FIterator &Iterator, std::default_sentinel_t) {
+                return Iterator.IsEnd();
+            }
+
+          private:
+            bool IsEnd() const {
+                return View->Index >= View->Buffer.Num();
+            }
+
+            TDeserializeView *View = nullptr;
+        };
+
+        TDeserializeView() = default;
+
+        /**
+         * Read the element count from the archive. The elements themselves are not read until the view is iterated.
+         *
+         * @param Ar The archive to read from, which must be loading
+         */
+        explicit TDeserializeView(FArchive &Ar) : Ar(&Ar) {
+            check(Ar.IsLoading());
+            Ar << Num;
+            if (Num < 0 || Ar.IsError()) {
+                Ar.SetError();
+                Num = 0;
+            }
+
+            if constexpr (BulkSerializable<T>) {
+                int64 TotalSize = Ar.TotalSize();
+                int64 NumBytes = static_cast<int64>(Num) * static_cast<int64>(sizeof(T));
+                if (TotalSize != INDEX_NONE && NumBytes > TotalSize - Ar.Tell()) {
+                    Ar.SetError();
+                    Num = 0;
+                }
+            }
+            Remaining = Num;
+        }
+
+        TDeserializeView(const TDeserializeView &) = delete;
+        TDeserializeView(TDeserializeView &&) = default;
+
+        TDeserializeView &operator=(const TDeserializeView &) = delete;
+        TDeserializeView &operator=(TDeserializeView &&) = default;
+
+        FIterator begin() {
+            if (!bStarted) {
+                bStarted = true;
+                Refill();
+            }
+            return FIterator(*this);
+        }
+
+        std::default_sentinel_t end() const {
+            return std::default_sentinel;
+        }
+
+        /**
+         * Get the number of elements stored in the archive, which lets terminal operations reserve storage up front.
+         * Fewer may be produced if the archive runs out of data.
+         *
+         * @return The element count read from the archive
+         */
+        int32 GetSizeHint() const {
+            return Num;
+        }
+
+      private:
+        void Advance() {
+            if (++Index >= Buffer.Num()) {
+                Refill();
+            }
+        }
+
+        void Refill() {
+            Index = 0;
+            Buffer.Reset();
+            if (Remaining == 0 || Ar->IsError()) {
+                return;
+            }
+
+            if constexpr (BulkSerializable<T>) {
+                if (!Ar->IsByteSwapping()) {
+                    int32 Count = FMath::Min(Remaining, SerializationChunkSize<T>);
+                    Buffer.SetNumUninitialized(Count);
+                    Ar->Serialize(Buffer.GetData(), Count * sizeof(T));
+                    Remaining -= Count;
+                    if (Ar->IsError()) {
+                        Buffer.Reset();
+                    }
+                    return;
+                }
+            }
+
+            *Ar << Buffer.Emplace_GetRef();
+            Remaining--;
+            if (Ar->IsError()) {
+                Buffer.Reset();
+            }
+        }
+
+        FArchive *Ar = nullptr;
+        int32 Num = 0;
+        int32 Remaining = 0;
+        int32 Index = 0;
+        bool bStarted = false;
+        TArray<T> Buffer;
+    };
+
+    namespace Views {
+        /**
+         * Lazily read a range of elements from an archive, in the layout written by SerializeTo or by operator<< on a
+         * TArray. Elements can be filtered or transformed as they are read without materializing the whole array.
+         *
+         *     TArray<FGuid> Kept = Retro::Ranges::Views::Deserialize<FGuid>(Reader)
+         *         | std::views::filter([&](const FGuid &Id) { return Live.Contains(Id); })
+         *         | Retro::Ranges::ToArray();
+         *
+         * @tparam T The element type
+         * @param Ar The archive to read from, which must be loading and outlive the view
+         * @return The view over the elements
+         */
+        template <ArchiveSerializable T>
+        TDeserializeView<T> Deserialize(FArchive &Ar) {
+            return TDeserializeView<T>(Ar);
+        }
+    } // namespace Views
+} // namespace Retro::Ranges
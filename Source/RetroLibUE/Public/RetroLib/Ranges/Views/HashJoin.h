@@ -0,0 +1,583 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Profiling/MemoryTracking.h"
+#include "RetroLib/Profiling/Trace.h"
+#include "RetroLib/Ranges/Concepts/SizeHint.h"
+
+#include <Containers/Array.h>
+#include <Templates/Tuple.h>
+
+#include <functional>
+#include <ranges>
+#include <type_traits>
+
+namespace Retro::Ranges {
+
+    /**
+     * Concept for a range that a join can build its hash table over. The table points at the elements rather than
+     * copying them, so the range must be multi-pass and produce references.
+     *
+     * @tparam R The range type to check
+     */
+    template <typename R>
+    concept JoinBuildRange =
+        std::ranges::forward_range<R> && std::is_lvalue_reference_v<std::ranges::range_reference_t<R>>;
+
+    /**
+     * Concept for an associative container that a join can look keys up in directly, such as TMap, TSortedMap or TSet,
+     * instead of building a table of its own.
+     *
+     * @tparam M The container type to check
+     */
+    template <typename M>
+    concept JoinLookupContainer = requires(M &Container, typename std::remove_cvref_t<M>::KeyInitType Key) {
+        requires std::is_pointer_v<decltype(Container.Find(Key))>;
+    };
+
+    /**
+     * Open addressing hash table over the build side of a join. Slots hold the hash of their key and the first and
+     * last element with that key, and elements with equal keys are chained in their original order, so the table
+     * costs two pointers' worth of memory per element and a lookup reads one contiguous run of slots.
+     *
+     * @tparam T The element type of the build side
+     * @tparam J The projection from an element to its key
+     */
+    template <typename T, typename J>
+    class THashJoinTable {
+        struct FSlot {
+            uint32 Hash = 0;
+            int32 Head = INDEX_NONE;
+            int32 Tail = INDEX_NONE;
+        };
+
+      public:
+        using FReference = T &;
+        using FCursor = int32;
+        static constexpr bool bUniqueKeys = false;
+
+        THashJoinTable() = default;
+
+        template <JoinBuildRange R>
+        THashJoinTable(R &Range, J Projection) : Projection(std::move(Projection)) {
+            RETROLIB_TRACE_SCOPE(TEXT("Retro::Ranges::HashJoinTable"));
+            RETROLIB_LLM_SCOPE();
+            if (int32 SizeHint = GetSizeHint(Range); SizeHint > 0) {
+                Elements.Reserve(SizeHint);
+            }
+
+            for (T &Element : Range) {
+                Elements.Add(&Element);
+            }
+
+            // A load factor of at most one half keeps the probe sequences short
+            uint32 NumSlots = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(Elements.Num() * 2, 8)));
+            Shift = 32 - FMath::FloorLog2(NumSlots);
+            Slots.SetNum(NumSlots);
+            Next.Init(INDEX_NONE, Elements.Num());
+            RETROLIB_TRACE_COUNTER_ADD(ElementsVisited, Elements.Num());
+            RETROLIB_TRACE_COUNTER_ADD(BytesAllocated, Elements.GetAllocatedSize() + Slots.GetAllocatedSize() +
+                                                           Next.GetAllocatedSize());
+
+            for (int32 i = 0; i < Elements.Num(); i++) {
+                const auto &Key = std::invoke(this->Projection, *Elements[i]);
+                uint32 Hash = GetTypeHash(Key);
+                FSlot &Slot = Slots[FindSlot(Key, Hash)];
+                if (Slot.Head == INDEX_NONE) {
+                    Slot.Hash = Hash;
+                    Slot.Head = i;
+                } else {
+                    Next[Slot.Tail] = i;
+                }
+                Slot.Tail = i;
+            }
+        }
+
+        template <typename K>
+        int32 FindFirst(const K &Key) const {
+            return Slots[FindSlot(Key, GetTypeHash(Key))].Head;
+        }
+
+        int32 FindNext(int32 Cursor) const {
+            return Next[Cursor];
+        }
+
+        static bool IsValid(int32 Cursor) {
+            return Cursor != INDEX_NONE;
+        }
+
+        T &Get(int32 Cursor) const {
+            return *Elements[Cursor];
+        }
+
+      private:
+        template <typename K>
+        int32 FindSlot(const K &Key, uint32 Hash) const {
+            // GetTypeHash is the identity for integers, so spread the keys with a multiplicative hash before masking
+            uint32 Mask = static_cast<uint32>(Slots.Num()) - 1;
+            for (uint32 Index = (Hash * 0x9E3779B9u) >> Shift;; Index = (Index + 1) & Mask) {
+                const FSlot &Slot = Slots[Index];
+                if (Slot.Head == INDEX_NONE ||
+                    (Slot.Hash == Hash && std::invoke(Projection, *Elements[Slot.Head]) == Key)) {
+                    return static_cast<int32>(Index);
+                }
+            }
+        }
+
+        TArray<FSlot> Slots;
+        TArray<int32> Next;
+        TArray<T *> Elements;
+        uint32 Shift = 32;
+        J Projection;
+    };
+
+    /**
+     * Adapts an existing associative container to the interface of THashJoinTable, so that a join can probe a TMap or
+     * TSet that is already being maintained instead of building a copy of it. Keys are unique, so every lookup yields
+     * at most one match.
+     *
+     * @tparam M The container type
+     */
+    template <JoinLookupContainer M>
+    class TLookupJoinTable {
+        using FKeyInit = typename std::remove_cvref_t<M>::KeyInitType;
+
+      public:
+        using FCursor = decltype(std::declval<M &>().Find(std::declval<FKeyInit>()));
+        using FReference = std::remove_pointer_t<FCursor> &;
+        static constexpr bool bUniqueKeys = true;
+
+        TLookupJoinTable() = default;
+
+        explicit TLookupJoinTable(M &Container) : Container(&Container) {
+        }
+
+        template <typename K>
+        FCursor FindFirst(const K &Key) const {
+            return Container->Find(Key);
+        }
+
+        static FCursor FindNext(FCursor) {
+            return nullptr;
+        }
+
+        static bool IsValid(FCursor Cursor) {
+            return Cursor != nullptr;
+        }
+
+        static FReference Get(FCursor Cursor) {
+            return *Cursor;
+        }
+
+      private:
+        M *Container = nullptr;
+    };
+
+    /**
+     * View that streams the probe side of an inner join, yielding a tuple of references to the probe element and to
+     * each build element with the same key. The probe side is walked lazily and only once, and matches come out in
+     * probe order, with the matches for a single probe element in build order.
+     *
+     * @tparam V The underlying view of the probe side
+     * @tparam T The table the build side is held in
+     * @tparam J The projection from a probe element to its key
+     */
+    template <std::ranges::view V, typename T, typename J>
+        requires std::ranges::input_range<V>
+    class THashJoinView : public std::ranges::view_interface<THashJoinView<V, T, J>> {
+        using FBaseIterator = std::ranges::iterator_t<V>;
+        using FBaseSentinel = std::ranges::sentinel_t<V>;
+        using FCursor = typename T::FCursor;
+
+      public:
+        using FReference = TTuple<std::ranges::range_reference_t<V>, typename T::FReference>;
+
+        struct FIterator {
+            using value_type = FReference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept =
+                std::conditional_t<std::ranges::forward_range<V>, std::forward_iterator_tag, std::input_iterator_tag>;
+            using iterator_category = std::input_iterator_tag;
+
+            FIterator() = default;
+
+            FIterator(const THashJoinView &Parent, FBaseIterator Current, FBaseSentinel End)
+                : Parent(&Parent), Current(std::move(Current)), End(std::move(End)) {
+                Satisfy();
+            }
+
+            FReference operator*() const {
+                return FReference(*Current, Parent->Table.Get(Cursor));
+            }
+
+            FIterator &operator++() {
+                Cursor = Parent->Table.FindNext(Cursor);
+                if (!T::IsValid(Cursor)) {
+                    ++Current;
+                    Satisfy();
+                }
+                return *this;
+            }
+
+            FIterator operator++(int)
+                requires std::ranges::forward_range<V>
+            {
+                auto Copy = *this;
+                ++*this;
+                return Copy;
+            }
+
+            void operator++(int)
+                requires(!std::ranges::forward_range<V>)
+            {
+                ++*this;
+            }
+
+            friend bool operator==(const FIterator &LHS, const FIterator &RHS)
+                requires std::ranges::forward_range<V>
+            {
+                return LHS.Current == RHS.Current && LHS.Cursor == RHS.Cursor;
+            }
+
+            friend bool operator==(const FIterator &Iterator, std::default_sentinel_t) {
+                return Iterator.Current == Iterator.End;
+            }
+
+          private:
+            void Satisfy() {
+                for (; Current != End; ++Current) {
+                    Cursor = Parent->Table.FindFirst(std::invoke(Parent->Projection, *Current));
+                    if (T::IsValid(Cursor)) {
+                        return;
+                    }
+                }
+            }
+
+            const THashJoinView *Parent = nullptr;
+            FBaseIterator Current = FBaseIterator();
+            FBaseSentinel End = FBaseSentinel();
+            FCursor Cursor = FCursor();
+        };
+
+        THashJoinView() = default;
+
+        THashJoinView(V Base, T Table, J Projection)
+            : Base(std::move(Base)), Table(std::move(Table)), Projection(std::move(Projection)) {
+        }
+
+        FIterator begin() {
+            return FIterator(*this, std::ranges::begin(Base), std::ranges::end(Base));
+        }
+
+        std::default_sentinel_t end() {
+            return std::default_sentinel;
+        }
+
+        /**
+         * Get the number of probe elements. This bounds the size of the view when every key on the build side is
+         * unique, as it is when looking up into a TMap or TSet.
+         *
+         * @return The number of elements on the probe side
+         */
+        int32 GetSizeHint()
+            requires std::ranges::sized_range<V> && T::bUniqueKeys
+        {
+            return static_cast<int32>(std::ranges::size(Base));
+        }
+
+      private:
+        V Base;
+        T Table;
+        J Projection;
+    };
+
+    template <typename R, typename T, typename J>
+    THashJoinView(R &&, T, J) -> THashJoinView<std::views::all_t<R>, T, J>;
+
+    /**
+     * View over the elements of the probe side of a join that have a match on the build side, or with bAnti set, the
+     * ones that do not. Each probe element is yielded at most once however many matches it has.
+     *
+     * @tparam V The underlying view of the probe side
+     * @tparam T The table the build side is held in
+     * @tparam J The projection from a probe element to its key
+     * @tparam bAnti Whether to keep the elements without a match instead of the ones with one
+     */
+    template <std::ranges::view V, typename T, typename J, bool bAnti>
+        requires std::ranges::input_range<V>
+    class TSemiJoinView : public std::ranges::view_interface<TSemiJoinView<V, T, J, bAnti>> {
+        using FBaseIterator = std::ranges::iterator_t<V>;
+        using FBaseSentinel = std::ranges::sentinel_t<V>;
+
+      public:
+        struct FIterator {
+            using value_type = std::ranges::range_value_t<V>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept =
+                std::conditional_t<std::ranges::forward_range<V>, std::forward_iterator_tag, std::input_iterator_tag>;
+            using iterator_category = std::input_iterator_tag;
+
+            FIterator() = default;
+
+            FIterator(const TSemiJoinView &Parent, FBaseIterator Current, FBaseSentinel End)
+                : Parent(&Parent), Current(std::move(Current)), End(std::move(End)) {
+                Satisfy();
+            }
+
+            std::ranges::range_reference_t<V> operator*() const {
+                return *Current;
+            }
+
+            FIterator &operator++() {
+                ++Current;
+                Satisfy();
+                return *this;
+            }
+
+            FIterator operator++(int)
+                requires std::ranges::forward_range<V>
+            {
+                auto Copy = *this;
+                ++*this;
+                return Copy;
+            }
+
+            void operator++(int)
+                requires(!std::ranges::forward_range<V>)
+            {
+                ++*this;
+            }
+
+            friend bool operator==(const FIterator &LHS, const FIterator &RHS)
+                requires std::ranges::forward_range<V>
+            {
+                return LHS.Current == RHS.Current;
+            }
+
+            friend bool operator==(const FIterator &Iterator, std::default_sentinel_t) {
+                return Iterator.Current == Iterator.End;
+            }
+
+          private:
+            void Satisfy() {
+                for (; Current != End; ++Current) {
+                    bool bMatched = T::IsValid(Parent->Table.FindFirst(std::invoke(Parent->Projection, *Current)));
+                    if (bMatched != bAnti) {
+                        return;
+                    }
+                }
+            }
+
+            const TSemiJoinView *Parent = nullptr;
+            FBaseIterator Current = FBaseIterator();
+            FBaseSentinel End = FBaseSentinel();
+        };
+
+        TSemiJoinView() = default;
+
+        TSemiJoinView(V Base, T Table, J Projection)
+            : Base(std::move(Base)), Table(std::move(Table)), Projection(std::move(Projection)) {
+        }
+
+        FIterator begin() {
+            return FIterator(*this, std::ranges::begin(Base), std::ranges::end(Base));
+        }
+
+        std::default_sentinel_t end() {
+            return std::default_sentinel;
+        }
+
+        /**
+         * Get the number of probe elements, which is an upper bound on the size of the view.
+         *
+         * @return The number of elements on the probe side
+         */
+        int32 GetSizeHint()
+            requires std::ranges::sized_range<V>
+        {
+            return static_cast<int32>(std::ranges::size(Base));
+        }
+
+      private:
+        V Base;
+        T Table;
+        J Projection;
+    };
+
+    namespace Private {
+        template <typename R, typename J>
+        using THashJoinTableFor = THashJoinTable<std::remove_reference_t<std::ranges::range_reference_t<R>>, J>;
+
+        template <typename R, typename J>
+        concept ProbeKeySelector =
+            std::ranges::input_range<R> && std::invocable<const J &, std::ranges::range_reference_t<R>>;
+
+        template <typename B, typename J>
+        concept BuildKeySelector = std::invocable<const J &, std::ranges::range_reference_t<B>>;
+
+        /**
+         * A key selector is never a range, which is what tells the pipe form of the range joins apart from the direct
+         * form of the container joins when both are given three arguments.
+         */
+        template <typename J>
+        concept KeySelector = !std::ranges::range<J>;
+    } // namespace Private
+
+    namespace Views {
+        struct FHashJoinInvoker {
+            template <std::ranges::viewable_range P, JoinBuildRange B, typename JP, typename JB>
+                requires Private::ProbeKeySelector<P, JP> && Private::BuildKeySelector<B, JB>
+            auto operator()(P &&Probe, B *Build, JP ProbeKey, JB BuildKey) const {
+                using FTable = Private::THashJoinTableFor<B, JB>;
+                return THashJoinView(std::forward<P>(Probe), FTable(*Build, std::move(BuildKey)), std::move(ProbeKey));
+            }
+        };
+
+        /**
+         * Inner join of two ranges on equal keys. A compact hash table is built over the build side when the view is
+         * created, and the probe side is then streamed lazily, yielding a tuple of references to the probe element
+         * and each matching build element:
+         *
+         *     for (auto [Actor, Record] : Retro::Ranges::Views::HashJoin(Actors, Records, &AActor::GetFName,
+         *                                                                 &FComponentRecord::OwnerName)) { ... }
+         *
+         * The table costs memory proportional to the build side and the output follows the order of the probe side,
+         * so pass the smaller data set as the build side. The build side must outlive the view. Keys are compared with
+         * operator== and hashed with GetTypeHash, and the two key selectors may return different types as long as
+         * equal keys hash the same.
+         *
+         * @param Probe The range to stream
+         * @param Build The range to build the table over
+         * @param ProbeKey Selects the key of a probe element
+         * @param BuildKey Selects the key of a build element
+         * @return The joined view
+         */
+        template <std::ranges::viewable_range P, JoinBuildRange B, typename JP, typename JB>
+        auto HashJoin(P &&Probe, B &Build, JP ProbeKey, JB BuildKey) {
+            return FHashJoinInvoker()(std::forward<P>(Probe), &Build, std::move(ProbeKey), std::move(BuildKey));
+        }
+
+        template <JoinBuildRange B, Private::KeySelector JP, typename JB>
+        auto HashJoin(B &Build, JP ProbeKey, JB BuildKey) {
+            return ExtensionMethod<FHashJoinInvoker{}>(&Build, std::move(ProbeKey), std::move(BuildKey));
+        }
+
+        struct FLookupJoinInvoker {
+            template <std::ranges::viewable_range P, JoinLookupContainer M, typename JP>
+                requires Private::ProbeKeySelector<P, JP>
+            auto operator()(P &&Probe, M *Container, JP ProbeKey) const {
+                return THashJoinView(std::forward<P>(Probe), TLookupJoinTable<M>(*Container), std::move(ProbeKey));
+            }
+        };
+
+        /**
+         * Join a range against an existing TMap, TSortedMap or TSet by looking each key up in it, yielding a tuple of
+         * the probe element and a reference to the matching value. Elements without a match are skipped. This is
+         * the join to use when the build side is already indexed, as nothing needs to be built.
+         *
+         *     for (auto [Actor, Stats] : Actors | Retro::Ranges::Views::LookupJoin(StatsByName, &AActor::GetFName))
+         *
+         * @param Probe The range to stream
+         * @param Container The container to look keys up in, which must outlive the view
+         * @param ProbeKey Selects the key of a probe element
+         * @return The joined view
+         */
+        template <std::ranges::viewable_range P, JoinLookupContainer M, typename JP>
+        auto LookupJoin(P &&Probe, M &Container, JP ProbeKey) {
+            return FLookupJoinInvoker()(std::forward<P>(Probe), &Container, std::move(ProbeKey));
+        }
+
+        template <JoinLookupContainer M, typename JP>
+        auto LookupJoin(M &Container, JP ProbeKey) {
+            return ExtensionMethod<FLookupJoinInvoker{}>(&Container, std::move(ProbeKey));
+        }
+
+        template <bool bAnti>
+        struct TSemiJoinInvoker {
+            template <std::ranges::viewable_range P, JoinBuildRange B, typename JP, typename JB>
+                requires Private::ProbeKeySelector<P, JP> && Private::BuildKeySelector<B, JB>
+            auto operator()(P &&Probe, B *Build, JP ProbeKey, JB BuildKey) const {
+                using FTable = Private::THashJoinTableFor<B, JB>;
+                return TSemiJoinView<std::views::all_t<P>, FTable, JP, bAnti>(
+                    std::views::all(std::forward<P>(Probe)), FTable(*Build, std::move(BuildKey)), std::move(ProbeKey));
+            }
+
+            template <std::ranges::viewable_range P, JoinLookupContainer M, typename JP>
+                requires Private::ProbeKeySelector<P, JP>
+            auto operator()(P &&Probe, M *Container, JP ProbeKey) const {
+                return TSemiJoinView<std::views::all_t<P>, TLookupJoinTable<M>, JP, bAnti>(
+                    std::views::all(std::forward<P>(Probe)), TLookupJoinTable<M>(*Container), std::move(ProbeKey));
+            }
+        };
+
+        /**
+         * Keep the elements of a range whose key has a match on the build side, which is either another range or an
+         * existing TMap, TSortedMap or TSet. Each element is kept once regardless of how many matches it has.
+         *
+         *     auto Owned = Actors | Retro::Ranges::Views::SemiJoin(Records, &AActor::GetFName,
+         *                                                         &FComponentRecord::OwnerName);
+         *     auto Tagged = Actors | Retro::Ranges::Views::SemiJoin(TaggedNames, &AActor::GetFName);
+         *
+         * @param Probe The range to filter
+         * @param Build The range or container holding the keys to match, which must outlive the view
+         * @param ProbeKey Selects the key of a probe element
+         * @param BuildKey Selects the key of a build element, when the build side is a range
+         * @return The filtered view
+         */
+        template <std::ranges::viewable_range P, JoinBuildRange B, typename JP, typename JB>
+        auto SemiJoin(P &&Probe, B &Build, JP ProbeKey, JB BuildKey) {
+            return TSemiJoinInvoker<false>()(std::forward<P>(Probe), &Build, std::move(ProbeKey),
+                                            std::move(BuildKey));
+        }
+
+        template <JoinBuildRange B, Private::KeySelector JP, typename JB>
+        auto SemiJoin(B &Build, JP ProbeKey, JB BuildKey) {
+            return ExtensionMethod<TSemiJoinInvoker<false>{}>(&Build, std::move(ProbeKey), std::move(BuildKey));
+        }
+
+        template <std::ranges::viewable_range P, JoinLookupContainer M, typename JP>
+        auto SemiJoin(P &&Probe, M &Container, JP ProbeKey) {
+            return TSemiJoinInvoker<false>()(std::forward<P>(Probe), &Container, std::move(ProbeKey));
+        }
+
+        template <JoinLookupContainer M, typename JP>
+        auto SemiJoin(M &Container, JP ProbeKey) {
+            return ExtensionMethod<TSemiJoinInvoker<false>{}>(&Container, std::move(ProbeKey));
+        }
+
+        /**
+         * Keep the elements of a range whose key has no match on the build side, which is either another range or an
+         * existing TMap, TSortedMap or TSet. Takes the same arguments as SemiJoin.
+         *
+         *     auto Orphans = Records | Retro::Ranges::Views::AntiJoin(ActorsByName, &FComponentRecord::OwnerName);
+         *
+         * @param Probe The range to filter
+         * @param Build The range or container holding the keys to exclude, which must outlive the view
+         * @param ProbeKey Selects the key of a probe element
+         * @param BuildKey Selects the key of a build element, when the build side is a range
+         * @return The filtered view
+         */
+        template <std::ranges::viewable_range P, JoinBuildRange B, typename JP, typename JB>
+        auto AntiJoin(P &&Probe, B &Build, JP ProbeKey, JB BuildKey) {
+            return TSemiJoinInvoker<true>()(std::forward<P>(Probe), &Build, std::move(ProbeKey),
+                                            std::move(BuildKey));
+        }
+
+        template <JoinBuildRange B, Private::KeySelector JP, typename JB>
+        auto AntiJoin(B &Build, JP ProbeKey, JB BuildKey) {
+            return ExtensionMethod<TSemiJoinInvoker<true>{}>(&Build, std::move(ProbeKey), std::move(BuildKey));
+        }
+
+        template <std::ranges::viewable_range P, JoinLookupContainer M, typename JP>
+        auto AntiJoin(P &&Probe, M &Container, JP ProbeKey) {
+            return TSemiJoinInvoker<true>()(std::forward<P>(Probe), &Container, std::move(ProbeKey));
+        }
+
+        template <JoinLookupContainer M, typename JP>
+        auto AntiJoin(M &Container, JP ProbeKey) {
+            return ExtensionMethod<TSemiJoinInvoker<true>{}>(&Container, std::move(ProbeKey));
+        }
+    } // namespace Views
+} // namespace Retro::Ranges
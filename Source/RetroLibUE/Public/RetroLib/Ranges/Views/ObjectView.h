@@ -3,6 +3,7 @@
 #pragma once
 
 #include <UObject/UObjectIterator.h>
+#include "RetroLib/Profiling/Trace.h"
 
 namespace Retro::Ranges {
 	
@@ -31,19 +32,34 @@ namespace Retro::Ranges {
 			}
 
 			bool operator==(const std::default_sentinel_t&) const {
+#if RETROLIB_TRACE_ENABLED
+				if (!Source) {
+					Counters.End();
+					return true;
+				}
+
+				return false;
+#else
 				return !Source;
+#endif
 			}
 
 			FIterator &operator++() {
 				++Source;
+#if RETROLIB_TRACE_ENABLED
+				Counters.Visit();
+#endif
 				return *this;
 			}
 
 			void operator++(int) {
-				++Source;
+				++*this;
 			}
 
 		private:
+#if RETROLIB_TRACE_ENABLED
+			mutable Trace::FEnumerationCounters Counters;
+#endif
 			TObjectIterator<T> Source;
 		};
 		
@@ -0,0 +1,263 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Templates/SharedPointer.h>
+#include <UObject/UnrealType.h>
+
+namespace Retro::Ranges {
+
+    /**
+     * A single entry in a flattened property layout. Static arrays are expanded so that each element has its own
+     * entry.
+     */
+    struct FPropertyLayoutEntry {
+        /**
+         * The property this entry belongs to.
+         */
+        FProperty *Property;
+
+        /**
+         * The offset of the value from the start of the container.
+         */
+        int32 Offset;
+
+        /**
+         * The size of the value in bytes.
+         */
+        int32 ElementSize;
+    };
+
+    /**
+     * Flat table of the properties of a UStruct that match a given property class. Walking the table avoids the
+     * linked list traversal and per-property CastField checks done by TFieldIterator.
+     *
+     * Layouts are built lazily the first time a struct is queried and shared between all callers. The cached layout is
+     * rebuilt if the struct's property chain or size has changed since it was built, and the whole cache is dropped
+     * when objects are reinstanced or code is reloaded.
+     */
+    class RETROLIBUE_API FPropertyLayout {
+      public:
+        explicit FPropertyLayout(const UStruct *Struct, FFieldClass *PropertyClass, EFieldIterationFlags Flags);
+
+        /**
+         * Get the cached layout for a struct, building it if required.
+         *
+         * @param Struct The struct to get the properties of
+         * @param PropertyClass Only properties of this class or its subclasses are included
+         * @param Flags The flags that control which properties are visited, as with TFieldIterator
+         * @return The layout of the struct
+         */
+        static TSharedRef<const FPropertyLayout> Get(const UStruct *Struct, FFieldClass *PropertyClass,
+                                                     EFieldIterationFlags Flags = EFieldIterationFlags::Default);
+
+        /**
+         * Drop every cached layout for the given struct.
+         *
+         * @param Struct The struct whose layouts are no longer valid
+         */
+        static void Invalidate(const UStruct *Struct);
+
+        /**
+         * Drop every cached layout.
+         */
+        static void InvalidateAll();
+
+        /**
+         * Get the entries of the layout in the order TFieldIterator would visit them.
+         *
+         * @return The layout entries
+         */
+        TConstArrayView<FPropertyLayoutEntry> GetEntries() const {
+            return Entries;
+        }
+
+        /**
+         * Check if the layout still matches the current state of the struct.
+         *
+         * @param Struct The struct to compare against
+         * @return Is the layout still valid for the struct
+         */
+        bool Matches(const UStruct *Struct) const;
+
+      private:
+        TArray<FPropertyLayoutEntry> Entries;
+        TWeakObjectPtr<const UStruct> Owner;
+        const FField *ChildProperties;
+        const FProperty *PropertyLink;
+        int32 PropertiesSize;
+    };
+
+    /**
+     * A property paired with the address of its value within a container.
+     *
+     * @tparam P The type of property
+     * @tparam bConst Is the container const
+     */
+    template <typename P, bool bConst>
+    struct TPropertyValue {
+        using FValuePtr = std::conditional_t<bConst, const void *, void *>;
+
+        P *Property;
+        FValuePtr ValuePtr;
+
+        /**
+         * Get the value as a typed pointer.
+         *
+         * @tparam T The type of the value, must match the property
+         * @return The typed value pointer
+         */
+        template <typename T>
+        auto GetValuePtr() const {
+            using FTarget = std::conditional_t<bConst, const T, T>;
+            return static_cast<FTarget *>(ValuePtr);
+        }
+    };
+
+    /**
+     * View over the properties of a struct or object instance that are of the given property type. Each element is a
+     * TPropertyValue holding the already cast property and a pointer to its value inside the instance, with static
+     * array properties producing one element per array index.
+     *
+     * @tparam P The type of property to visit, FProperty visits every property
+     * @tparam bConst Is the instance being viewed const
+     */
+    template <typename P = FProperty, bool bConst = false>
+        requires std::derived_from<P, FProperty>
+    class TPropertyView : public std::ranges::view_interface<TPropertyView<P, bConst>> {
+        using FContainerPtr = std::conditional_t<bConst, const uint8 *, uint8 *>;
+
+      public:
+        using FValue = TPropertyValue<P, bConst>;
+
+        struct FIterator {
+            using value_type = FValue;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+
+            FIterator() = default;
+
+            FIterator(const FPropertyLayoutEntry *Entry, FContainerPtr Container) : Entry(Entry), Container(Container) {
+            }
+
+            FValue operator*() const {
+                return FValue{static_cast<P *>(Entry->Property), Container + Entry->Offset};
+            }
+
+            FValue operator[](difference_type Offset) const {
+                return *(*this + Offset);
+            }
+
+            FIterator &operator++() {
+                ++Entry;
+                return *this;
+            }
+
+            FIterator operator++(int) {
+                auto Copy = *this;
+                ++Entry;
+                return Copy;
+            }
+
+            FIterator &operator--() {
+                --Entry;
+                return *this;
+            }
+
+            FIterator operator--(int) {
+                auto Copy = *this;
+                --Entry;
+                return Copy;
+            }
+
+            FIterator &operator+=(difference_type Offset) {
+                Entry += Offset;
+                return *this;
+            }
+
+            FIterator &operator-=(difference_type Offset) {
+                Entry -= Offset;
+                return *this;
+            }
+
+            friend FIterator operator+(FIterator Iterator, difference_type Offset) {
+                return Iterator += Offset;
+            }
+
+            friend FIterator operator+(difference_type Offset, FIterator Iterator) {
+                return Iterator += Offset;
+            }
+
+            friend FIterator operator-(FIterator Iterator, difference_type Offset) {
+                return Iterator -= Offset;
+            }
+
+            friend difference_type operator-(const FIterator &LHS, const FIterator &RHS) {
+                return LHS.Entry - RHS.Entry;
+            }
+
+            friend bool operator==(const FIterator &LHS, const FIterator &RHS) {
+                return LHS.Entry == RHS.Entry;
+            }
+
+            friend auto operator<=>(const FIterator &LHS, const FIterator &RHS) {
+                return LHS.Entry <=> RHS.Entry;
+            }
+
+          private:
+            const FPropertyLayoutEntry *Entry = nullptr;
+            FContainerPtr Container = nullptr;
+        };
+
+        TPropertyView() = default;
+
+        /**
+         * Create a view over the properties of a struct instance.
+         *
+         * @param Struct The type of the instance
+         * @param Container The instance itself
+         * @param Flags The flags that control which properties are visited
+         */
+        TPropertyView(const UStruct *Struct, std::conditional_t<bConst, const void *, void *> Container,
+                      EFieldIterationFlags Flags = EFieldIterationFlags::Default)
+            : Layout(FPropertyLayout::Get(Struct, P::StaticClass(), Flags).ToSharedPtr()),
+              Container(static_cast<FContainerPtr>(Container)) {
+        }
+
+        /**
+         * Create a view over the properties of an object.
+         *
+         * @param Object The object to view
+         * @param Flags The flags that control which properties are visited
+         */
+        explicit TPropertyView(std::conditional_t<bConst, const UObject *, UObject *> Object,
+                               EFieldIterationFlags Flags = EFieldIterationFlags::Default)
+            : TPropertyView(Object->GetClass(), Object, Flags) {
+        }
+
+        FIterator begin() const {
+            return FIterator(Layout->GetEntries().GetData(), Container);
+        }
+
+        FIterator end() const {
+            return FIterator(Layout->GetEntries().GetData() + Layout->GetEntries().Num(), Container);
+        }
+
+        size_t size() const {
+            return static_cast<size_t>(Layout->GetEntries().Num());
+        }
+
+      private:
+        TSharedPtr<const FPropertyLayout> Layout;
+        FContainerPtr Container = nullptr;
+    };
+
+    /**
+     * View over the properties of a const struct or object instance.
+     *
+     * @tparam P The type of property to visit
+     */
+    template <typename P = FProperty>
+    using TConstPropertyView = TPropertyView<P, true>;
+} // namespace Retro::Ranges
@@ -0,0 +1,155 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+
+#include <ranges>
+
+namespace Retro::Ranges {
+
+    /**
+     * Concept for a weak handle that can be resolved to a raw pointer through Get(), such as TWeakObjectPtr or
+     * TWeakInterfacePtr. A stale handle resolves to nullptr.
+     *
+     * @tparam T The handle type to check
+     */
+    template <typename T>
+    concept WeakHandle = requires(const std::remove_cvref_t<T> &Handle) {
+        { Handle.Get() } -> std::convertible_to<const volatile void *>;
+    };
+
+    /**
+     * The pointer type produced by resolving a weak handle.
+     *
+     * @tparam T The handle type
+     */
+    template <WeakHandle T>
+    using TResolvedPointer = decltype(std::declval<const std::remove_cvref_t<T> &>().Get());
+
+    /**
+     * View that resolves a range of weak handles and skips over the ones that have gone stale. Each handle is
+     * resolved exactly once as the view is walked, unlike a Transform followed by a Filter on nullptr, which has to
+     * resolve each handle once for the predicate and again when the element is read.
+     *
+     * @tparam V The underlying view of weak handles
+     */
+    template <std::ranges::view V>
+        requires std::ranges::input_range<V> && WeakHandle<std::ranges::range_reference_t<V>>
+    class TResolveWeakView : public std::ranges::view_interface<TResolveWeakView<V>> {
+        using FPointer = TResolvedPointer<std::ranges::range_reference_t<V>>;
+        using FBaseIterator = std::ranges::iterator_t<V>;
+        using FBaseSentinel = std::ranges::sentinel_t<V>;
+
+      public:
+        struct FIterator {
+            using value_type = FPointer;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept =
+                std::conditional_t<std::ranges::forward_range<V>, std::forward_iterator_tag, std::input_iterator_tag>;
+            using iterator_category = std::input_iterator_tag;
+
+            FIterator() = default;
+
+            FIterator(FBaseIterator Current, FBaseSentinel End) : Current(std::move(Current)), End(std::move(End)) {
+                Resolve();
+            }
+
+            FPointer operator*() const {
+                return Resolved;
+            }
+
+            FIterator &operator++() {
+                ++Current;
+                Resolve();
+                return *this;
+            }
+
+            FIterator operator++(int)
+                requires std::ranges::forward_range<V>
+            {
+                auto Copy = *this;
+                ++*this;
+                return Copy;
+            }
+
+            void operator++(int)
+                requires(!std::ranges::forward_range<V>)
+            {
+                ++*this;
+            }
+
+            friend bool operator==(const FIterator &LHS, const FIterator &RHS)
+                requires std::ranges::forward_range<V>
+            {
+                return LHS.Current == RHS.Current;
+            }
+
+            friend bool operator==(const FIterator &Iterator, std::default_sentinel_t) {
+                return Iterator.Current == Iterator.End;
+            }
+
+          private:
+            void Resolve() {
+                for (; Current != End; ++Current) {
+                    Resolved = (*Current).Get();
+                    if (Resolved != nullptr) {
+                        return;
+                    }
+                }
+
+                Resolved = nullptr;
+            }
+
+            FBaseIterator Current = FBaseIterator();
+            FBaseSentinel End = FBaseSentinel();
+            FPointer Resolved = nullptr;
+        };
+
+        TResolveWeakView() = default;
+
+        explicit TResolveWeakView(V Base) : Base(std::move(Base)) {
+        }
+
+        FIterator begin() {
+            return FIterator(std::ranges::begin(Base), std::ranges::end(Base));
+        }
+
+        std::default_sentinel_t end() {
+            return std::default_sentinel;
+        }
+
+        /**
+         * Get the number of handles in the underlying range. This is an upper bound on the size of the view.
+         *
+         * @return The number of handles to be resolved
+         */
+        int32 GetSizeHint()
+            requires std::ranges::sized_range<V>
+        {
+            return static_cast<int32>(std::ranges::size(Base));
+        }
+
+      private:
+        V Base;
+    };
+
+    template <typename R>
+    TResolveWeakView(R &&) -> TResolveWeakView<std::views::all_t<R>>;
+
+    namespace Views {
+        struct FResolveWeakInvoker {
+            template <std::ranges::viewable_range R>
+                requires WeakHandle<std::ranges::range_reference_t<R>>
+            constexpr auto operator()(R &&Range) const {
+                return TResolveWeakView(std::forward<R>(Range));
+            }
+        };
+
+        /**
+         * Resolve a range of weak handles into the raw pointers of the objects that are still alive, dropping any
+         * stale entries.
+         */
+        constexpr auto ResolveWeak = ExtensionMethod<FResolveWeakInvoker{}>;
+    } // namespace Views
+} // namespace Retro::Ranges
@@ -0,0 +1,359 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+
+#include <Containers/BitArray.h>
+
+#include <ranges>
+#include <tuple>
+
+namespace Retro::Ranges {
+
+    /**
+     * Concept for anything that can be read as a sequence of 64 bit words, such as a TBitArray or a lazy combination
+     * of several of them. Reading a word past the end must return zero, and the bits of the last word past NumBits must
+     * be zero, so that sources of different lengths can be combined without special cases.
+     *
+     * @tparam T The type to check
+     */
+    template <typename T>
+    concept BitWordSource = std::copyable<T> && requires(const T &Source, int32 WordIndex) {
+        { Source.NumBits() } -> std::convertible_to<int32>;
+        { Source.GetWord(WordIndex) } -> std::same_as<uint64>;
+    };
+
+    /**
+     * Get the number of 64 bit words that cover a number of bits.
+     *
+     * @param NumBits The number of bits
+     * @return The number of words
+     */
+    constexpr int32 GetNumBitWords(int32 NumBits) {
+        return (NumBits + 63) / 64;
+    }
+
+    /**
+     * Reads the storage of a TBitArray 64 bits at a time.
+     *
+     * @tparam A The allocator of the bit array
+     */
+    template <typename A>
+    class TBitArrayWordSource {
+      public:
+        TBitArrayWordSource() = default;
+
+        explicit TBitArrayWordSource(const TBitArray<A> &Bits) : Bits(&Bits) {
+        }
+
+        int32 NumBits() const {
+            return Bits != nullptr ? Bits->Num() : 0;
+        }
+
+        uint64 GetWord(int32 WordIndex) const {
+            int32 Num = NumBits();
+            int32 FirstBit = WordIndex * 64;
+            if (FirstBit >= Num) {
+                return 0;
+            }
+
+            // The array is stored as 32 bit words, so a 64 bit word is stitched together from up to two of them
+            const uint32 *Data = Bits->GetData();
+            int32 NumDWords = FMath::DivideAndRoundUp(Num, NumBitsPerDWORD);
+            int32 Low = WordIndex * 2;
+            uint64 Word = Data[Low];
+            if (Low + 1 < NumDWords) {
+                Word |= static_cast<uint64>(Data[Low + 1]) << 32;
+            }
+
+            // Mask off the slack at the end of the last word rather than relying on it being cleared
+            if (int32 Remaining = Num - FirstBit; Remaining < 64) {
+                Word &= (uint64(1) << Remaining) - 1;
+            }
+            return Word;
+        }
+
+      private:
+        const TBitArray<A> *Bits = nullptr;
+    };
+
+    /**
+     * Range over the indices of the set bits of a word source. Each word is read once and its set bits are visited by
+     * repeatedly taking the count of trailing zeros and clearing the lowest bit, so runs of zero bits cost nothing
+     * beyond the load of their word. The view is itself a word source, so it can be fed into further combinations.
+     *
+     * @tparam S The word source
+     */
+    template <BitWordSource S>
+    class TSetBitsView : public std::ranges::view_interface<TSetBitsView<S>> {
+      public:
+        struct FIterator {
+            using value_type = int32;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+            FIterator() = default;
+
+            explicit FIterator(const S &Source) : Source(&Source), NumWords(GetNumBitWords(Source.NumBits())) {
+                Advance();
+            }
+
+            int32 operator*() const {
+                return WordIndex * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Word));
+            }
+
+            FIterator &operator++() {
+                Word &= Word - 1;
+                if (Word == 0) {
+                    Advance();
+                }
+                return *this;
+            }
+
+            FIterator operator++(int) {
+                auto Copy = *this;
+                ++*this;
+                return Copy;
+            }
+
+            friend bool operator==(const FIterator &LHS, const FIterator &RHS) {
+                return LHS.WordIndex == RHS.WordIndex && LHS.Word == RHS.Word;
+            }
+
+            friend bool operator==(const FIterator &Iterator, std::default_sentinel_t) {
+                return Iterator.Word == 0;
+            }
+
+          private:
+            void Advance() {
+                while (++WordIndex < NumWords) {
+                    Word = Source->GetWord(WordIndex);
+                    if (Word != 0) {
+                        return;
+                    }
+                }
+                Word = 0;
+            }
+
+            const S *Source = nullptr;
+            int32 NumWords = 0;
+            int32 WordIndex = -1;
+            uint64 Word = 0;
+        };
+
+        TSetBitsView() = default;
+
+        explicit TSetBitsView(S Source) : Source(std::move(Source)) {
+        }
+
+        FIterator begin() const {
+            return FIterator(Source);
+        }
+
+        std::default_sentinel_t end() const {
+            return std::default_sentinel;
+        }
+
+        int32 NumBits() const {
+            return Source.NumBits();
+        }
+
+        uint64 GetWord(int32 WordIndex) const {
+            return Source.GetWord(WordIndex);
+        }
+
+        /**
+         * Count the set bits a word at a time, without visiting them.
+         *
+         * @return The number of set bits
+         */
+        int32 CountSetBits() const {
+            int32 Count = 0;
+            int32 NumWords = GetNumBitWords(Source.NumBits());
+            for (int32 i = 0; i < NumWords; i++) {
+                Count += static_cast<int32>(FMath::CountBits(Source.GetWord(i)));
+            }
+            return Count;
+        }
+
+        const S &GetSource() const {
+            return Source;
+        }
+
+      private:
+        S Source;
+    };
+
+    /**
+     * Lazily combines several word sources with a bitwise operation, one word at a time. Nothing is materialized, so a
+     * combination of any number of masks costs a single pass over their words.
+     *
+     * @tparam O The operation
+     * @tparam S The word sources
+     */
+    template <typename O, BitWordSource... S>
+    class TBitCombineSource {
+      public:
+        TBitCombineSource() = default;
+
+        explicit TBitCombineSource(S... Sources) : Sources(std::move(Sources)...) {
+        }
+
+        int32 NumBits() const {
+            return std::apply([](const S &...Source) { return O::NumBits(Source.NumBits()...); }, Sources);
+        }
+
+        uint64 GetWord(int32 WordIndex) const {
+            return std::apply([WordIndex](const S &...Source) { return O::Combine(Source.GetWord(WordIndex)...); },
+                              Sources);
+        }
+
+      private:
+        std::tuple<S...> Sources;
+    };
+
+    struct FBitAndOp {
+        template <typename... T>
+        static constexpr int32 NumBits(int32 First, T... Rest) {
+            int32 Result = First;
+            ((Result = FMath::Min(Result, static_cast<int32>(Rest))), ...);
+            return Result;
+        }
+
+        template <typename... T>
+        static constexpr uint64 Combine(T... Words) {
+            return (Words & ...);
+        }
+    };
+
+    struct FBitOrOp {
+        template <typename... T>
+        static constexpr int32 NumBits(T... Nums) {
+            int32 Result = 0;
+            ((Result = FMath::Max(Result, static_cast<int32>(Nums))), ...);
+            return Result;
+        }
+
+        template <typename... T>
+        static constexpr uint64 Combine(T... Words) {
+            return (Words | ...);
+        }
+    };
+
+    struct FBitXorOp : FBitOrOp {
+        template <typename... T>
+        static constexpr uint64 Combine(T... Words) {
+            return (Words ^ ...);
+        }
+    };
+
+    struct FBitAndNotOp {
+        template <typename... T>
+        static constexpr int32 NumBits(int32 First, T...) {
+            return First;
+        }
+
+        template <typename... T>
+        static constexpr uint64 Combine(uint64 First, T... Rest) {
+            return First & ~(uint64(0) | ... | Rest);
+        }
+    };
+
+    /**
+     * Get the word source for a bit array, or for something that already is one.
+     *
+     * @param Bits The bit array or word source
+     * @return The word source
+     */
+    template <typename A>
+    TBitArrayWordSource<A> AsBitWordSource(const TBitArray<A> &Bits) {
+        return TBitArrayWordSource<A>(Bits);
+    }
+
+    template <typename A>
+    void AsBitWordSource(const TBitArray<A> &&Bits) = delete;
+
+    template <BitWordSource S>
+    S AsBitWordSource(const TSetBitsView<S> &View) {
+        return View.GetSource();
+    }
+
+    template <BitWordSource S>
+    S AsBitWordSource(const S &Source) {
+        return Source;
+    }
+
+    template <typename T>
+    concept BitOperand = requires(T &&Operand) { AsBitWordSource(std::forward<T>(Operand)); };
+
+    namespace Views {
+        struct FSetBitsInvoker {
+            template <BitOperand T>
+            auto operator()(T &&Bits) const {
+                return TSetBitsView(AsBitWordSource(std::forward<T>(Bits)));
+            }
+        };
+
+        /**
+         * View the indices of the set bits of a TBitArray, in increasing order. This replaces walking the array with
+         * TConstSetBitIterator, which tests one bit at a time.
+         */
+        constexpr auto SetBits = ExtensionMethod<FSetBitsInvoker{}>;
+
+        /**
+         * Combine bit arrays, or other bit views, with a lazy AND. The result is as long as the shortest operand.
+         *
+         *     for (int32 Entity : Retro::Ranges::Views::BitAnd(HasTransform, HasHealth, IsVisible)) { ... }
+         *
+         * @param Operands The bit arrays to combine, which must outlive the view
+         * @return A view over the set bits of the combination
+         */
+        template <BitOperand... T>
+            requires(sizeof...(T) >= 2)
+        auto BitAnd(T &&...Operands) {
+            return TSetBitsView(TBitCombineSource<FBitAndOp, decltype(AsBitWordSource(std::forward<T>(Operands)))...>(
+                AsBitWordSource(std::forward<T>(Operands))...));
+        }
+
+        /**
+         * Combine bit arrays, or other bit views, with a lazy OR. The result is as long as the longest operand.
+         *
+         * @param Operands The bit arrays to combine, which must outlive the view
+         * @return A view over the set bits of the combination
+         */
+        template <BitOperand... T>
+            requires(sizeof...(T) >= 2)
+        auto BitOr(T &&...Operands) {
+            return TSetBitsView(TBitCombineSource<FBitOrOp, decltype(AsBitWordSource(std::forward<T>(Operands)))...>(
+                AsBitWordSource(std::forward<T>(Operands))...));
+        }
+
+        /**
+         * Combine bit arrays, or other bit views, with a lazy XOR. The result is as long as the longest operand.
+         *
+         * @param Operands The bit arrays to combine, which must outlive the view
+         * @return A view over the set bits of the combination
+         */
+        template <BitOperand... T>
+            requires(sizeof...(T) >= 2)
+        auto BitXor(T &&...Operands) {
+            return TSetBitsView(TBitCombineSource<FBitXorOp, decltype(AsBitWordSource(std::forward<T>(Operands)))...>(
+                AsBitWordSource(std::forward<T>(Operands))...));
+        }
+
+        /**
+         * Take the bits of the first operand that are not set in any of the others. The result is as long as the
+         * first operand.
+         *
+         * @param Operands The bit arrays to combine, which must outlive the view
+         * @return A view over the set bits of the combination
+         */
+        template <BitOperand... T>
+            requires(sizeof...(T) >= 2)
+        auto BitAndNot(T &&...Operands) {
+            return TSetBitsView(TBitCombineSource<FBitAndNotOp, decltype(AsBitWordSource(std::forward<T>(Operands)))...>(
+                AsBitWordSource(std::forward<T>(Operands))...));
+        }
+    } // namespace Views
+} // namespace Retro::Ranges
@@ -0,0 +1,126 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Ranges/Views/ContiguousChunk.h"
+
+namespace Retro::Ranges {
+
+    /**
+     * View that splits a contiguous range into batches of exactly W elements for use with SIMD kernels.
+     *
+     * The range is divided into three parts:
+     * - A scalar head that covers the elements up to the first address aligned to the batch width.
+     * - A body of full W-wide batches that all start on an aligned address. Iterating the view visits these.
+     * - A scalar tail with the fewer than W elements left over after the last full batch.
+     *
+     * When the batch width in bytes is not a power of two, or the data is not aligned to its own element size, no
+     * alignment is possible and the head will always be empty.
+     *
+     * @tparam V The underlying view type
+     * @tparam W The number of elements in each batch
+     */
+    template <std::ranges::view V, int32 W>
+        requires ContiguousSizedRange<V> && (W > 0)
+    class TSimdBatchView : public std::ranges::view_interface<TSimdBatchView<V, W>> {
+        using ElementType = std::remove_reference_t<std::ranges::range_reference_t<V>>;
+
+      public:
+        /**
+         * The alignment in bytes that each batch in the body will start on.
+         */
+        static constexpr SIZE_T BatchAlignment = FMath::IsPowerOfTwo(W * sizeof(ElementType))
+                                                     ? FMath::Min<SIZE_T>(W * sizeof(ElementType), 64)
+                                                     : alignof(ElementType);
+
+        TSimdBatchView() = default;
+
+        /**
+         * Construct a new batch view.
+         *
+         * @param Base The view to split up
+         */
+        constexpr explicit TSimdBatchView(V Base) : Base(std::move(Base)) {
+            int32 Num = static_cast<int32>(std::ranges::size(this->Base));
+            auto Address = reinterpret_cast<UPTRINT>(std::ranges::data(this->Base));
+            if (Address % alignof(ElementType) == 0) {
+                SIZE_T Misalignment = Address % BatchAlignment;
+                if (Misalignment != 0) {
+                    HeadNum = FMath::Min(static_cast<int32>((BatchAlignment - Misalignment) / sizeof(ElementType)), Num);
+                }
+            }
+
+            NumBatches = (Num - HeadNum) / W;
+            TailNum = Num - HeadNum - NumBatches * W;
+        }
+
+        constexpr TChunkIterator<ElementType> begin() {
+            return TChunkIterator<ElementType>(GetBodyData(), NumBatches * W, W, 0);
+        }
+
+        constexpr TChunkIterator<ElementType> end() {
+            return TChunkIterator<ElementType>(GetBodyData(), NumBatches * W, W, NumBatches);
+        }
+
+        constexpr auto size() const {
+            return static_cast<std::make_unsigned_t<int32>>(NumBatches);
+        }
+
+        /**
+         * Get the scalar elements that come before the first aligned batch.
+         *
+         * @return The unaligned head of the range
+         */
+        constexpr TArrayView<ElementType> GetHead() {
+            return TArrayView<ElementType>(std::ranges::data(Base), HeadNum);
+        }
+
+        /**
+         * Get all full batches as one span.
+         *
+         * @return The aligned body of the range
+         */
+        constexpr TArrayView<ElementType> GetBody() {
+            return TArrayView<ElementType>(GetBodyData(), NumBatches * W);
+        }
+
+        /**
+         * Get the scalar elements that are left over after the last full batch.
+         *
+         * @return The tail of the range
+         */
+        constexpr TArrayView<ElementType> GetTail() {
+            return TArrayView<ElementType>(GetBodyData() + NumBatches * W, TailNum);
+        }
+
+      private:
+        constexpr ElementType *GetBodyData() {
+            return std::ranges::data(Base) + HeadNum;
+        }
+
+        V Base;
+        int32 HeadNum = 0;
+        int32 NumBatches = 0;
+        int32 TailNum = 0;
+    };
+
+    namespace Views {
+        template <int32 W>
+        struct TSimdBatchesInvoker {
+            template <std::ranges::viewable_range R>
+                requires ContiguousSizedRange<R>
+            constexpr auto operator()(R &&Range) const {
+                return TSimdBatchView<std::views::all_t<R>, W>(std::views::all(std::forward<R>(Range)));
+            }
+        };
+
+        /**
+         * Split a contiguous range into aligned batches of W elements, with the unaligned head and leftover tail
+         * accessible separately through GetHead() and GetTail().
+         *
+         * @tparam W The number of elements in each batch
+         */
+        template <int32 W>
+        constexpr auto SimdBatches = ExtensionMethod<TSimdBatchesInvoker<W>{}>;
+    } // namespace Views
+} // namespace Retro::Ranges
@@ -0,0 +1,596 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Ranges/Concepts/SizeHint.h"
+
+#include <Containers/Array.h>
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+
+namespace Retro::Ranges {
+
+    /**
+     * The operations that can be computed in a single linear walk over two sorted ranges.
+     */
+    enum class ESortedSetOperation : uint8 {
+        /**
+         * Every element of both ranges, with equivalent elements from the first range ahead of the second.
+         */
+        Merge,
+
+        /**
+         * Every element that is in either range. An element that appears m times in the first range and n times in the
+         * second appears max(m, n) times, taken from the first range where possible.
+         */
+        Union,
+
+        /**
+         * Every element of the first range that also is in the second, min(m, n) times.
+         */
+        Intersection,
+
+        /**
+         * Every element of the first range that is not in the second, max(m - n, 0) times.
+         */
+        Difference,
+
+        /**
+         * Every element that is in exactly one of the ranges, |m - n| times.
+         */
+        SymmetricDifference
+    };
+
+    namespace Private {
+        template <typename R>
+        concept BoundedRange = std::ranges::sized_range<R> || HasSizeHint<R>;
+
+        /**
+         * Operations whose output only ever comes from the first range, and so can yield its references unchanged.
+         */
+        constexpr bool OutputsFirstOnly(ESortedSetOperation Operation) {
+            return Operation == ESortedSetOperation::Intersection || Operation == ESortedSetOperation::Difference;
+        }
+    } // namespace Private
+
+    /**
+     * Lazy view of a set operation between two ranges that are sorted by the same predicate. Both ranges are walked
+     * once, in O(n + m) comparisons. Where the operation drops a run of elements from one side, as intersections and
+     * differences do, random access inputs skip the run with a galloping search instead, so joining a short range
+     * with a very long one costs O(n log(m / n)).
+     *
+     * @tparam Operation The operation to compute
+     * @tparam V1 The first sorted view
+     * @tparam V2 The second sorted view
+     * @tparam P The less-than predicate both views are sorted by
+     * @tparam J The projection applied to elements of both views before comparing
+     */
+    template <ESortedSetOperation Operation, std::ranges::view V1, std::ranges::view V2, typename P, typename J>
+        requires std::ranges::input_range<V1> && std::ranges::input_range<V2>
+    class TSortedSetOperationView
+        : public std::ranges::view_interface<TSortedSetOperationView<Operation, V1, V2, P, J>> {
+        using FIterator1 = std::ranges::iterator_t<V1>;
+        using FSentinel1 = std::ranges::sentinel_t<V1>;
+        using FIterator2 = std::ranges::iterator_t<V2>;
+        using FSentinel2 = std::ranges::sentinel_t<V2>;
+
+        static constexpr bool bForward = std::ranges::forward_range<V1> && std::ranges::forward_range<V2>;
+
+      public:
+        using FReference =
+            std::conditional_t<Private::OutputsFirstOnly(Operation), std::ranges::range_reference_t<V1>,
+                               std::common_reference_t<std::ranges::range_reference_t<V1>,
+                                                       std::ranges::range_reference_t<V2>>>;
+        using FValue = std::conditional_t<Private::OutputsFirstOnly(Operation), std::ranges::range_value_t<V1>,
+                                          std::common_type_t<std::ranges::range_value_t<V1>,
+                                                             std::ranges::range_value_t<V2>>>;
+
+        struct FIterator {
+            using value_type = FValue;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::conditional_t<bForward, std::forward_iterator_tag, std::input_iterator_tag>;
+            using iterator_category = std::input_iterator_tag;
+
+            FIterator() = default;
+
+            FIterator(const TSortedSetOperationView &Parent, FIterator1 Current1, FSentinel1 End1, FIterator2 Current2,
+                      FSentinel2 End2)
+                : Parent(&Parent), Current1(std::move(Current1)), End1(std::move(End1)), Current2(std::move(Current2)),
+                  End2(std::move(End2)) {
+                Satisfy();
+            }
+
+            FReference operator*() const {
+                if constexpr (Private::OutputsFirstOnly(Operation)) {
+                    return *Current1;
+                } else {
+                    return bFromSecond ? static_cast<FReference>(*Current2) : static_cast<FReference>(*Current1);
+                }
+            }
+
+            FIterator &operator++() {
+                if constexpr (Operation == ESortedSetOperation::Intersection) {
+                    ++Current1;
+                    ++Current2;
+                } else if constexpr (Operation == ESortedSetOperation::Difference) {
+                    ++Current1;
+                } else {
+                    if (bFromSecond) {
+                        ++Current2;
+                    } else {
+                        ++Current1;
+                        if (bBoth) {
+                            ++Current2;
+                        }
+                    }
+                }
+
+                Satisfy();
+                return *this;
+            }
+
+            FIterator operator++(int)
+                requires bForward
+            {
+                auto Copy = *this;
+                ++*this;
+                return Copy;
+            }
+
+            void operator++(int)
+                requires(!bForward)
+            {
+                ++*this;
+            }
+
+            friend bool operator==(const FIterator &LHS, const FIterator &RHS)
+                requires bForward
+            {
+                return LHS.Current1 == RHS.Current1 && LHS.Current2 == RHS.Current2;
+            }
+
+            friend bool operator==(const FIterator &Iterator, std::default_sentinel_t) {
+                return Iterator.IsEnd();
+            }
+
+          private:
+            bool IsEnd() const {
+                if constexpr (Operation == ESortedSetOperation::Intersection) {
+                    return Current1 == End1 || Current2 == End2;
+                } else if constexpr (Operation == ESortedSetOperation::Difference) {
+                    return Current1 == End1;
+                } else {
+                    return Current1 == End1 && Current2 == End2;
+                }
+            }
+
+            template <typename L, typename R>
+            bool Less(L &&Lhs, R &&Rhs) const {
+                return std::invoke(Parent->Predicate, std::invoke(Parent->Projection, std::forward<L>(Lhs)),
+                                   std::invoke(Parent->Projection, std::forward<R>(Rhs)));
+            }
+
+            /**
+             * Advance past every element that is less than the bound, knowing that the current one is. Random access
+             * ranges probe exponentially growing distances ahead and then binary search the last step, which takes
+             * O(log d) comparisons to skip d elements.
+             */
+            template <typename I, typename S, typename T>
+            void SkipLess(I &Current, const S &End, const T &Bound) const {
+                if constexpr (std::random_access_iterator<I> && std::sized_sentinel_for<S, I>) {
+                    std::iter_difference_t<I> Remaining = End - Current;
+                    std::iter_difference_t<I> Low = 0;
+                    std::iter_difference_t<I> Step = 1;
+                    while (Step < Remaining && Less(Current[Step], Bound)) {
+                        Low = Step;
+                        Step *= 2;
+                    }
+
+                    Current = std::ranges::lower_bound(Current + Low + 1, Current + FMath::Min(Step, Remaining),
+                                                       std::invoke(Parent->Projection, Bound), Parent->Predicate,
+                                                       Parent->Projection);
+                } else {
+                    do {
+                        ++Current;
+                    } while (Current != End && Less(*Current, Bound));
+                }
+            }
+
+            void Satisfy() {
+                if constexpr (Operation == ESortedSetOperation::Merge) {
+                    // Ties go to the first range, which keeps the merge stable
+                    bFromSecond = Current1 == End1 || (Current2 != End2 && Less(*Current2, *Current1));
+                } else if constexpr (Operation == ESortedSetOperation::Union) {
+                    bBoth = false;
+                    if (Current1 == End1 || Current2 == End2) {
+                        bFromSecond = Current1 == End1;
+                    } else if (Less(*Current2, *Current1)) {
+                        bFromSecond = true;
+                    } else {
+                        bFromSecond = false;
+                        bBoth = !Less(*Current1, *Current2);
+                    }
+                } else if constexpr (Operation == ESortedSetOperation::Intersection) {
+                    while (Current1 != End1 && Current2 != End2) {
+                        if (Less(*Current1, *Current2)) {
+                            SkipLess(Current1, End1, *Current2);
+                        } else if (Less(*Current2, *Current1)) {
+                            SkipLess(Current2, End2, *Current1);
+                        } else {
+                            return;
+                        }
+                    }
+                } else if constexpr (Operation == ESortedSetOperation::Difference) {
+                    while (Current1 != End1 && Current2 != End2) {
+                        if (Less(*Current1, *Current2)) {
+                            return;
+                        }
+
+                        if (Less(*Current2, *Current1)) {
+                            SkipLess(Current2, End2, *Current1);
+                        } else {
+                            ++Current1;
+                            ++Current2;
+                        }
+                    }
+                } else {
+                    while (Current1 != End1 && Current2 != End2) {
+                        if (Less(*Current1, *Current2)) {
+                            bFromSecond = false;
+                            return;
+                        }
+
+                        if (Less(*Current2, *Current1)) {
+                            bFromSecond = true;
+                            return;
+                        }
+
+                        ++Current1;
+                        ++Current2;
+                    }
+                    bFromSecond = Current1 == End1;
+                }
+            }
+
+            const TSortedSetOperationView *Parent = nullptr;
+            FIterator1 Current1 = FIterator1();
+            FSentinel1 End1 = FSentinel1();
+            FIterator2 Current2 = FIterator2();
+            FSentinel2 End2 = FSentinel2();
+            bool bFromSecond = false;
+            bool bBoth = false;
+        };
+
+        TSortedSetOperationView() = default;
+
+        TSortedSetOperationView(V1 First, V2 Second, P Predicate, J Projection)
+            : First(std::move(First)), Second(std::move(Second)), Predicate(std::move(Predicate)),
+              Projection(std::move(Projection)) {
+        }
+
+        FIterator begin() {
+            return FIterator(*this, std::ranges::begin(First), std::ranges::end(First), std::ranges::begin(Second),
+                             std::ranges::end(Second));
+        }
+
+        std::default_sentinel_t end() {
+            return std::default_sentinel;
+        }
+
+        /**
+         * Get the exact size of a merge, which is the combined size of the inputs.
+         *
+         * @return The number of elements in the merge
+         */
+        auto size()
+            requires(Operation == ESortedSetOperation::Merge) && std::ranges::sized_range<V1> &&
+                    std::ranges::sized_range<V2>
+        {
+            return std::ranges::size(First) + std::ranges::size(Second);
+        }
+
+        /**
+         * Get an upper bound on the size of the view, for terminal operations to reserve storage with: the combined
+         * size of the inputs for merges, unions and symmetric differences, the smaller size for intersections, and the
+         * size of the first range for differences.
+         *
+         * @return The maximum number of elements the view can produce
+         */
+        int32 GetSizeHint()
+            requires(Private::OutputsFirstOnly(Operation) && Private::BoundedRange<V1>) ||
+                    (Private::BoundedRange<V1> && Private::BoundedRange<V2>)
+        {
+            if constexpr (Operation == ESortedSetOperation::Difference) {
+                return Ranges::GetSizeHint(First);
+            } else if constexpr (Operation == ESortedSetOperation::Intersection) {
+                if constexpr (Private::BoundedRange<V2>) {
+                    return FMath::Min(Ranges::GetSizeHint(First), Ranges::GetSizeHint(Second));
+                } else {
+                    return Ranges::GetSizeHint(First);
+                }
+            } else {
+                return Ranges::GetSizeHint(First) + Ranges::GetSizeHint(Second);
+            }
+        }
+
+      private:
+        V1 First;
+        V2 Second;
+        P Predicate;
+        J Projection;
+    };
+
+    /**
+     * Lazy merge of any number of ranges sorted by the same predicate, using a loser tree. Every element costs
+     * ceil(log2(k)) comparisons, one per level of the tree, against the losers that are already stored on the path
+     * from its input to the root, which is about half of what a binary heap needs. Equivalent elements come out in
+     * the order of the inputs they came from.
+     *
+     * The inputs are taken from a range of ranges the first time begin is called, and the view can only be iterated
+     * once. Calling begin again returns an iterator to the current position.
+     *
+     * @tparam V The view of the sorted inputs
+     * @tparam P The less-than predicate the inputs are sorted by
+     * @tparam J The projection applied to elements before comparing
+     */
+    template <std::ranges::view V, typename P, typename J>
+        requires std::ranges::input_range<V> && std::ranges::viewable_range<std::ranges::range_reference_t<V>>
+    class TLoserTreeMergeView : public std::ranges::view_interface<TLoserTreeMergeView<V, P, J>> {
+        using FInput = std::views::all_t<std::ranges::range_reference_t<V>>;
+
+        struct FCursor {
+            std::ranges::iterator_t<FInput> Current;
+            std::ranges::sentinel_t<FInput> End;
+        };
+
+      public:
+        struct FIterator {
+            using value_type = std::ranges::range_value_t<FInput>;
+            using difference_type = std::ptrdiff_t;
+
+            FIterator() = default;
+
+            explicit FIterator(TLoserTreeMergeView &Parent) : Parent(&Parent) {
+            }
+
+            std::ranges::range_reference_t<FInput> operator*() const {
+                return *Parent->Cursors[Parent->Tree[0]].Current;
+            }
+
+            FIterator &operator++() {
+                Parent->Pop();
+                return *this;
+            }
+
+            void operator++(int) {
+                Parent->Pop();
+            }
+
+            friend bool operator==(const FIterator &Iterator, std::default_sentinel_t) {
+                return Iterator.IsEnd();
+            }
+
+          private:
+            bool IsEnd() const {
+                return Parent->IsDone();
+            }
+
+            TLoserTreeMergeView *Parent = nullptr;
+        };
+
+        TLoserTreeMergeView() = default;
+
+        TLoserTreeMergeView(V Base, P Predicate, J Projection)
+            : Base(std::move(Base)), Predicate(std::move(Predicate)), Projection(std::move(Projection)) {
+        }
+
+        TLoserTreeMergeView(const TLoserTreeMergeView &) = delete;
+        TLoserTreeMergeView(TLoserTreeMergeView &&) = default;
+
+        ~TLoserTreeMergeView() = default;
+
+        TLoserTreeMergeView &operator=(const TLoserTreeMergeView &) = delete;
+        TLoserTreeMergeView &operator=(TLoserTreeMergeView &&) = default;
+
+        FIterator begin() {
+            if (!bStarted) {
+                bStarted = true;
+                Build();
+            }
+            return FIterator(*this);
+        }
+
+        std::default_sentinel_t end() {
+            return std::default_sentinel;
+        }
+
+        /**
+         * Get the combined size of the inputs, which is the exact size of the merge. The inputs are counted by
+         * walking the outer range, so this is only available when it is multi-pass.
+         *
+         * @return The number of elements in the merge
+         */
+        int32 GetSizeHint()
+            requires std::ranges::forward_range<V> && std::ranges::sized_range<std::ranges::range_reference_t<V>>
+        {
+            int32 Total = 0;
+            for (auto &&Input : Base) {
+                Total += static_cast<int32>(std::ranges::size(Input));
+            }
+            return Total;
+        }
+
+      private:
+        /**
+         * Whether the current element of input A should come out before the current element of input B. Exhausted
+         * inputs lose to everything, and ties go to the input with the lower index.
+         */
+        bool Beats(int32 A, int32 B) const {
+            const FCursor &Lhs = Cursors[A];
+            const FCursor &Rhs = Cursors[B];
+            if (Lhs.Current == Lhs.End) {
+                return false;
+            }
+
+            if (Rhs.Current == Rhs.End) {
+                return true;
+            }
+
+            if (std::invoke(Predicate, std::invoke(Projection, *Lhs.Current), std::invoke(Projection, *Rhs.Current))) {
+                return true;
+            }
+
+            return A < B && !std::invoke(Predicate, std::invoke(Projection, *Rhs.Current),
+                                         std::invoke(Projection, *Lhs.Current));
+        }
+
+        void Build() {
+            for (auto &&Input : Base) {
+                Inputs.Emplace(std::views::all(std::forward<decltype(Input)>(Input)));
+            }
+
+            // The inputs must be in their final place before their iterators are taken
+            int32 NumInputs = Inputs.Num();
+            Cursors.Reserve(NumInputs);
+            for (FInput &Input : Inputs) {
+                Cursors.Add({std::ranges::begin(Input), std::ranges::end(Input)});
+            }
+
+            if (NumInputs == 0) {
+                return;
+            }
+
+            // Node i of the tree has children 2i and 2i + 1, and input i is the leaf at NumInputs + i. Each inner
+            // node keeps the loser of the match played there, and node 0 keeps the overall winner.
+            Tree.SetNumUninitialized(NumInputs);
+            TArray<int32> Winners;
+            Winners.SetNumUninitialized(NumInputs * 2);
+            for (int32 i = 0; i < NumInputs; i++) {
+                Winners[NumInputs + i] = i;
+            }
+
+            for (int32 Node = NumInputs - 1; Node > 0; Node--) {
+                int32 Left = Winners[Node * 2];
+                int32 Right = Winners[Node * 2 + 1];
+                bool bLeftWins = Beats(Left, Right);
+                Winners[Node] = bLeftWins ? Left : Right;
+                Tree[Node] = bLeftWins ? Right : Left;
+            }
+            Tree[0] = Winners[1];
+        }
+
+        void Pop() {
+            int32 Winner = Tree[0];
+            ++Cursors[Winner].Current;
+
+            // Replay the matches on the path from the winner's leaf to the root against the stored losers
+            for (int32 Node = (Inputs.Num() + Winner) / 2; Node > 0; Node /= 2) {
+                if (Beats(Tree[Node], Winner)) {
+                    std::swap(Tree[Node], Winner);
+                }
+            }
+            Tree[0] = Winner;
+        }
+
+        bool IsDone() const {
+            return Tree.IsEmpty() || Cursors[Tree[0]].Current == Cursors[Tree[0]].End;
+        }
+
+        V Base;
+        P Predicate;
+        J Projection;
+        TArray<FInput> Inputs;
+        TArray<FCursor> Cursors;
+        TArray<int32> Tree;
+        bool bStarted = false;
+    };
+
+    namespace Views {
+        template <ESortedSetOperation Operation>
+        struct TSortedSetOperationInvoker {
+            template <std::ranges::viewable_range R1, std::ranges::viewable_range R2, typename P, typename J>
+                requires std::ranges::input_range<R1> && std::ranges::input_range<R2>
+            constexpr auto operator()(R1 &&First, R2 &&Second, P Predicate, J Projection) const {
+                return TSortedSetOperationView<Operation, std::views::all_t<R1>, std::views::all_t<R2>, P, J>(
+                    std::views::all(std::forward<R1>(First)), std::views::all(std::forward<R2>(Second)),
+                    std::move(Predicate), std::move(Projection));
+            }
+        };
+
+        /**
+         * Entry point of the sorted set operations, which can either be called with both ranges or be given the
+         * second range to produce a pipe for the first. The second range is captured as a view, so an array passed
+         * to the pipe is referenced rather than copied into it.
+         */
+        template <ESortedSetOperation Operation>
+        struct TSortedSetOperationAdaptor {
+            template <std::ranges::viewable_range R1, std::ranges::viewable_range R2, typename P = std::ranges::less,
+                      typename J = std::identity>
+                requires(!std::ranges::range<P>)
+            constexpr auto operator()(R1 &&First, R2 &&Second, P Predicate = {}, J Projection = {}) const {
+                return TSortedSetOperationInvoker<Operation>()(std::forward<R1>(First), std::forward<R2>(Second),
+                                                               std::move(Predicate), std::move(Projection));
+            }
+
+            template <std::ranges::viewable_range R, typename P = std::ranges::less, typename J = std::identity>
+                requires(!std::ranges::range<P>)
+            constexpr auto operator()(R &&Second, P Predicate = {}, J Projection = {}) const {
+                return ExtensionMethod<TSortedSetOperationInvoker<Operation>{}>(
+                    std::views::all(std::forward<R>(Second)), std::move(Predicate), std::move(Projection));
+            }
+        };
+
+        /**
+         * Merge two sorted ranges into one sorted view, keeping every element. The view is sized when both inputs
+         * are, so collecting it reserves exactly.
+         *
+         *     auto Timeline = Retro::Ranges::Views::MergeSorted(ServerEvents, ClientEvents, {}, &FEvent::Timestamp);
+         */
+        constexpr TSortedSetOperationAdaptor<ESortedSetOperation::Merge> MergeSorted{};
+
+        /**
+         * The elements that are in either of two sorted ranges, as a sorted view.
+         */
+        constexpr TSortedSetOperationAdaptor<ESortedSetOperation::Union> SetUnion{};
+
+        /**
+         * The elements of a sorted range that are also in a second sorted range, as a sorted view.
+         */
+        constexpr TSortedSetOperationAdaptor<ESortedSetOperation::Intersection> SetIntersection{};
+
+        /**
+         * The elements of a sorted range that are not in a second sorted range, as a sorted view. Diffing two
+         * snapshots of a sorted ID list is then a pair of differences:
+         *
+         *     auto Added = Current.Ids | Retro::Ranges::Views::SetDifference(Previous.Ids);
+         *     auto Removed = Previous.Ids | Retro::Ranges::Views::SetDifference(Current.Ids);
+         */
+        constexpr TSortedSetOperationAdaptor<ESortedSetOperation::Difference> SetDifference{};
+
+        /**
+         * The elements that are in exactly one of two sorted ranges, as a sorted view.
+         */
+        constexpr TSortedSetOperationAdaptor<ESortedSetOperation::SymmetricDifference> SetSymmetricDifference{};
+
+        struct FMergeSortedRangesInvoker {
+            template <std::ranges::viewable_range R, typename P = std::ranges::less, typename J = std::identity>
+                requires std::ranges::input_range<R> && std::ranges::viewable_range<std::ranges::range_reference_t<R>>
+            auto operator()(R &&Inputs, P Predicate = {}, J Projection = {}) const {
+                return TLoserTreeMergeView<std::views::all_t<R>, P, J>(std::views::all(std::forward<R>(Inputs)),
+                                                                        std::move(Predicate), std::move(Projection));
+            }
+        };
+
+        /**
+         * Merge a range of sorted ranges, such as an array of per-snapshot ID arrays, into one sorted view with a
+         * loser tree. Optionally takes the predicate the inputs are sorted by and a projection.
+         *
+         *     auto AllIds = Snapshots | Retro::Ranges::Views::MergeSortedRanges() | Retro::Ranges::To<TArray>();
+         */
+        constexpr auto MergeSortedRanges = ExtensionMethod<FMergeSortedRangesInvoker{}>;
+    } // namespace Views
+} // namespace Retro::Ranges
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
 #include "Modules/ModuleManager.h"
 
 class FRetroLibUEModule : public IModuleInterface {
@@ -9,4 +10,10 @@ class FRetroLibUEModule : public IModuleInterface {
     /** IModuleInterface implementation */
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+  private:
+    FDelegateHandle EndFrameHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle ObjectsReinstancedHandle;
+    FTSTicker::FDelegateHandle DispatchTickerHandle;
 };
@@ -7,6 +7,16 @@ public class RetroLibUE : ModuleRules
 	public RetroLibUE(ReadOnlyTargetRules Target) : base(Target)
 	{
 		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		PrivatePCHHeaderFile = "Private/RetroLibUEPCH.h";
+
+		// Common ToArray and delegate factory instantiations are compiled once in ExternTemplates.cpp and declared
+		// extern through the private PCH. Kept private so dependent modules still instantiate them locally.
+		PrivateDefinitions.Add("RETROLIB_EXTERN_TEMPLATES=1");
+
+		// Insights instrumentation for pipelines and delegate dispatch, still gated at runtime by the RetroLib channel
+		PublicDefinitions.Add(Target.Configuration != UnrealTargetConfiguration.Shipping
+			? "RETROLIB_WITH_TRACE=1"
+			: "RETROLIB_WITH_TRACE=0");
 		
 		PublicIncludePaths.AddRange(
 			new string[] {
@@ -26,6 +36,7 @@ public class RetroLibUE : ModuleRules
 			new string[]
 			{
 				"Core",
+				"Json",
 				"RetroLib"
 				// ... add other public dependencies that you statically link with here ...
 			}
@@ -35,6 +46,7 @@ public class RetroLibUE : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"AssetRegistry",
 				"CoreUObject",
 				"Engine",
 				"Slate",
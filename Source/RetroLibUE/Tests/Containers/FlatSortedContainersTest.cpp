@@ -0,0 +1,63 @@
+﻿#if WITH_TESTS
+
+#include "Algo/BinarySearch.h"
+#include "RetroLib/Containers/FlatSortedMap.h"
+#include "RetroLib/Containers/FlatSortedSet.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Algorithm/ToSorted.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Compatibility/UnrealContainers.h"
+#include "Tests/TestHarnessAdapter.h"
+
+TEST_CASE_NAMED(FFlatSortedContainersTest, "RetroLib::Containers::FlatSorted", "[RetroLib][Containers]") {
+    TArray<TPair<int32, FString>> Pairs = {
+        {5, TEXT("Five")}, {1, TEXT("One")}, {3, TEXT("Three")}, {1, TEXT("Uno")}, {4, TEXT("Four")}};
+
+    SECTION("Flat sorted maps sort once and keep the last duplicate") {
+        auto Map = Pairs | Retro::Ranges::ToFlatSortedMap();
+        REQUIRE(Map.Num() == 4);
+        CHECK(Map.GetKeys()[0] == 1);
+        CHECK(Map.GetKeys()[3] == 5);
+        CHECK(Map.FindChecked(1) == TEXT("Uno"));
+        CHECK(Map.FindRef(3) == TEXT("Three"));
+        CHECK(Map.Find(2) == nullptr);
+
+        Map.Add(2, TEXT("Two"));
+        CHECK(Map.IndexOf(2) == 1);
+        CHECK(Map.Remove(5));
+        CHECK_FALSE(Map.Contains(5));
+    }
+
+    SECTION("Flat sorted sets are ordered and unique") {
+        TArray Values = {9, 2, 7, 2, 4, 9};
+        auto Set = Values | Retro::Ranges::ToFlatSortedSet();
+        REQUIRE(Set.Num() == 4);
+        CHECK(Set.GetElements()[0] == 2);
+        CHECK(Set.Contains(7));
+        CHECK_FALSE(Set.Contains(3));
+        CHECK(Set.Add(3));
+        CHECK_FALSE(Set.Add(3));
+        CHECK(Set.IndexOf(3) == 1);
+    }
+
+    SECTION("Sorted maps can be built in bulk or through To") {
+        auto Bulk = Pairs | Retro::Ranges::ToSortedMap();
+        auto Incremental = Pairs | Retro::Ranges::To<TSortedMap>();
+        static_assert(std::same_as<decltype(Bulk), TSortedMap<int32, FString>>);
+        REQUIRE(Bulk.Num() == 4);
+        REQUIRE(Incremental.Num() == 4);
+        for (const auto &[Key, Value] : Bulk) {
+            CHECK(Incremental.FindChecked(Key) == Value);
+        }
+        CHECK(Bulk.FindChecked(1) == TEXT("Uno"));
+    }
+
+    SECTION("Branchless search agrees with Algo::LowerBound") {
+        TArray Sorted = {1, 1, 2, 3, 5, 8, 13, 21, 34};
+        for (int32 Key = 0; Key < 40; Key++) {
+            CHECK(Retro::BranchlessLowerBound(Sorted.GetData(), Sorted.Num(), Key) == Algo::LowerBound(Sorted, Key));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Exceptions/ConvertException.h"
+#include "RetroLib/Expected/Expected.h"
+#include "RetroLib/Memory/AllocationCounter.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace Retro::Testing::Expected {
+    using Retro::Expected::TExpected;
+
+    static TExpected<int32, FString> ParseInt(const FString &Text) {
+        if (Text.IsEmpty() || !Text.IsNumeric()) {
+            return MakeError(FString::Printf(TEXT("'%s' is not a number"), *Text));
+        }
+        return MakeValue(FCString::Atoi(*Text));
+    }
+
+    static TExpected<int32, FString> RequirePositive(int32 Value) {
+        if (Value <= 0) {
+            return MakeError(TEXT("Value must be positive"));
+        }
+        return MakeValue(Value);
+    }
+} // namespace Retro::Testing::Expected
+
+TEST_CASE_NAMED(FExpectedPipesTest, "RetroLib::Expected::Pipes", "[RetroLib][Expected]") {
+    using namespace Retro::Testing::Expected;
+
+    SECTION("Transform and AndThen only run on a value") {
+        auto Doubled = ParseInt(TEXT("21")) | Retro::Expected::Transform([](int32 i) { return i * 2; }) |
+                       Retro::Expected::AndThen(&RequirePositive);
+        REQUIRE(Doubled.HasValue());
+        CHECK(Doubled.GetValue() == 42);
+
+        bool bCalled = false;
+        auto Failed = ParseInt(TEXT("abc")) | Retro::Expected::Transform([&bCalled](int32 i) {
+                          bCalled = true;
+                          return i;
+                      }) |
+                      Retro::Expected::AndThen(&RequirePositive);
+        REQUIRE(Failed.HasError());
+        CHECK(Failed.GetError() == TEXT("'abc' is not a number"));
+        CHECK_FALSE(bCalled);
+    }
+
+    SECTION("OrElse and TransformError act on the error") {
+        auto Recovered = ParseInt(TEXT("-3")) | Retro::Expected::AndThen(&RequirePositive) |
+                         Retro::Expected::OrElse([](const FString &) -> TExpected<int32, FText> { return MakeValue(1); });
+        REQUIRE(Recovered.HasValue());
+        CHECK(Recovered.GetValue() == 1);
+
+        auto Converted = ParseInt(TEXT("x")) |
+                         Retro::Expected::TransformError([](const FString &Error) { return FText::FromString(Error); });
+        static_assert(std::same_as<decltype(Converted), TExpected<int32, FText>>);
+        REQUIRE(Converted.HasError());
+        CHECK(Converted.GetError().ToString() == TEXT("'x' is not a number"));
+
+        CHECK((ParseInt(TEXT("x")) | Retro::Expected::ValueOr(-1)) == -1);
+        CHECK((ParseInt(TEXT("5")) | Retro::Expected::ValueOr(-1)) == 5);
+    }
+
+    SECTION("Void results can be chained") {
+        int32 Calls = 0;
+        TExpected<void, FString> Result =
+            ParseInt(TEXT("4")) | Retro::Expected::Transform([&Calls](int32 Value) { Calls += Value; });
+        CHECK(Result.HasValue());
+        CHECK(Calls == 4);
+    }
+
+    SECTION("Propagating an error does not allocate") {
+        TExpected<int32, int32> Failed = MakeError(3);
+        Retro::FScopedAllocationCounter Allocations;
+        auto Result = Failed | Retro::Expected::Transform([](int32 i) { return i + 1; }) |
+                      Retro::Expected::AndThen([](int32 i) -> TExpected<int32, int32> { return MakeValue(i); }) |
+                      Retro::Expected::TransformError([](int32 Error) { return Error * 2; });
+        if (Retro::FScopedAllocationCounter::IsProxyInstalled()) {
+            CHECK(Allocations.GetNumAllocations() == 0);
+        }
+        REQUIRE(Result.HasError());
+        CHECK(Result.GetError() == 6);
+    }
+
+    SECTION("Errors can be converted into Blueprint exceptions") {
+        auto Result = ParseInt(TEXT("nope"));
+        REQUIRE(Result.HasError());
+        FBlueprintExceptionInfo Info =
+            Retro::ConvertException(Result.GetError(), EBlueprintExceptionType::FatalError);
+        CHECK(Info.GetType() == EBlueprintExceptionType::FatalError);
+        CHECK(Info.GetDescription().ToString() == TEXT("'nope' is not a number"));
+        static_assert(Retro::BlueprintReportableError<FString>);
+        static_assert(Retro::BlueprintReportableError<FText>);
+    }
+}
+
+#endif
@@ -0,0 +1,204 @@
+﻿#if WITH_TESTS
+
+#include "Components/TimelineComponent.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetStringLibrary.h"
+#include "RetroLib/Functional/Delegates.h"
+#include "Tests/TestHarnessAdapter.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace Retro::Testing::DynamicDelegates {
+    template <typename>
+    struct TDelegateModeOf;
+
+    template <typename M>
+    struct TDelegateModeOf<TScriptDelegate<M>> {
+        using Type = M;
+    };
+
+    /**
+     * The thread safety mode that generated dynamic delegates use, which differs between engine versions.
+     */
+    using FDelegateMode = typename TDelegateModeOf<FScriptDelegate>::Type;
+
+    /*
+     * Hand-written versions of what DECLARE_DYNAMIC_DELEGATE and DECLARE_DYNAMIC_MULTICAST_DELEGATE produce, as the
+     * wrappers that fill the parameter struct are only generated for headers processed by UHT.
+     */
+
+    class FOnFloatChanged : public TBaseDynamicMulticastDelegate<FDelegateMode, void, float> {
+      public:
+        void Broadcast(float Value) const {
+            struct {
+                float Value;
+            } Parms = {Value};
+            ProcessMulticastDelegate<UObject>(&Parms);
+        }
+    };
+
+    class FModulo : public TBaseDynamicDelegate<FDelegateMode, int32, double, double, double &> {
+      public:
+        int32 Execute(double Dividend, double Divisor, double &Remainder) const {
+            struct {
+                double Dividend;
+                double Divisor;
+                double Remainder;
+                int32 ReturnValue;
+            } Parms = {Dividend, Divisor, Remainder, 0};
+            ProcessDelegate<UObject>(&Parms);
+            Remainder = Parms.Remainder;
+            return Parms.ReturnValue;
+        }
+    };
+
+    class FConcat : public TBaseDynamicDelegate<FDelegateMode, FString, const FString &, const FString &> {
+      public:
+        FString Execute(const FString &A, const FString &B) const {
+            struct {
+                FString A;
+                FString B;
+                FString ReturnValue;
+            } Parms = {A, B, FString()};
+            ProcessDelegate<UObject>(&Parms);
+            return MoveTemp(Parms.ReturnValue);
+        }
+    };
+} // namespace Retro::Testing::DynamicDelegates
+
+TEST_CASE_NAMED(FDynamicDelegateTest, "RetroLib::Functional::Delegates::Dynamic", "[RetroLib][Functional]") {
+    static_assert(Retro::Delegates::DynamicUnicastDelegate<FOnTimelineFloat>);
+
+    TStrongObjectPtr<UTimelineComponent> Timeline(NewObject<UTimelineComponent>(GetTransientPackage()));
+    FName FunctionName = GET_FUNCTION_NAME_CHECKED(UTimelineComponent, SetPlayRate);
+    FOnTimelineFloat Delegate;
+    Delegate.BindUFunction(Timeline.Get(), FunctionName);
+
+    SECTION("Native functions are resolved once and called directly") {
+        Retro::Delegates::FDynamicFunctionCache Cache;
+        auto Layout = Cache.Find(Timeline.Get(), FunctionName);
+        CHECK(Layout->bNative);
+        CHECK(Layout->Function == Timeline->FindFunction(FunctionName));
+        CHECK(Layout->ParamOffsets.Num() == 1);
+        CHECK(Layout->ReturnOffset == INDEX_NONE);
+        CHECK(&Cache.Find(Timeline.Get(), FunctionName).Get() == &Layout.Get());
+    }
+
+    SECTION("Layouts only match signatures with the same parameter types") {
+        Retro::Delegates::FDynamicFunctionCache Cache;
+        auto Layout = Cache.Find(Timeline.Get(), FunctionName);
+        CHECK(Layout->Matches<void, float>());
+        CHECK(Layout->Matches<void, const float &>());
+        CHECK_FALSE(Layout->Matches<void, int32>());
+        CHECK_FALSE(Layout->Matches<void, double>());
+        CHECK_FALSE(Layout->Matches<float, float>());
+        CHECK_FALSE(Layout->Matches<void, float, float>());
+    }
+
+    SECTION("Invoker passes the arguments through to the native function") {
+        Retro::Delegates::TDelegateInvoker Invoker(Delegate);
+        Invoker(2.5f);
+        CHECK(Timeline->GetPlayRate() == 2.5f);
+        Invoker(0.5f);
+        CHECK(Timeline->GetPlayRate() == 0.5f);
+    }
+
+    SECTION("Bindings produce the same result as executing the delegate") {
+        auto Binding = Retro::CreateBinding(Delegate);
+        Binding(4.f);
+        CHECK(Timeline->GetPlayRate() == 4.f);
+
+        Delegate.Execute(3.f);
+        CHECK(Timeline->GetPlayRate() == 3.f);
+    }
+
+    SECTION("Functions without a native implementation go through ProcessEvent") {
+        // A Blueprint implementable event, which only has a script body when a Blueprint overrides it
+        FName EventName = TEXT("ReceiveTick");
+        Retro::Delegates::FDynamicFunctionCache Cache;
+        auto Layout = Cache.Find(Timeline.Get(), EventName);
+        CHECK_FALSE(Layout->bNative);
+        CHECK(Layout->Matches<void, float>());
+
+        FOnTimelineFloat EventDelegate;
+        EventDelegate.BindUFunction(Timeline.Get(), EventName);
+        Retro::Delegates::TDelegateInvoker Invoker(EventDelegate);
+        int32 NumInvocations = Retro::Delegates::GetNumProcessEventInvocations();
+        Invoker(0.1f);
+        Invoker(0.1f);
+        CHECK(Retro::Delegates::GetNumProcessEventInvocations() == NumInvocations + 2);
+
+        // Native targets never take that path
+        Retro::Delegates::TDelegateInvoker NativeInvoker(Delegate);
+        NativeInvoker(1.5f);
+        CHECK(Timeline->GetPlayRate() == 1.5f);
+        CHECK(Retro::Delegates::GetNumProcessEventInvocations() == NumInvocations + 2);
+    }
+}
+
+TEST_CASE_NAMED(FDynamicDelegateSignaturesTest, "RetroLib::Functional::Delegates::Dynamic::Signatures",
+                "[RetroLib][Functional]") {
+    using namespace Retro::Testing::DynamicDelegates;
+
+    SECTION("Broadcast calls every listener in order") {
+        TStrongObjectPtr<UTimelineComponent> First(NewObject<UTimelineComponent>(GetTransientPackage()));
+        TStrongObjectPtr<UTimelineComponent> Second(NewObject<UTimelineComponent>(GetTransientPackage()));
+
+        FOnFloatChanged Delegate;
+        for (UTimelineComponent *Timeline : {First.Get(), Second.Get()}) {
+            TBaseDynamicDelegate<FDelegateMode, void, float> Listener;
+            Listener.BindUFunction(Timeline, GET_FUNCTION_NAME_CHECKED(UTimelineComponent, SetPlayRate));
+            Delegate.Add(Listener);
+        }
+
+        // A script listener mixed in with the native ones is still called through ProcessEvent
+        TBaseDynamicDelegate<FDelegateMode, void, float> EventListener;
+        EventListener.BindUFunction(First.Get(), TEXT("ReceiveTick"));
+        Delegate.Add(EventListener);
+
+        Retro::Delegates::FDynamicFunctionCache Cache;
+        int32 NumInvocations = Retro::Delegates::GetNumProcessEventInvocations();
+        Retro::Delegates::BroadcastDynamic(Delegate, Cache, 2.f);
+        CHECK(First->GetPlayRate() == 2.f);
+        CHECK(Second->GetPlayRate() == 2.f);
+        CHECK(Retro::Delegates::GetNumProcessEventInvocations() == NumInvocations + 1);
+
+        Delegate.Remove(First.Get(), GET_FUNCTION_NAME_CHECKED(UTimelineComponent, SetPlayRate));
+        Retro::Delegates::BroadcastDynamic(Delegate, Cache, 3.f);
+        CHECK(First->GetPlayRate() == 2.f);
+        CHECK(Second->GetPlayRate() == 3.f);
+    }
+
+    SECTION("Return values are passed back to the caller") {
+        FConcat Delegate;
+        Delegate.BindUFunction(GetMutableDefault<UKismetStringLibrary>(),
+                               GET_FUNCTION_NAME_CHECKED(UKismetStringLibrary, Concat_StrStr));
+
+        Retro::Delegates::FDynamicFunctionCache Cache;
+        FString Result = Retro::Delegates::ExecuteDynamic(Delegate, Cache, FString(TEXT("Retro")),
+                                                                   FString(TEXT("Lib")));
+        CHECK(Result == TEXT("RetroLib"));
+        CHECK(Cache.Find(GetMutableDefault<UKismetStringLibrary>(), Delegate.GetFunctionName())
+                  ->Matches<FString, const FString &, const FString &>());
+        CHECK(Result == Delegate.Execute(TEXT("Retro"), TEXT("Lib")));
+    }
+
+    SECTION("Out parameters are written back to the caller") {
+        FModulo Delegate;
+        Delegate.BindUFunction(GetMutableDefault<UKismetMathLibrary>(),
+                               GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, FMod));
+
+        Retro::Delegates::FDynamicFunctionCache Cache;
+        double Remainder = 0.0;
+        int32 Quotient = Retro::Delegates::ExecuteDynamic(Delegate, Cache, 7.5, 2.0, Remainder);
+        CHECK(Quotient == 3);
+        CHECK(Remainder == 1.5);
+        CHECK(Cache.Find(GetMutableDefault<UKismetMathLibrary>(), Delegate.GetFunctionName())->bNative);
+
+        double ExpectedRemainder = 0.0;
+        CHECK(Delegate.Execute(7.5, 2.0, ExpectedRemainder) == Quotient);
+        CHECK(ExpectedRemainder == Remainder);
+    }
+}
+
+#endif
@@ -0,0 +1,72 @@
+﻿#if WITH_TESTS
+
+#include "Async/ParallelFor.h"
+#include "RetroLib/Functional/Delegates.h"
+#include "RetroLib/Functional/GameThreadDispatch.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace Retro::Testing::GameThreadDispatch {
+    DECLARE_DELEGATE_OneParam(FRecordValue, int32);
+    DECLARE_MULTICAST_DELEGATE_OneParam(FMultiRecordValue, int32);
+} // namespace Retro::Testing::GameThreadDispatch
+
+TEST_CASE_NAMED(FGameThreadDispatchTest, "RetroLib::Functional::Delegates::GameThreadDispatch", "[RetroLib][Functional]") {
+    using namespace Retro::Testing::GameThreadDispatch;
+    auto &Dispatcher = Retro::Delegates::FGameThreadDispatcher::Get();
+    Dispatcher.Flush();
+
+    TArray<int32> Values;
+    auto Record = [&Values](int32 Value) {
+        check(IsInGameThread());
+        Values.Add(Value);
+    };
+
+    SECTION("Calls from workers are run on the game thread in a single drain") {
+        auto Marshalled = Retro::Delegates::MarshalToGameThread(Retro::Delegates::Create<FRecordValue>(Record));
+        ParallelFor(256, [&Marshalled](int32 Index) { Marshalled(Index); });
+        CHECK(Values.IsEmpty());
+        CHECK(Dispatcher.HasPendingCalls());
+
+        CHECK(Dispatcher.Flush() == 256);
+        REQUIRE(Values.Num() == 256);
+        Values.Sort();
+        for (int32 i = 0; i < Values.Num(); i++) {
+            CHECK(Values[i] == i);
+        }
+        CHECK_FALSE(Dispatcher.HasPendingCalls());
+    }
+
+    SECTION("Calls from a single thread keep their order") {
+        FMultiRecordValue Delegate;
+        Delegate.AddLambda(Record);
+        auto Marshalled = Retro::Delegates::MarshalToGameThread(Delegate);
+        for (int32 i = 0; i < 8; i++) {
+            Marshalled(i);
+        }
+
+        CHECK(Dispatcher.Flush() == 8);
+        CHECK(Values == TArray<int32>({0, 1, 2, 3, 4, 5, 6, 7}));
+    }
+
+    SECTION("Calls with a coalescing key collapse to the latest") {
+        auto Coalesced = Retro::Delegates::MarshalToGameThread(Retro::Delegates::Create<FRecordValue>(Record), 42);
+        auto Plain = Retro::Delegates::MarshalToGameThread(Retro::Delegates::Create<FRecordValue>(Record));
+        Coalesced(1);
+        Plain(10);
+        Coalesced(2);
+        Coalesced(3);
+
+        CHECK(Dispatcher.Flush() == 2);
+        CHECK(Values == TArray<int32>({10, 3}));
+    }
+
+    SECTION("Discarded calls are never run") {
+        auto Marshalled = Retro::Delegates::MarshalToGameThread(Retro::Delegates::Create<FRecordValue>(Record));
+        Marshalled(1);
+        Dispatcher.Discard();
+        CHECK(Dispatcher.Flush() == 0);
+        CHECK(Values.IsEmpty());
+    }
+}
+
+#endif
@@ -0,0 +1,97 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Functional/CreateBinding.h"
+#include "RetroLib/Functional/StaticBindings.h"
+#include "RetroLib/Memory/AllocationCounter.h"
+#include "Tests/TestHarnessAdapter.h"
+#include "UObject/Package.h"
+
+namespace Retro::Testing::StaticBindings {
+    DECLARE_DELEGATE_RetVal_OneParam(int32, FScaleValue, int32);
+
+    static int32 Multiply(int32 Value, int32 Factor) {
+        return Value * Factor;
+    }
+
+    class FCounter : public TSharedFromThis<FCounter> {
+      public:
+        int32 GetValue() const {
+            return Value;
+        }
+
+        int32 AddToValue(int32 Other) {
+            Value += Other;
+            return Value;
+        }
+
+      private:
+        int32 Value = 0;
+    };
+} // namespace Retro::Testing::StaticBindings
+
+TEST_CASE_NAMED(FStaticBindingTest, "RetroLib::Functional::Delegates::StaticBindings", "[RetroLib][Functional]") {
+    using namespace Retro::Testing::StaticBindings;
+
+    SECTION("Static bindings call the function with their payload") {
+        auto Binding = Retro::Delegates::BindStatic<&Multiply>(3);
+        CHECK(Binding.IsBound());
+        CHECK(Binding.Execute(4) == 12);
+        CHECK(Binding(5) == 15);
+        CHECK(Binding.ExecuteIfBound(5));
+    }
+
+    SECTION("Static bindings compose with CreateBinding and BindBack") {
+        auto Binding = Retro::CreateBinding(Retro::Delegates::BindStatic<&Multiply>(), 10);
+        CHECK(Binding(2) == 20);
+
+        auto Back = Retro::BindBack(Retro::Delegates::BindStatic<&Multiply>(), 7);
+        CHECK(Back(3) == 21);
+    }
+
+    SECTION("Calling a binding does not allocate") {
+        FCounter Counter;
+        auto Static = Retro::Delegates::BindStatic<&Multiply>(2);
+        auto Member = Retro::Delegates::BindMember<&FCounter::AddToValue>(&Counter);
+
+        Retro::FScopedAllocationCounter Allocations;
+        int32 Sum = 0;
+        for (int32 i = 0; i < 16; i++) {
+            Sum += Static(i) + Member(1);
+        }
+        if (Retro::FScopedAllocationCounter::IsProxyInstalled()) {
+            CHECK(Allocations.GetNumAllocations() == 0);
+        }
+        CHECK(Counter.GetValue() == 16);
+        CHECK(Sum > 0);
+    }
+
+    SECTION("Member bindings track the lifetime of their object") {
+        auto Shared = MakeShared<FCounter>();
+        auto Strong = Retro::Delegates::BindMember<&FCounter::AddToValue>(Shared, 5);
+        CHECK(Strong.Execute() == 5);
+
+        TStrongObjectPtr<UObject> Object(NewObject<UObject>(GetTransientPackage()));
+        auto Weak = Retro::Delegates::BindMember<&UObject::GetFName>(MakeWeakObjectPtr(Object.Get()));
+        CHECK(Weak.IsBound());
+        CHECK(Weak() == Object->GetFName());
+
+        Object->MarkAsGarbage();
+        CHECK_FALSE(Weak.IsBound());
+        CHECK_FALSE(Weak.ExecuteIfBound());
+        Object->ClearGarbage();
+    }
+
+    SECTION("Bindings can be converted into delegates") {
+        FScaleValue Static = Retro::Delegates::BindStatic<&Multiply>(4).ToDelegate<FScaleValue>();
+        REQUIRE(Static.IsBound());
+        CHECK(Static.Execute(2) == 8);
+
+        auto Shared = MakeShared<FCounter>();
+        FScaleValue Member = Retro::Delegates::BindMember<&FCounter::AddToValue>(Shared).ToDelegate<FScaleValue>();
+        REQUIRE(Member.IsBound());
+        CHECK(Member.Execute(3) == 3);
+        CHECK(Shared->GetValue() == 3);
+    }
+}
+
+#endif
@@ -0,0 +1,118 @@
+﻿#if WITH_TESTS
+
+#include "Dom/JsonObject.h"
+#include "RetroLib/Json/JsonEncoding.h"
+#include "RetroLib/Json/JsonStreamWriter.h"
+#include "RetroLib/Ranges/Algorithm/WriteJson.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryWriter.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace Retro::Testing::JsonStreamWriter {
+    struct FHitEvent {
+        float Time;
+        int32 Damage;
+        FName Source;
+        TOptional<FString> Comment;
+    };
+
+    static FString ToText(const TArray<uint8> &Bytes) {
+        FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR *>(Bytes.GetData()), Bytes.Num());
+        return FString(Converter.Length(), Converter.Get());
+    }
+} // namespace Retro::Testing::JsonStreamWriter
+
+template <>
+struct Retro::Json::TJsonFields<Retro::Testing::JsonStreamWriter::FHitEvent> {
+    using FHitEvent = Retro::Testing::JsonStreamWriter::FHitEvent;
+    static constexpr auto Fields =
+        std::make_tuple(Field(TEXT("time"), &FHitEvent::Time), Field(TEXT("damage"), &FHitEvent::Damage),
+                        Field(TEXT("source"), &FHitEvent::Source), Field(TEXT("comment"), &FHitEvent::Comment));
+};
+
+TEST_CASE_NAMED(FJsonStreamWriterTest, "RetroLib::Json::StreamWriter", "[RetroLib][Json]") {
+    using namespace Retro::Testing::JsonStreamWriter;
+    TArray<uint8> Bytes;
+
+    SECTION("Descriptors map structs to objects") {
+        TArray<FHitEvent> Events = {{0.5f, 10, TEXT("Turret"), TEXT("Crit")}, {1.25f, -3, NAME_None, NullOpt}};
+        CHECK((Events | Retro::Ranges::WriteJsonTo(Bytes)) == 2);
+        CHECK(ToText(Bytes) == TEXT("[{\"time\":0.5,\"damage\":10,\"source\":\"Turret\",\"comment\":\"Crit\"},"
+                                    "{\"time\":1.25,\"damage\":-3,\"source\":\"None\",\"comment\":null}]"));
+    }
+
+    SECTION("Tuples become arrays and maps become objects") {
+        TArray<TTuple<int32, bool, double>> Rows = {MakeTuple(1, true, 0.25), MakeTuple(-2, false, 4.0)};
+        TMap<FString, TArray<int32>> Groups;
+        Groups.Add(TEXT("Even"), {2, 4});
+        Groups.Add(TEXT("Odd"), {});
+
+        {
+            Retro::Json::FJsonStreamWriter Writer(Bytes);
+            Writer.BeginObject();
+            Writer.WriteKey(TEXT("rows"));
+            Rows | Retro::Ranges::WriteJsonTo(Writer);
+            Writer.WriteKey(TEXT("groups"));
+            Retro::Json::WriteValue(Writer, Groups);
+            Writer.EndObject();
+        }
+
+        CHECK(ToText(Bytes) == TEXT("{\"rows\":[[1,true,0.25],[-2,false,4]],\"groups\":{\"Even\":[2,4],\"Odd\":[]}}"));
+    }
+
+    SECTION("Strings are escaped and encoded as UTF-8") {
+        {
+            Retro::Json::FJsonStreamWriter Writer(Bytes);
+            Writer.WriteString(TEXT("\"Quoted\"\n\t\x01 café"));
+        }
+
+        TArray<uint8> Expected;
+        FTCHARToUTF8 Converter(TEXT("\"\\\"Quoted\\\"\\n\\t\\u0001 café\""));
+        Expected.Append(reinterpret_cast<const uint8 *>(Converter.Get()), Converter.Length());
+        CHECK(Bytes == Expected);
+    }
+
+    SECTION("Reflected structs are written through their properties") {
+        FVector Vector(1.0, -2.5, 3.0);
+        {
+            Retro::Json::FJsonStreamWriter Writer(Bytes);
+            Retro::Json::WriteStruct(Writer, TBaseStructure<FVector>::Get(), &Vector);
+        }
+        CHECK(ToText(Bytes) == TEXT("{\"X\":1,\"Y\":-2.5,\"Z\":3}"));
+    }
+
+    SECTION("Archive output is flushed in chunks and parses back") {
+        TArray<int32> Values;
+        for (int32 i = 0; i < 1000; i++) {
+            Values.Add(i * 7);
+        }
+
+        FMemoryWriter Archive(Bytes);
+        {
+            Retro::Json::FJsonStreamWriter Writer(Archive, 64);
+            Writer.BeginObject();
+            Writer.WriteKey(TEXT("values"));
+            Values | Retro::Ranges::WriteJsonTo(Writer);
+            Writer.EndObject();
+        }
+
+        TSharedPtr<FJsonObject> Parsed;
+        REQUIRE(FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ToText(Bytes)), Parsed));
+        const TArray<TSharedPtr<FJsonValue>> &Loaded = Parsed->GetArrayField(TEXT("values"));
+        REQUIRE(Loaded.Num() == Values.Num());
+        CHECK(Loaded[999]->AsNumber() == 6993.0);
+    }
+
+    SECTION("Values can be written into an engine JSON writer") {
+        FString Output;
+        auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+        TArray<TTuple<FString, int32>> Pairs = {MakeTuple(FString(TEXT("a")), 1)};
+        Pairs | Retro::Ranges::WriteJsonTo(Writer);
+        Writer->Close();
+        CHECK(Output == TEXT("[[\"a\",1]]"));
+    }
+}
+
+#endif
@@ -0,0 +1,52 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Memory/AllocationCounter.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Compatibility/UnrealContainers.h"
+#include "RetroLib/Ranges/Views/Transform.h"
+#include "Tests/TestHarnessAdapter.h"
+
+TEST_CASE_NAMED(FAllocationBudgetTest, "RetroLib::Memory::AllocationBudget", "[RetroLib][Memory]") {
+    // Allocations are only counted when the process is run with -RetroCountAllocs
+    if (!Retro::FScopedAllocationCounter::IsProxyInstalled()) {
+        return;
+    }
+
+    TArray Values = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    SECTION("Sized pipelines allocate their result exactly once") {
+        Retro::FScopedAllocationBudget Budget(TEXT("Transform | To<TArray>"), 1);
+        auto Result = Values | Retro::Ranges::Views::Transform([](int32 Value) { return Value + 1; }) |
+                      Retro::Ranges::To<TArray>();
+        CHECK(Result.Num() == 8);
+        CHECK(Budget.GetNumAllocations() == 1);
+        CHECK(Budget.IsWithinBudget());
+    }
+
+    SECTION("Counters nest") {
+        Retro::FScopedAllocationCounter Outer;
+        {
+            Retro::FScopedAllocationCounter Inner;
+            TArray<int32> Copy = Values;
+            CHECK(Inner.GetNumAllocations() == 1);
+            CHECK(Inner.GetNumBytes() >= static_cast<int64>(sizeof(int32) * Values.Num()));
+        }
+        CHECK(Outer.GetNumAllocations() == 1);
+        CHECK(Outer.GetNumFrees() == 1);
+    }
+
+    SECTION("Budgets track the allocations made against them") {
+        Retro::FScopedAllocationBudget Budget(TEXT("Copies"), 8);
+        TArray<TArray<int32>> Copies;
+        Copies.Reserve(4);
+        for (int32 i = 0; i < 4; i++) {
+            Copies.Add(Values);
+        }
+        CHECK(Budget.GetNumAllocations() == 5);
+        CHECK(Budget.GetMaxAllocations() == 8);
+        CHECK(Budget.IsWithinBudget());
+    }
+}
+
+#endif
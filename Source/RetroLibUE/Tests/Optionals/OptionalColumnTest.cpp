@@ -0,0 +1,81 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Optionals/OptionalColumn.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace {
+    enum class EOptionalColumnTestSlot : int32 { None = INDEX_NONE, First, Second, Third };
+}
+
+template <>
+struct Retro::Optionals::TOptionalNiche<EOptionalColumnTestSlot>
+    : TSentinelOptionalNiche<EOptionalColumnTestSlot, EOptionalColumnTestSlot::None> {};
+
+TEST_CASE_NAMED(FOptionalColumnTest, "RetroLib::Optionals::OptionalColumn", "[RetroLib][Optionals]") {
+    SECTION("Only set values are visited") {
+        Retro::Optionals::TOptionalColumn<FString> Column = {FString(TEXT("A")), {}, FString(TEXT("C"))};
+        Column.SetNum(100);
+        Column.Emplace(70, TEXT("D"));
+        CHECK(Column.Num() == 100);
+        CHECK(Column.NumSet() == 3);
+        CHECK(Column.IsSet(0));
+        CHECK_FALSE(Column.IsSet(1));
+
+        TArray<int32> Indices;
+        TArray<FString> Values;
+        for (auto It = Column.GetSetValues().begin(); It != std::default_sentinel; ++It) {
+            Indices.Add(It.GetIndex());
+            Values.Add(*It);
+        }
+        CHECK(Indices == TArray<int32>({0, 2, 70}));
+        CHECK(Values == TArray<FString>({TEXT("A"), TEXT("C"), TEXT("D")}));
+    }
+
+    SECTION("Entries can be accessed as reference optionals") {
+        Retro::Optionals::TOptionalColumn<FString> Column = {FString(TEXT("A")), {}};
+        TOptional<FString &> First = Column[0];
+        REQUIRE(First.IsSet());
+        *First = TEXT("B");
+        CHECK(Column[0].GetValue() == TEXT("B"));
+        CHECK_FALSE(Column[1].IsSet());
+
+        Column.Unset(0);
+        CHECK(Column.NumSet() == 0);
+
+        auto Joined = Column | std::ranges::views::join | Retro::Ranges::To<TArray>();
+        CHECK(Joined.IsEmpty());
+    }
+
+    SECTION("Columns can be copied and moved") {
+        Retro::Optionals::TOptionalColumn<FString> Column = {FString(TEXT("A")), {}, FString(TEXT("C"))};
+        auto Copy = Column;
+        Copy.Unset(2);
+        CHECK(Column.NumSet() == 2);
+        CHECK(Copy.NumSet() == 1);
+
+        auto Moved = MoveTemp(Copy);
+        CHECK(Moved.Num() == 3);
+        CHECK(Copy.Num() == 0);
+
+        Column = Moved;
+        CHECK(Column.NumSet() == 1);
+    }
+
+    SECTION("Niche types are stored without a mask") {
+        static_assert(Retro::Optionals::HasOptionalNiche<UObject *>);
+        static_assert(Retro::Optionals::HasOptionalNiche<EOptionalColumnTestSlot>);
+        static_assert(!Retro::Optionals::HasOptionalNiche<int32>);
+
+        Retro::Optionals::TOptionalColumn<EOptionalColumnTestSlot> Column = {
+            EOptionalColumnTestSlot::First, {}, EOptionalColumnTestSlot::Second, {}, EOptionalColumnTestSlot::Third};
+        CHECK(Column.NumSet() == 3);
+        CHECK_FALSE(Column.IsSet(1));
+        auto Values = Column.GetSetValues() | Retro::Ranges::To<TArray>();
+        CHECK(Values == TArray<EOptionalColumnTestSlot>({EOptionalColumnTestSlot::First, EOptionalColumnTestSlot::Second,
+                                                         EOptionalColumnTestSlot::Third}));
+    }
+}
+
+#endif
@@ -0,0 +1,97 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/AnyView.h"
+#include "RetroLib/Ranges/Views/Filter.h"
+#include "RetroLib/Ranges/Views/Transform.h"
+#include "Tests/TestHarnessAdapter.h"
+
+#include <sstream>
+
+namespace Retro::Testing::AnyView {
+    class IEvenNumberSource {
+      public:
+        virtual ~IEvenNumberSource() = default;
+
+        virtual Ranges::TAnyForwardView<const int32 &> GetEvenNumbers() const = 0;
+    };
+
+    class FEvenNumberSource : public IEvenNumberSource {
+      public:
+        explicit FEvenNumberSource(TArray<int32> Values) : Values(std::move(Values)) {
+        }
+
+        Ranges::TAnyForwardView<const int32 &> GetEvenNumbers() const override {
+            return Values | Ranges::Views::Filter([](int32 Value) { return Value % 2 == 0; });
+        }
+
+      private:
+        TArray<int32> Values;
+    };
+} // namespace Retro::Testing::AnyView
+
+TEST_CASE_NAMED(FAnyViewTest, "RetroLib::Ranges::Views::AnyView", "[RetroLib][Ranges]") {
+    using namespace Retro::Testing::AnyView;
+
+    SECTION("Can return a pipeline through a virtual function") {
+        static_assert(std::ranges::forward_range<Retro::Ranges::TAnyForwardView<const int32 &>>);
+        TArray<int32> Values;
+        for (int32 i = 1; i <= 40; i++) {
+            Values.Add(i);
+        }
+
+        FEvenNumberSource Source(std::move(Values));
+        const IEvenNumberSource &Interface = Source;
+        auto EvenNumbers = Interface.GetEvenNumbers();
+
+        int32 Sum = 0;
+        for (const int32 &Value : EvenNumbers) {
+            Sum += Value;
+        }
+        CHECK(Sum == 420);
+
+        auto AsArray = EvenNumbers | Retro::Ranges::To<TArray>();
+        REQUIRE(AsArray.Num() == 20);
+        CHECK(AsArray[0] == 2);
+        CHECK(AsArray[19] == 40);
+    }
+
+    SECTION("Forward views can be iterated with copied iterators") {
+        TArray Values = {1, 2, 3};
+        Retro::Ranges::TAnyForwardView<int32> View = Values;
+        auto First = View.begin();
+        auto Second = First;
+        ++Second;
+        CHECK(*First == 1);
+        CHECK(*Second == 2);
+        CHECK_FALSE(First == Second);
+    }
+
+    SECTION("Input views can wrap single pass pipelines by value") {
+        static_assert(std::ranges::input_range<Retro::Ranges::TAnyInputView<FString>>);
+        static_assert(!std::copy_constructible<Retro::Ranges::TAnyInputView<FString>>);
+        TArray Values = {1, 2, 3};
+        Retro::Ranges::TAnyInputView<FString> View =
+            Values | Retro::Ranges::Views::Transform([](int32 Value) { return FString::FromInt(Value); });
+        auto Strings = View | Retro::Ranges::To<TArray>();
+        CHECK(Strings == TArray<FString>({TEXT("1"), TEXT("2"), TEXT("3")}));
+    }
+
+    SECTION("Single pass ranges that stash their element can only be erased by value") {
+        static_assert(!std::constructible_from<Retro::Ranges::TAnyInputView<int32 &>,
+                                               std::ranges::istream_view<int32> &>);
+        static_assert(std::constructible_from<Retro::Ranges::TAnyInputView<int32>, std::ranges::istream_view<int32> &>);
+
+        std::istringstream Stream("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20");
+        auto Input = std::views::istream<int32>(Stream);
+        Retro::Ranges::TAnyInputView<int32> View = Input;
+        TArray<int32> Expected;
+        for (int32 i = 1; i <= 20; i++) {
+            Expected.Add(i);
+        }
+        CHECK((View | Retro::Ranges::To<TArray>()) == Expected);
+    }
+}
+
+#endif
@@ -0,0 +1,77 @@
+﻿#if WITH_TESTS
+
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Texture2D.h"
+#include "RetroLib/Ranges/Views/AssetQuery.h"
+#include "Tests/TestHarnessAdapter.h"
+#include "UObject/Package.h"
+
+TEST_CASE_NAMED(FAssetQueryTest, "RetroLib::Ranges::AssetQuery", "[RetroLib][Ranges]") {
+    IAssetRegistry &Registry = IAssetRegistry::GetChecked();
+    Registry.ScanPathsSynchronous({TEXT("/Engine/EngineResources")});
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UTexture2D::StaticClass()->GetClassPathName());
+    Filter.PackagePaths.Add(TEXT("/Engine/EngineResources"));
+    Filter.bRecursivePaths = true;
+    TArray<FAssetData> Expected;
+    Registry.GetAssets(Filter, Expected);
+
+    auto MakeQuery = [] {
+        return Retro::Ranges::FAssetQuery().OfClass<UTexture2D>(false).UnderPath(TEXT("/Engine/EngineResources"));
+    };
+
+    SECTION("Filters are pushed down into the registry") {
+        CHECK(MakeQuery().Count() == Expected.Num());
+        CHECK(MakeQuery().GetFilter().ClassPaths == Filter.ClassPaths);
+
+        TArray<FAssetData> Streamed;
+        MakeQuery().ForEach([&Streamed](const FAssetData &Asset) { Streamed.Add(Asset); });
+        CHECK(Streamed.Num() == Expected.Num());
+        for (const FAssetData &Asset : Streamed) {
+            CHECK(Expected.Contains(Asset));
+        }
+    }
+
+    SECTION("Take and the callback stop the enumeration early") {
+        REQUIRE(Expected.Num() > 2);
+        CHECK(MakeQuery().Take(2).Count() == 2);
+        CHECK(MakeQuery().Take(0).Count() == 0);
+
+        int32 Calls = 0;
+        MakeQuery().ForEach([&Calls](const FAssetData &) { return ++Calls < 3; });
+        CHECK(Calls == 3);
+
+        TOptional<FAssetData> First = MakeQuery().First();
+        REQUIRE(First.IsSet());
+        CHECK(Expected.Contains(First.GetValue()));
+    }
+
+    SECTION("Predicates run before the limit is applied") {
+        FName Excluded = Expected[0].AssetName;
+        auto Filtered = MakeQuery().Where([Excluded](const FAssetData &Asset) { return Asset.AssetName != Excluded; });
+        CHECK(Filtered.Count() == Expected.Num() - 1);
+        for (const FAssetData &Asset : Filtered.Take(1).ToArray()) {
+            CHECK(Asset.AssetName != Excluded);
+        }
+    }
+
+    SECTION("Unfiltered queries respect the on-disk flag") {
+        UPackage *Package = CreatePackage(TEXT("/Temp/RetroLibAssetQueryTest"));
+        UTexture2D *Texture = NewObject<UTexture2D>(Package, TEXT("InMemoryTexture"), RF_Public | RF_Standalone);
+        FSoftObjectPath TexturePath(Texture);
+
+        // A predicate leaves the registry filter empty, so every asset in the registry is enumerated
+        auto IsTexture = [&TexturePath](const FAssetData &Asset) { return Asset.GetSoftObjectPath() == TexturePath; };
+        CHECK(Retro::Ranges::FAssetQuery().GetFilter().IsEmpty());
+        CHECK(Retro::Ranges::FAssetQuery().Where(IsTexture).Count() == 1);
+        CHECK(Retro::Ranges::FAssetQuery().OnDiskOnly().Where(IsTexture).Count() == 0);
+        CHECK(Retro::Ranges::FAssetQuery().OnDiskOnly().Take(1).Count() == 1);
+
+        Texture->ClearFlags(RF_Public | RF_Standalone);
+        Texture->MarkAsGarbage();
+        Package->MarkAsGarbage();
+    }
+}
+
+#endif
@@ -0,0 +1,90 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/Cache.h"
+#include "RetroLib/Ranges/Views/ClassView.h"
+#include "RetroLib/Ranges/Views/Filter.h"
+#include "RetroLib/Ranges/Views/Transform.h"
+#include "Tests/TestHarnessAdapter.h"
+
+TEST_CASE_NAMED(FCacheViewTest, "RetroLib::Ranges::Views::Cache", "[RetroLib][Ranges]") {
+    SECTION("Transform stages are only evaluated once per element") {
+        TArray Values = {1, 2, 3, 4, 5};
+        int32 Evaluations = 0;
+        auto Cached = Values | Retro::Ranges::Views::Transform([&Evaluations](int32 Value) {
+                          Evaluations++;
+                          return FString::FromInt(Value);
+                      }) |
+                      Retro::Ranges::Views::Cache();
+        static_assert(std::ranges::random_access_range<decltype(Cached)>);
+
+        auto FirstPass = Cached | Retro::Ranges::To<TArray>();
+        auto SecondPass = Cached | Retro::Ranges::To<TArray>();
+        CHECK(FirstPass == SecondPass);
+        CHECK(Evaluations == 5);
+        CHECK(Cached[2] == TEXT("3"));
+        CHECK(Evaluations == 5);
+        CHECK(Cached.IsFullyCached());
+    }
+
+    SECTION("Elements are computed lazily and keep stable addresses") {
+        TArray<int32> Values;
+        for (int32 i = 0; i < 10000; i++) {
+            Values.Add(i);
+        }
+
+        int32 Evaluations = 0;
+        auto Cached = Values | Retro::Ranges::Views::Transform([&Evaluations](int32 Value) {
+                          Evaluations++;
+                          return Value * 2;
+                      }) |
+                      Retro::Ranges::Views::Memoize();
+        const int32 &First = Cached.At(0);
+        CHECK(Evaluations == 1);
+        CHECK(Cached.At(100) == 200);
+        CHECK(Evaluations == 101);
+        CHECK(Cached.CacheAll() == 10000);
+        CHECK(&First == &Cached.At(0));
+    }
+
+    SECTION("Invalidating the cache picks up changes to the source") {
+        TArray Values = {1, 2, 3};
+        auto Cached = Values | Retro::Ranges::Views::Cache();
+        CHECK(Cached.CacheAll() == 3);
+
+        Values.Add(4);
+        CHECK(Cached.CacheAll() == 3);
+        Cached.Invalidate();
+        CHECK(Cached.CacheAll() == 4);
+        CHECK(Cached.At(3) == 4);
+    }
+
+    SECTION("Moving a partially consumed view restarts the underlying iteration") {
+        TArray Values = {1, 2, 3, 4, 5, 6};
+        auto Cached = Values | Retro::Ranges::Views::Filter([](int32 Value) { return Value % 2 == 0; }) |
+                      Retro::Ranges::Views::Cache();
+        CHECK(Cached.At(1) == 4);
+        CHECK(Cached.NumCached() == 2);
+
+        auto Moved = std::move(Cached);
+        CHECK(Moved.NumCached() == 0);
+        CHECK((Moved | Retro::Ranges::To<TArray>()) == TArray<int32>({2, 4, 6}));
+        CHECK(Moved.IsFullyCached());
+
+        auto MovedAgain = std::move(Moved);
+        CHECK(MovedAgain.IsFullyCached());
+        CHECK(MovedAgain.NumCached() == 3);
+        CHECK(MovedAgain.At(2) == 6);
+    }
+
+    SECTION("Single pass views can be iterated more than once") {
+        auto Cached = Retro::Ranges::TClassView<AActor>() | Retro::Ranges::Views::Cache();
+        auto FirstPass = Cached | Retro::Ranges::To<TArray>();
+        auto SecondPass = Cached | Retro::Ranges::To<TArray>();
+        CHECK(FirstPass.Num() > 0);
+        CHECK(FirstPass == SecondPass);
+    }
+}
+
+#endif
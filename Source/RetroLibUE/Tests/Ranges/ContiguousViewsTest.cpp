@@ -0,0 +1,76 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/ContiguousChunk.h"
+#include "RetroLib/Ranges/Views/ContiguousStride.h"
+#include "RetroLib/Ranges/Views/SimdBatches.h"
+#include "Tests/TestHarnessAdapter.h"
+
+TEST_CASE_NAMED(FContiguousViewsTest, "RetroLib::Ranges::Views::Contiguous", "[RetroLib][Ranges]") {
+    SECTION("Can split a TArray into chunks") {
+        static_assert(std::ranges::random_access_range<decltype(std::declval<TArray<float> &>() |
+                                                                Retro::Ranges::Views::Chunk(4))>);
+        TArray<float> Container = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        auto Chunks = Container | Retro::Ranges::Views::Chunk(4);
+        REQUIRE(Chunks.size() == 3);
+        CHECK(Chunks[0].Num() == 4);
+        CHECK(Chunks[1].Num() == 4);
+        CHECK(Chunks[2].Num() == 2);
+        CHECK(Chunks[1].GetData() == Container.GetData() + 4);
+
+        float Sum = 0;
+        for (TArrayView<float> Chunk : Chunks) {
+            for (float Value : Chunk) {
+                Sum += Value;
+            }
+        }
+        CHECK(Sum == 55);
+    }
+
+    SECTION("Can stride over a TArrayView") {
+        TArray Container = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        TArrayView<int32> View = Container;
+        auto Strided = View | Retro::Ranges::Views::Stride(3);
+        REQUIRE(Strided.size() == 4);
+        CHECK(Strided[0] == 1);
+        CHECK(Strided[1] == 4);
+        CHECK(Strided[2] == 7);
+        CHECK(Strided[3] == 10);
+
+        for (int32 &Value : Strided) {
+            Value = 0;
+        }
+        CHECK(Container == TArray({0, 2, 3, 0, 5, 6, 0, 8, 9, 0}));
+    }
+
+    SECTION("Can split a range into aligned SIMD batches") {
+        TArray<float> Container;
+        for (int32 i = 0; i < 37; i++) {
+            Container.Add(static_cast<float>(i));
+        }
+
+        TArrayView<float> Offset = TArrayView<float>(Container).RightChop(1);
+        auto Batches = Offset | Retro::Ranges::Views::SimdBatches<4>();
+        CHECK(Batches.GetHead().Num() + Batches.GetBody().Num() + Batches.GetTail().Num() == 36);
+        CHECK(Batches.GetTail().Num() < 4);
+        CHECK(Batches.GetHead().Num() < 4);
+
+        float Sum = 0;
+        for (float Value : Batches.GetHead()) {
+            Sum += Value;
+        }
+        for (TArrayView<float> Batch : Batches) {
+            CHECK(Batch.Num() == 4);
+            CHECK(IsAligned(Batch.GetData(), 16));
+            for (float Value : Batch) {
+                Sum += Value;
+            }
+        }
+        for (float Value : Batches.GetTail()) {
+            Sum += Value;
+        }
+        CHECK(Sum == 666);
+    }
+}
+
+#endif
@@ -0,0 +1,119 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Algorithm/GroupBy.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace Retro::Testing::GroupBy {
+    struct FEntityRecord {
+        int32 Team;
+        int32 Zone;
+        int32 Health;
+    };
+
+    TArray<FEntityRecord> MakeEntities(int32 Num) {
+        TArray<FEntityRecord> Result;
+        Result.Reserve(Num);
+        for (int32 i = 0; i < Num; i++) {
+            Result.Add({i % 3, (i * 7) % 11, i % 100});
+        }
+        return Result;
+    }
+} // namespace Retro::Testing::GroupBy
+
+TEST_CASE_NAMED(FGroupByTest, "RetroLib::Ranges::GroupBy", "[RetroLib][Ranges]") {
+    using namespace Retro::Testing::GroupBy;
+
+    SECTION("Groups keep the input order of their members") {
+        TArray<int32> Values = {5, 12, 7, 20, 9, 31};
+        auto ByTens = Values | Retro::Ranges::GroupBy([](int32 Value) { return Value / 10; });
+        REQUIRE(ByTens.Num() == 3);
+        CHECK(ByTens.GetKey(0) == 0);
+        CHECK(ByTens.GetKey(1) == 1);
+        CHECK(ByTens.GetKey(2) == 2);
+
+        TConstArrayView<int32> Ones = ByTens.FindGroup(0);
+        REQUIRE(Ones.Num() == 3);
+        CHECK(Ones[0] == 5);
+        CHECK(Ones[1] == 7);
+        CHECK(Ones[2] == 9);
+        CHECK(ByTens.FindGroup(1).Num() == 1);
+        CHECK(ByTens.FindGroup(4).IsEmpty());
+
+        // Every group is a slice of the one shared buffer
+        CHECK(ByTens.GetValues().Num() == Values.Num());
+        CHECK(ByTens[0].GetData() == ByTens.GetValues().GetData());
+    }
+
+    SECTION("Parallel grouping matches sequential grouping per key") {
+        TArray<FEntityRecord> Entities = MakeEntities(100000);
+        auto Sequential = Entities | Retro::Ranges::GroupBy(&FEntityRecord::Zone);
+        auto Parallel = Entities | Retro::Ranges::GroupBy(&FEntityRecord::Zone, Retro::Ranges::EGroupingMode::Parallel);
+        REQUIRE(Sequential.Num() == 11);
+        REQUIRE(Parallel.Num() == 11);
+
+        for (const auto &[Zone, Members] : Sequential) {
+            TConstArrayView<FEntityRecord> Other = Parallel.FindGroup(Zone);
+            REQUIRE(Other.Num() == Members.Num());
+            for (int32 i = 0; i < Members.Num(); i++) {
+                CHECK(Other[i].Health == Members[i].Health);
+                CHECK(Other[i].Team == Members[i].Team);
+            }
+        }
+    }
+
+    SECTION("Lazy pipelines can be grouped") {
+        auto Grouped = std::views::iota(0, 100) | std::views::filter([](int32 Value) { return Value % 2 == 0; }) |
+                       Retro::Ranges::GroupBy([](int32 Value) { return Value % 3; });
+        CHECK(Grouped.Num() == 3);
+        CHECK(Grouped.FindGroup(0).Num() == 17);
+
+        TMap<int32, TArray<int32>> AsMap = Grouped.ToMap();
+        CHECK(AsMap.Num() == 3);
+        CHECK(AsMap[1][0] == 4);
+    }
+}
+
+TEST_CASE_NAMED(FAggregateByTest, "RetroLib::Ranges::AggregateBy", "[RetroLib][Ranges]") {
+    using namespace Retro::Testing::GroupBy;
+    TArray<FEntityRecord> Entities = MakeEntities(100000);
+
+    TMap<int32, int64> Expected;
+    for (const FEntityRecord &Entity : Entities) {
+        Expected.FindOrAdd(Entity.Team) += Entity.Health;
+    }
+
+    SECTION("Folds can update in place or return the new value") {
+        auto InPlace = Entities | Retro::Ranges::AggregateBy(&FEntityRecord::Team, int64(0),
+                                                             [](int64 &Total, const FEntityRecord &Entity) {
+                                                                 Total += Entity.Health;
+                                                             });
+        auto ByValue = Entities | Retro::Ranges::AggregateBy(&FEntityRecord::Team, int64(0),
+                                                             [](int64 Total, const FEntityRecord &Entity) {
+                                                                 return Total + Entity.Health;
+                                                             });
+        CHECK(InPlace.OrderIndependentCompareEqual(Expected));
+        CHECK(ByValue.OrderIndependentCompareEqual(Expected));
+    }
+
+    SECTION("Parallel aggregation folds each key in input order") {
+        auto Sums = Entities | Retro::Ranges::AggregateBy(
+                                   &FEntityRecord::Team, int64(0),
+                                   [](int64 &Total, const FEntityRecord &Entity) { Total += Entity.Health; },
+                                   Retro::Ranges::EGroupingMode::Parallel);
+        CHECK(Sums.OrderIndependentCompareEqual(Expected));
+
+        TMap<int32, int32> LastHealth;
+        for (const FEntityRecord &Entity : Entities) {
+            LastHealth.Add(Entity.Zone, Entity.Health);
+        }
+
+        auto Last = Entities | Retro::Ranges::AggregateBy(
+                                   &FEntityRecord::Zone, -1,
+                                   [](int32, const FEntityRecord &Entity) { return Entity.Health; },
+                                   Retro::Ranges::EGroupingMode::Parallel);
+        CHECK(Last.OrderIndependentCompareEqual(LastHealth));
+    }
+}
+
+#endif
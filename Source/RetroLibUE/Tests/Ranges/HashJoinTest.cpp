@@ -0,0 +1,71 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/HashJoin.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace Retro::Testing::HashJoin {
+    struct FActorRecord {
+        int32 Id;
+        FName Name;
+    };
+
+    struct FComponentRecord {
+        int32 Owner;
+        int32 Value;
+    };
+} // namespace Retro::Testing::HashJoin
+
+TEST_CASE_NAMED(FHashJoinTest, "RetroLib::Ranges::Views::HashJoin", "[RetroLib][Ranges]") {
+    using namespace Retro::Testing::HashJoin;
+    TArray<FActorRecord> Actors = {{1, TEXT("A")}, {2, TEXT("B")}, {3, TEXT("C")}, {4, TEXT("D")}};
+    TArray<FComponentRecord> Components = {{3, 30}, {1, 10}, {5, 50}, {3, 31}, {1, 11}};
+
+    SECTION("Matches follow the probe order, then the build order") {
+        TArray<TPair<int32, int32>> Matches;
+        for (auto [Actor, Component] :
+             Actors | Retro::Ranges::Views::HashJoin(Components, &FActorRecord::Id, &FComponentRecord::Owner)) {
+            Matches.Emplace(Actor.Id, Component.Value);
+        }
+
+        TArray<TPair<int32, int32>> Expected = {{1, 10}, {1, 11}, {3, 30}, {3, 31}};
+        CHECK(Matches == Expected);
+    }
+
+    SECTION("Joined elements are references into both sides") {
+        for (auto [Actor, Component] :
+             Retro::Ranges::Views::HashJoin(Actors, Components, &FActorRecord::Id, &FComponentRecord::Owner)) {
+            Component.Value = Actor.Id * 100;
+        }
+
+        CHECK(Components[0].Value == 300);
+        CHECK(Components[2].Value == 50);
+        CHECK(Components[4].Value == 100);
+    }
+
+    SECTION("Lookup joins probe an existing map") {
+        TMap<FName, int32> Scores = {{TEXT("B"), 20}, {TEXT("D"), 40}, {TEXT("E"), 50}};
+        auto Joined = Actors | Retro::Ranges::Views::LookupJoin(Scores, &FActorRecord::Name);
+        CHECK(Joined.GetSizeHint() == 4);
+
+        TArray<int32> Totals;
+        for (auto [Actor, Score] : Joined) {
+            Totals.Add(Actor.Id + Score);
+        }
+        CHECK(Totals == TArray<int32>({22, 44}));
+    }
+
+    SECTION("Semi and anti joins split the probe side") {
+        auto Owners = Actors |
+                      Retro::Ranges::Views::SemiJoin(Components, &FActorRecord::Id, &FComponentRecord::Owner) |
+                      std::views::transform(&FActorRecord::Id);
+        CHECK((Owners | Retro::Ranges::To<TArray>()) == TArray<int32>({1, 3}));
+
+        TSet<int32> Known = {1, 2, 3, 4};
+        auto Orphans = Components | Retro::Ranges::Views::AntiJoin(Known, &FComponentRecord::Owner) |
+                       std::views::transform(&FComponentRecord::Value);
+        CHECK((Orphans | Retro::Ranges::To<TArray>()) == TArray<int32>({50}));
+    }
+}
+
+#endif
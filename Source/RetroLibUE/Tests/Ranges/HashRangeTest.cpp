@@ -0,0 +1,48 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Algorithm/HashRange.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "Tests/TestHarnessAdapter.h"
+
+TEST_CASE_NAMED(FHashRangeTest, "RetroLib::Ranges::HashRange", "[RetroLib][Ranges]") {
+    SECTION("Contiguous ranges hash their raw bytes") {
+        TArray<int32> Values = {1, 2, 3, 4};
+        CHECK(Retro::Ranges::HashRange(Values) == FXxHash64::HashBuffer(Values.GetData(), Values.NumBytes()).Hash);
+        CHECK((Values | Retro::Ranges::HashRange(Retro::Ranges::FXxHash128Hasher())) ==
+              FXxHash128::HashBuffer(Values.GetData(), Values.NumBytes()));
+        CHECK((Values | Retro::Ranges::HashRange(Retro::Ranges::FCrc32Hasher())) ==
+              FCrc::MemCrc32(Values.GetData(), Values.NumBytes()));
+
+        FString Text = TEXT("Content");
+        CHECK(Retro::Ranges::HashRange(Text) == FXxHash64::HashBuffer(*Text, Text.Len() * sizeof(TCHAR)).Hash);
+    }
+
+    SECTION("Streamed pipelines match the contiguous digest") {
+        // Several chunks, so that the contiguous path is split and hashed in parallel
+        TArray<int32> Values;
+        for (int32 i = 0; i < 1000000; i++) {
+            Values.Add(i * 7919);
+        }
+
+        auto Identity = std::views::transform([](int32 Value) { return Value; });
+        CHECK(Retro::Ranges::HashRange(Values) == (Values | Identity | Retro::Ranges::HashRange()));
+        CHECK(Retro::Ranges::HashRange(Values, Retro::Ranges::FCityHash64Hasher()) ==
+              (Values | Identity | Retro::Ranges::HashRange(Retro::Ranges::FCityHash64Hasher())));
+
+        Retro::Ranges::THashStream<Retro::Ranges::FXxHash64Hasher> Stream;
+        for (int32 Start = 0; Start < Values.Num(); Start += 12345) {
+            int32 Count = FMath::Min(12345, Values.Num() - Start);
+            Stream.Update(Values.GetData() + Start, Count * sizeof(int32));
+        }
+        CHECK(Stream.Finalize() == Retro::Ranges::HashRange(Values));
+    }
+
+    SECTION("Nested elements are length prefixed") {
+        TArray<FString> First = {TEXT("ab"), TEXT("c")};
+        TArray<FString> Second = {TEXT("a"), TEXT("bc")};
+        CHECK(Retro::Ranges::HashRange(First) != Retro::Ranges::HashRange(Second));
+        CHECK(Retro::Ranges::HashRange(First) == Retro::Ranges::HashRange(TArray<FString>(First)));
+    }
+}
+
+#endif
@@ -0,0 +1,81 @@
+﻿#if WITH_TESTS
+#include "RetroLib/Ranges/Views/PropertyView.h"
+#include "Tests/TestHarnessAdapter.h"
+
+TEST_CASE_NAMED(FPropertyViewTest, "RetroLib::Ranges::Views::PropertyView", "[RetroLib][Ranges]") {
+    SECTION("Visits the same properties as a field iterator") {
+        static_assert(std::ranges::random_access_range<Retro::Ranges::TPropertyView<FDoubleProperty>>);
+        static_assert(std::ranges::sized_range<Retro::Ranges::TConstPropertyView<FDoubleProperty>>);
+
+        FVector Vector(1.0, 2.0, 3.0);
+        UScriptStruct *Struct = TBaseStructure<FVector>::Get();
+        TArray<FProperty *> Expected;
+        for (TFieldIterator<FProperty> It(Struct); It; ++It) {
+            Expected.Add(*It);
+        }
+
+        Retro::Ranges::TPropertyView<FProperty> View(Struct, &Vector);
+        REQUIRE(View.size() == static_cast<size_t>(Expected.Num()));
+        int32 Index = 0;
+        for (auto [Property, ValuePtr] : View) {
+            CHECK(Property == Expected[Index]);
+            CHECK(ValuePtr == Expected[Index]->ContainerPtrToValuePtr<void>(&Vector));
+            Index++;
+        }
+    }
+
+    SECTION("Only visits properties of the requested type") {
+        const FVector Vector(1.0, 2.0, 3.0);
+        Retro::Ranges::TConstPropertyView<FDoubleProperty> View(TBaseStructure<FVector>::Get(), &Vector);
+        REQUIRE(View.size() == 3);
+        CHECK(*View[0].GetValuePtr<double>() == 1.0);
+        CHECK(*View[1].GetValuePtr<double>() == 2.0);
+        CHECK(*View[2].GetValuePtr<double>() == 3.0);
+
+        Retro::Ranges::TConstPropertyView<FBoolProperty> Empty(TBaseStructure<FVector>::Get(), &Vector);
+        CHECK(Empty.empty());
+    }
+
+    SECTION("Values can be written through the view") {
+        FVector Vector(1.0, 2.0, 3.0);
+        for (auto Value : Retro::Ranges::TPropertyView<FDoubleProperty>(TBaseStructure<FVector>::Get(), &Vector)) {
+            Value.Property->SetPropertyValue(Value.ValuePtr, 5.0);
+        }
+        CHECK(Vector == FVector(5.0, 5.0, 5.0));
+    }
+
+    SECTION("Layouts are shared until invalidated") {
+        UScriptStruct *Struct = TBaseStructure<FVector>::Get();
+        auto First = Retro::Ranges::FPropertyLayout::Get(Struct, FDoubleProperty::StaticClass());
+        auto Second = Retro::Ranges::FPropertyLayout::Get(Struct, FDoubleProperty::StaticClass());
+        CHECK(&First.Get() == &Second.Get());
+        CHECK(First->Matches(Struct));
+
+        auto Other = Retro::Ranges::FPropertyLayout::Get(Struct, FProperty::StaticClass());
+        CHECK(&First.Get() != &Other.Get());
+
+        Retro::Ranges::FPropertyLayout::Invalidate(Struct);
+        auto Rebuilt = Retro::Ranges::FPropertyLayout::Get(Struct, FDoubleProperty::StaticClass());
+        CHECK(&First.Get() != &Rebuilt.Get());
+        CHECK(Rebuilt->GetEntries().Num() == First->GetEntries().Num());
+    }
+
+    SECTION("Can view the properties of an object") {
+        const UObject *Object = GetDefault<UObject>();
+        Retro::Ranges::TConstPropertyView<FProperty> View(Object);
+        int32 Count = 0;
+        for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It) {
+            Count++;
+        }
+
+        // Static arrays produce an element per index, so there can be more elements than properties
+        CHECK(View.size() >= static_cast<size_t>(Count));
+        CHECK(std::ranges::all_of(View, [Object](const auto &Value) {
+            return Value.ValuePtr >= static_cast<const void *>(Object) &&
+                   static_cast<const uint8 *>(Value.ValuePtr) < reinterpret_cast<const uint8 *>(Object) +
+                                                                    Object->GetClass()->GetPropertiesSize();
+        }));
+    }
+}
+
+#endif
@@ -0,0 +1,72 @@
+﻿#if WITH_TESTS
+
+#include "Algo/IsSorted.h"
+#include "Math/RandomStream.h"
+#include "RetroLib/Ranges/Algorithm/RadixSort.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace Retro::Testing::RadixSort {
+    struct FSortItem {
+        float Depth;
+        int32 Order;
+    };
+
+    enum class ESortLayer : int8 {
+        Background = -1,
+        World = 0,
+        Overlay = 3
+    };
+} // namespace Retro::Testing::RadixSort
+
+TEST_CASE_NAMED(FRadixSortTest, "RetroLib::Ranges::RadixSort", "[RetroLib][Ranges]") {
+    using namespace Retro::Testing::RadixSort;
+    FRandomStream Stream(42);
+
+    SECTION("Signed integers are sorted in order") {
+        TArray<int32> Values;
+        for (int32 i = 0; i < 4096; i++) {
+            Values.Add(Stream.RandRange(-100000, 100000));
+        }
+
+        TArray<int32> Expected = Values;
+        Expected.Sort();
+        Retro::Ranges::RadixSort(Values);
+        CHECK(Values == Expected);
+    }
+
+    SECTION("Float keys are sorted stably, including negatives") {
+        TArray<FSortItem> Items;
+        for (int32 i = 0; i < 4096; i++) {
+            Items.Add({static_cast<float>(Stream.RandRange(-64, 64)) * 0.5f, i});
+        }
+
+        Retro::Ranges::RadixSort<FDefaultAllocator, 11>(Items, &FSortItem::Depth);
+        bool bSorted = true;
+        for (int32 i = 1; i < Items.Num(); i++) {
+            const FSortItem &Previous = Items[i - 1];
+            const FSortItem &Current = Items[i];
+            bSorted &= Previous.Depth < Current.Depth ||
+                       (Previous.Depth == Current.Depth && Previous.Order < Current.Order);
+        }
+        CHECK(bSorted);
+    }
+
+    SECTION("Enum keys and small ranges are supported") {
+        TArray Layers = {ESortLayer::Overlay, ESortLayer::Background, ESortLayer::World, ESortLayer::Background};
+        Retro::Ranges::RadixSort(Layers);
+        CHECK(Layers == TArray{ESortLayer::Background, ESortLayer::Background, ESortLayer::World, ESortLayer::Overlay});
+    }
+
+    SECTION("Constant digits do not disturb the result") {
+        TArray<uint32> Values;
+        for (int32 i = 0; i < 2048; i++) {
+            Values.Add(0xAB000000u | static_cast<uint32>(Stream.RandHelper(256)));
+        }
+
+        Retro::Ranges::RadixSort<TInlineAllocator<256>>(Values);
+        CHECK(Algo::IsSorted(Values));
+    }
+}
+
+#endif
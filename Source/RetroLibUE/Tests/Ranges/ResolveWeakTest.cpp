@@ -0,0 +1,68 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Algorithm/ResolveAll.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/Filter.h"
+#include "RetroLib/Ranges/Views/ResolveWeak.h"
+#include "Tests/TestHarnessAdapter.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+TEST_CASE_NAMED(FResolveWeakTest, "RetroLib::Ranges::Views::ResolveWeak", "[RetroLib][Ranges]") {
+    TArray<TStrongObjectPtr<UObject>> Objects;
+    TArray<TWeakObjectPtr<UObject>> Handles;
+    for (int32 i = 0; i < 8; i++) {
+        auto &Object = Objects.Emplace_GetRef(NewObject<UObject>(GetTransientPackage()));
+        Handles.Emplace(Object.Get());
+        if (i % 3 == 0) {
+            Handles.Emplace();
+        }
+    }
+    Objects[2]->MarkAsGarbage();
+    Objects[5]->MarkAsGarbage();
+
+    TArray<UObject *> Expected;
+    for (const auto &Handle : Handles) {
+        if (UObject *Object = Handle.Get(); Object != nullptr) {
+            Expected.Add(Object);
+        }
+    }
+    REQUIRE(Expected.Num() == 6);
+
+    SECTION("View skips stale handles") {
+        static_assert(std::ranges::forward_range<decltype(Handles | Retro::Ranges::Views::ResolveWeak())>);
+        auto Resolved = Handles | Retro::Ranges::Views::ResolveWeak() | Retro::Ranges::To<TArray>();
+        CHECK(Resolved == Expected);
+    }
+
+    SECTION("View composes with other views") {
+        auto Resolved = Handles | Retro::Ranges::Views::ResolveWeak() |
+                        Retro::Ranges::Views::Filter([&Objects](const UObject *Object) {
+                            return Object != Objects[0].Get();
+                        }) |
+                        Retro::Ranges::To<TArray>();
+        CHECK(Resolved.Num() == Expected.Num() - 1);
+        CHECK(!Resolved.Contains(Objects[0].Get()));
+    }
+
+    SECTION("ResolveAll collects the live objects") {
+        CHECK((Handles | Retro::Ranges::ResolveAll()) == Expected);
+        CHECK(Retro::Ranges::ResolveAll(TArray<TWeakObjectPtr<UObject>>()).IsEmpty());
+    }
+
+    SECTION("ResolveAndCompact removes stale handles in place") {
+        auto Resolved = Retro::Ranges::ResolveAndCompact(Handles);
+        CHECK(Resolved == Expected);
+        REQUIRE(Handles.Num() == Expected.Num());
+        for (int32 i = 0; i < Handles.Num(); i++) {
+            CHECK(Handles[i].Get() == Resolved[i]);
+        }
+    }
+
+    for (auto &Object : Objects) {
+        Object->ClearGarbage();
+    }
+}
+
+#endif
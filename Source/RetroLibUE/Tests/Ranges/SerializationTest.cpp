@@ -0,0 +1,77 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Algorithm/SerializeTo.h"
+#include "RetroLib/Ranges/Algorithm/ToArray.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/Deserialize.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Tests/TestHarnessAdapter.h"
+
+TEST_CASE_NAMED(FSerializationTest, "RetroLib::Ranges::Serialization", "[RetroLib][Ranges]") {
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+
+    SECTION("Contiguous ranges use the TArray layout") {
+        TArray<int32> Values;
+        for (int32 i = 0; i < 5000; i++) {
+            Values.Add(i * 3);
+        }
+
+        CHECK((Values | Retro::Ranges::SerializeTo(Writer)) == 5000);
+
+        FMemoryReader Reader(Bytes);
+        TArray<int32> Loaded;
+        Reader << Loaded;
+        CHECK(Loaded == Values);
+    }
+
+    SECTION("Unsized ranges have their count patched in") {
+        auto Odd = std::views::iota(0, 1000) | std::views::filter([](int32 i) { return i % 2 == 1; });
+        CHECK(Retro::Ranges::SerializeTo(Odd, Writer) == 500);
+        int32 Sentinel = 12345;
+        Writer << Sentinel;
+
+        FMemoryReader Reader(Bytes);
+        auto Loaded = Retro::Ranges::Views::Deserialize<int32>(Reader);
+        CHECK(Loaded.GetSizeHint() == 500);
+
+        int32 Expected = 1;
+        bool bMatches = true;
+        for (int32 Value : Loaded) {
+            bMatches &= Value == Expected;
+            Expected += 2;
+        }
+        CHECK(bMatches);
+        CHECK(Expected == 1001);
+
+        int32 Trailing = 0;
+        Reader << Trailing;
+        CHECK(Trailing == Sentinel);
+    }
+
+    SECTION("Elements without a bulk layout are read one at a time") {
+        TArray<FString> Names = {TEXT("Alpha"), TEXT("Beta"), TEXT("Gamma")};
+        const TArray<FString> &ConstNames = Names;
+        ConstNames | Retro::Ranges::SerializeTo(Writer);
+
+        FMemoryReader Reader(Bytes);
+        TArray<FString> Loaded = Retro::Ranges::Views::Deserialize<FString>(Reader) |
+                                 std::views::filter([](const FString &Name) { return !Name.StartsWith(TEXT("B")); }) |
+                                 Retro::Ranges::ToArray();
+        CHECK(Loaded == TArray<FString>({TEXT("Alpha"), TEXT("Gamma")}));
+    }
+
+    SECTION("A count that runs past the end of the archive is rejected") {
+        int32 Count = 1000000;
+        int32 Value = 7;
+        Writer << Count << Value;
+
+        FMemoryReader Reader(Bytes);
+        auto Loaded = Retro::Ranges::Views::Deserialize<int32>(Reader);
+        CHECK(Reader.IsError());
+        CHECK(Loaded.begin() == Loaded.end());
+    }
+}
+
+#endif
@@ -0,0 +1,71 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Algorithm/ToBitArray.h"
+#include "RetroLib/Ranges/Views/SetBits.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace Retro::Testing::SetBits {
+    static TBitArray<> MakeBits(int32 Num, int32 Stride, int32 Offset = 0) {
+        TBitArray<> Result(false, Num);
+        for (int32 i = Offset; i < Num; i += Stride) {
+            Result[i] = true;
+        }
+        return Result;
+    }
+
+    template <typename R>
+    static TArray<int32> Collect(R &&Range) {
+        TArray<int32> Result;
+        for (int32 Index : Range) {
+            Result.Add(Index);
+        }
+        return Result;
+    }
+} // namespace Retro::Testing::SetBits
+
+TEST_CASE_NAMED(FSetBitsTest, "RetroLib::Ranges::Views::SetBits", "[RetroLib][Ranges]") {
+    using namespace Retro::Testing::SetBits;
+
+    SECTION("Set bits match TConstSetBitIterator") {
+        TBitArray<> Bits = MakeBits(1000, 7, 3);
+        TArray<int32> Expected;
+        for (TConstSetBitIterator<> It(Bits); It; ++It) {
+            Expected.Add(It.GetIndex());
+        }
+
+        auto View = Bits | Retro::Ranges::Views::SetBits();
+        CHECK(Collect(View) == Expected);
+        CHECK(View.CountSetBits() == Expected.Num());
+    }
+
+    SECTION("Masks can be combined lazily") {
+        TBitArray<> Twos = MakeBits(130, 2);
+        TBitArray<> Threes = MakeBits(130, 3);
+        TBitArray<> Sixes = MakeBits(130, 6);
+        TBitArray<> Short = MakeBits(40, 1);
+
+        CHECK(Collect(Retro::Ranges::Views::BitAnd(Twos, Threes)) == Collect(Sixes | Retro::Ranges::Views::SetBits()));
+        CHECK(Collect(Retro::Ranges::Views::BitAnd(Twos, Threes, Short)) == TArray{0, 6, 12, 18, 24, 30, 36});
+
+        auto Either = Retro::Ranges::Views::BitOr(Twos, Threes);
+        CHECK(Either.NumBits() == 130);
+        CHECK(Either.CountSetBits() == 65 + 44 - 22);
+
+        auto OnlyTwos = Collect(Retro::Ranges::Views::BitAndNot(Twos, Threes, Short));
+        REQUIRE(OnlyTwos.Num() > 0);
+        CHECK(OnlyTwos[0] == 40);
+        CHECK_FALSE(OnlyTwos.Contains(42));
+    }
+
+    SECTION("Combinations can be written back to a bit array") {
+        TBitArray<> Twos = MakeBits(100, 2);
+        TBitArray<> Fives = MakeBits(100, 5);
+        TBitArray<> Result = Retro::Ranges::Views::BitXor(Twos, Fives) | Retro::Ranges::ToBitArray();
+        REQUIRE(Result.Num() == 100);
+        for (int32 i = 0; i < 100; i++) {
+            CHECK(Result[i] == ((i % 2 == 0) != (i % 5 == 0)));
+        }
+    }
+}
+
+#endif
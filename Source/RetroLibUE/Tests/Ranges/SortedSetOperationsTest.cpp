@@ -0,0 +1,95 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/SortedSetOperations.h"
+#include "Tests/TestHarnessAdapter.h"
+
+TEST_CASE_NAMED(FSortedSetOperationsTest, "RetroLib::Ranges::Views::SortedSetOperations", "[RetroLib][Ranges]") {
+    TArray<int32> First = {1, 2, 2, 4, 6, 8};
+    TArray<int32> Second = {2, 3, 4, 4, 8, 9};
+
+    SECTION("Operations follow multiset semantics") {
+        CHECK((Retro::Ranges::Views::MergeSorted(First, Second) | Retro::Ranges::To<TArray>()) ==
+              TArray<int32>({1, 2, 2, 2, 3, 4, 4, 4, 6, 8, 8, 9}));
+        CHECK((First | Retro::Ranges::Views::SetUnion(Second) | Retro::Ranges::To<TArray>()) ==
+              TArray<int32>({1, 2, 2, 3, 4, 4, 6, 8, 9}));
+        CHECK((First | Retro::Ranges::Views::SetIntersection(Second) | Retro::Ranges::To<TArray>()) ==
+              TArray<int32>({2, 4, 8}));
+        CHECK((First | Retro::Ranges::Views::SetDifference(Second) | Retro::Ranges::To<TArray>()) ==
+              TArray<int32>({1, 2, 6}));
+        CHECK((First | Retro::Ranges::Views::SetSymmetricDifference(Second) | Retro::Ranges::To<TArray>()) ==
+              TArray<int32>({1, 2, 3, 4, 6, 9}));
+    }
+
+    SECTION("Views report exact or upper bound sizes") {
+        auto Merged = Retro::Ranges::Views::MergeSorted(First, Second);
+        CHECK(std::ranges::size(Merged) == 12);
+        CHECK((First | Retro::Ranges::Views::SetUnion(Second)).GetSizeHint() == 12);
+        CHECK((First | Retro::Ranges::Views::SetIntersection(Second)).GetSizeHint() == 6);
+
+        auto Filtered = Second | std::views::filter([](int32 Value) { return Value % 2 == 0; });
+        CHECK((First | Retro::Ranges::Views::SetDifference(Filtered)).GetSizeHint() == 6);
+    }
+
+    SECTION("Skewed inputs are skipped over") {
+        TArray<int32> Large;
+        for (int32 i = 0; i < 100000; i++) {
+            Large.Add(i * 2);
+        }
+
+        TArray<int32> Small = {3, 10, 500, 199998, 200000};
+        CHECK((Small | Retro::Ranges::Views::SetIntersection(Large) | Retro::Ranges::To<TArray>()) ==
+              TArray<int32>({10, 500, 199998}));
+        CHECK((Small | Retro::Ranges::Views::SetDifference(Large) | Retro::Ranges::To<TArray>()) ==
+              TArray<int32>({3, 200000}));
+    }
+
+    SECTION("Predicates and projections are applied to both sides") {
+        TArray<TPair<int32, int32>> Previous = {{1, 0}, {3, 0}, {5, 0}};
+        TArray<TPair<int32, int32>> Current = {{1, 1}, {4, 1}, {5, 1}};
+        auto Removed = Previous | Retro::Ranges::Views::SetDifference(Current, std::ranges::less(),
+                                                                      &TPair<int32, int32>::Key);
+        CHECK((Removed | std::views::transform(&TPair<int32, int32>::Key) | Retro::Ranges::To<TArray>()) ==
+              TArray<int32>({3}));
+
+        TArray<int32> Descending = {9, 5, 1};
+        TArray<int32> OtherDescending = {7, 5};
+        CHECK((Descending | Retro::Ranges::Views::SetUnion(OtherDescending, std::ranges::greater()) |
+               Retro::Ranges::To<TArray>()) == TArray<int32>({9, 7, 5, 1}));
+    }
+}
+
+TEST_CASE_NAMED(FMergeSortedRangesTest, "RetroLib::Ranges::Views::MergeSortedRanges", "[RetroLib][Ranges]") {
+    SECTION("Any number of inputs can be merged") {
+        TArray<TArray<int32>> Inputs = {{1, 4, 9}, {}, {2, 3, 10}, {0, 4}, {5}};
+        auto Merged = Inputs | Retro::Ranges::Views::MergeSortedRanges();
+        CHECK(Merged.GetSizeHint() == 9);
+        CHECK((Merged | Retro::Ranges::To<TArray>()) == TArray<int32>({0, 1, 2, 3, 4, 4, 5, 9, 10}));
+
+        TArray<TArray<int32>> None;
+        CHECK((None | Retro::Ranges::Views::MergeSortedRanges() | Retro::Ranges::To<TArray>()).IsEmpty());
+    }
+
+    SECTION("Equivalent elements keep the order of their inputs") {
+        TArray<TArray<TPair<int32, int32>>> Inputs = {{{1, 0}, {2, 0}}, {{1, 1}}, {{1, 2}, {2, 2}}};
+        auto Merged = Retro::Ranges::Views::MergeSortedRanges(Inputs, std::ranges::less(), &TPair<int32, int32>::Key) |
+                      std::views::transform(&TPair<int32, int32>::Value) | Retro::Ranges::To<TArray>();
+        CHECK(Merged == TArray<int32>({0, 1, 2, 0, 2}));
+    }
+
+    SECTION("Calling begin again continues from the current position") {
+        TArray<TArray<int32>> Inputs = {{1, 3}, {2, 4}};
+        auto Merged = Inputs | Retro::Ranges::Views::MergeSortedRanges();
+        auto It = Merged.begin();
+        REQUIRE(It != Merged.end());
+        CHECK(*It == 1);
+        ++It;
+
+        auto Restarted = Merged.begin();
+        REQUIRE(Restarted != Merged.end());
+        CHECK(*Restarted == 2);
+        CHECK((Merged | Retro::Ranges::To<TArray>()) == TArray<int32>({2, 3, 4}));
+    }
+}
+
+#endif
@@ -0,0 +1,141 @@
+﻿#if WITH_TESTS
+
+#include "RetroLib/Memory/AllocationCounter.h"
+#include "RetroLib/Memory/BumpArena.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Algorithm/ToArray.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/Filter.h"
+#include "RetroLib/Ranges/Views/Transform.h"
+#include "Tests/TestHarnessAdapter.h"
+
+namespace Retro::Testing::ToArray {
+    struct alignas(64) FCacheLine {
+        int32 Value;
+    };
+} // namespace Retro::Testing::ToArray
+
+TEST_CASE_NAMED(FToArrayTest, "RetroLib::Ranges::ToArray", "[RetroLib][Ranges]") {
+    TArray Values = {1, 2, 3, 4, 5, 6, 7, 8};
+    auto Doubled = Values | Retro::Ranges::Views::Transform([](int32 Value) { return Value * 2; });
+
+    SECTION("Default allocator matches To") {
+        auto Result = Doubled | Retro::Ranges::ToArray();
+        CHECK(Result == (Doubled | Retro::Ranges::To<TArray>()));
+    }
+
+    SECTION("Bump arena arrays do not touch the global allocator") {
+        // Make sure the arena owns a block before counting
+        {
+            Retro::FBumpArenaMark Mark;
+            Retro::FBumpArena::Get().Allocate(1024);
+        }
+
+        Retro::FScopedAllocationCounter Counter;
+        {
+            Retro::FBumpArenaMark Mark;
+            auto Result = Doubled | Retro::Ranges::ToArray<Retro::TBumpArenaAllocator<>>();
+            REQUIRE(Result.Num() == 8);
+            CHECK(Result[0] == 2);
+            CHECK(Result[7] == 16);
+
+            auto Filtered = Values | Retro::Ranges::Views::Filter([](int32 Value) { return Value % 2 == 0; }) |
+                            Retro::Ranges::To<Retro::Ranges::TBumpArenaArray>();
+            CHECK(Filtered.Num() == 4);
+        }
+        if (Retro::FScopedAllocationCounter::IsProxyInstalled()) {
+            CHECK(Counter.GetNumAllocations() == 0);
+            CHECK(Counter.GetNumFrees() == 0);
+        }
+    }
+
+    SECTION("Mem stack arrays do not touch the global allocator") {
+        {
+            FMemMark Mark(FMemStack::Get());
+            FMemStack::Get().Alloc(1024, 16);
+        }
+
+        Retro::FScopedAllocationCounter Counter;
+        {
+            FMemMark Mark(FMemStack::Get());
+            auto Result = Doubled | Retro::Ranges::ToArray<TMemStackAllocator<>>();
+            REQUIRE(Result.Num() == 8);
+            CHECK(Result[3] == 8);
+        }
+        if (Retro::FScopedAllocationCounter::IsProxyInstalled()) {
+            CHECK(Counter.GetNumAllocations() == 0);
+        }
+    }
+
+    SECTION("Inline arrays do not touch the global allocator") {
+        Retro::FScopedAllocationCounter Counter;
+        auto Result = Doubled | Retro::Ranges::ToArray<TInlineAllocator<8>>();
+        REQUIRE(Result.Num() == 8);
+        CHECK(Result[5] == 12);
+        if (Retro::FScopedAllocationCounter::IsProxyInstalled()) {
+            CHECK(Counter.GetNumAllocations() == 0);
+        }
+    }
+}
+
+TEST_CASE_NAMED(FBumpArenaTest, "RetroLib::Memory::BumpArena", "[RetroLib][Memory]") {
+    SECTION("Marks rewind the arena and blocks are reused") {
+        Retro::FBumpArena Arena(1024);
+        void *First;
+        {
+            Retro::FBumpArenaMark Mark(Arena);
+            First = Arena.Allocate(64);
+            CHECK(Arena.GetNumMarks() == 1);
+        }
+        CHECK(Arena.GetNumMarks() == 0);
+
+        SIZE_T Reserved = Arena.GetReservedSize();
+        {
+            Retro::FBumpArenaMark Mark(Arena);
+            CHECK(Arena.Allocate(64) == First);
+        }
+        CHECK(Arena.GetReservedSize() == Reserved);
+    }
+
+    SECTION("Oversized allocations get their own block") {
+        Retro::FBumpArena Arena(256);
+        void *Large = Arena.Allocate(4096, 64);
+        CHECK(reinterpret_cast<UPTRINT>(Large) % 64 == 0);
+        CHECK(Arena.GetReservedSize() >= 4096);
+        Arena.Reset();
+        Arena.Trim();
+    }
+
+    SECTION("Arrays can use the arena allocator directly") {
+        using Retro::Testing::ToArray::FCacheLine;
+        Retro::FBumpArenaMark Mark;
+        TArray<FCacheLine, Retro::TBumpArenaAllocator<>> Lines;
+        Lines.Reserve(4);
+        for (int32 i = 0; i < 100; i++) {
+            Lines.Add({i});
+            CHECK(reinterpret_cast<UPTRINT>(Lines.GetData()) % alignof(FCacheLine) == 0);
+        }
+        CHECK(Lines.Num() == 100);
+        CHECK(Lines[99].Value == 99);
+
+        Lines.RemoveAt(10, 80);
+        Lines.Shrink();
+        CHECK(Lines.Num() == 20);
+        CHECK(Lines[10].Value == 90);
+
+        TArray<FCacheLine, Retro::TBumpArenaAllocator<>> Moved = MoveTemp(Lines);
+        CHECK(Moved.Num() == 20);
+        CHECK(Lines.IsEmpty());
+    }
+
+    SECTION("The most recent allocation grows in place") {
+        Retro::FBumpArena Arena(1024);
+        void *Original = Arena.Allocate(32);
+        CHECK(Arena.Reallocate(Original, 32, 128) == Original);
+        void *Other = Arena.Allocate(16);
+        CHECK(Arena.Reallocate(Original, 128, 256) != Original);
+        CHECK(Other != nullptr);
+    }
+}
+
+#endif
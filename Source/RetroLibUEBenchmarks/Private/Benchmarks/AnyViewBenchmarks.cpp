@@ -0,0 +1,82 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/AnyView.h"
+#include "RetroLib/Ranges/Views/Filter.h"
+#include "RetroLib/Ranges/Views/Transform.h"
+
+namespace {
+    bool IsOdd(int32 Value) {
+        return Value % 2 != 0;
+    }
+
+    int32 Double(int32 Value) {
+        return Value * 2;
+    }
+
+    /**
+     * Stand-in for a function that takes a type-erased range across an API boundary.
+     */
+    FORCENOINLINE int64 SumErased(Retro::Ranges::TAnyInputView<int32> Values) {
+        int64 Sum = 0;
+        for (int32 Value : Values) {
+            Sum += Value;
+        }
+        return Sum;
+    }
+
+    /**
+     * Stand-in for a function that takes a materialized array across an API boundary.
+     */
+    FORCENOINLINE int64 SumArray(const TArray<int32> &Values) {
+        int64 Sum = 0;
+        for (int32 Value : Values) {
+            Sum += Value;
+        }
+        return Sum;
+    }
+} // namespace
+
+RETRO_BENCHMARK(ErasedPipelineSum, Loop) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (int32 Value : Data) {
+            if (IsOdd(Value)) {
+                Sum += Double(Value);
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(ErasedPipelineSum, RawPipeline) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (int32 Value : Data | Retro::Ranges::Views::Filter(&IsOdd) | Retro::Ranges::Views::Transform(&Double)) {
+            Sum += Value;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(ErasedPipelineSum, Materialized) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        auto Values = Data | Retro::Ranges::Views::Filter(&IsOdd) | Retro::Ranges::Views::Transform(&Double) |
+                      Retro::Ranges::To<TArray>();
+        Retro::Benchmarks::DoNotOptimize(SumArray(Values));
+    }
+}
+
+RETRO_BENCHMARK(ErasedPipelineSum, AnyView) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        Retro::Benchmarks::DoNotOptimize(
+            SumErased(Data | Retro::Ranges::Views::Filter(&IsOdd) | Retro::Ranges::Views::Transform(&Double)));
+    }
+}
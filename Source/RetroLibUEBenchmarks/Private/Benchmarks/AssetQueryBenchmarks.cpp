@@ -0,0 +1,40 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetRegistry/IAssetRegistry.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Views/AssetQuery.h"
+
+namespace {
+    FARFilter MakeEngineFilter() {
+        FARFilter Filter;
+        Filter.PackagePaths.Add(TEXT("/Engine"));
+        Filter.bRecursivePaths = true;
+        return Filter;
+    }
+
+    bool IsCandidate(const FAssetData &Asset) {
+        return !Asset.IsRedirector() && Asset.IsUAsset();
+    }
+} // namespace
+
+RETRO_BENCHMARK(AssetRegistryScan, Loop) {
+    IAssetRegistry &Registry = IAssetRegistry::GetChecked();
+    FARFilter Filter = MakeEngineFilter();
+    for (auto _ : State) {
+        TArray<FAssetData> Assets;
+        Registry.GetAssets(Filter, Assets);
+        int32 Count = 0;
+        for (const FAssetData &Asset : Assets) {
+            Count += IsCandidate(Asset) ? 1 : 0;
+        }
+        Retro::Benchmarks::DoNotOptimize(Count);
+    }
+}
+
+RETRO_BENCHMARK(AssetRegistryScan, Retro) {
+    auto Query = Retro::Ranges::FAssetQuery().UnderPath(TEXT("/Engine")).Where(&IsCandidate);
+    for (auto _ : State) {
+        int32 Count = Query.Count();
+        Retro::Benchmarks::DoNotOptimize(Count);
+    }
+}
@@ -0,0 +1,48 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Math/RandomStream.h>
+
+namespace Retro::Benchmarks {
+
+    /**
+     * The number of elements used by the container benchmarks. Large enough that per-call overhead does not dominate,
+     * small enough to stay in cache so that the benchmarks measure the code and not the memory system.
+     */
+    constexpr int32 NumBenchmarkElements = 4096;
+
+    /**
+     * Create an array of deterministic pseudo-random integers.
+     *
+     * @param Num The number of elements
+     * @param Max The exclusive upper bound of the values
+     * @return The generated values
+     */
+    inline TArray<int32> MakeRandomIntegers(int32 Num = NumBenchmarkElements, int32 Max = 1024) {
+        FRandomStream Stream(1337);
+        TArray<int32> Result;
+        Result.Reserve(Num);
+        for (int32 i = 0; i < Num; i++) {
+            Result.Add(Stream.RandHelper(Max));
+        }
+        return Result;
+    }
+
+    /**
+     * Create an array of deterministic pseudo-random floats in the range [-1, 1].
+     *
+     * @param Num The number of elements
+     * @return The generated values
+     */
+    inline TArray<float> MakeRandomFloats(int32 Num = NumBenchmarkElements) {
+        FRandomStream Stream(7331);
+        TArray<float> Result;
+        Result.Reserve(Num);
+        for (int32 i = 0; i < Num; i++) {
+            Result.Add(Stream.FRandRange(-1.f, 1.f));
+        }
+        return Result;
+    }
+} // namespace Retro::Benchmarks
@@ -0,0 +1,74 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Containers/BitArray.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Algorithm/ToBitArray.h"
+#include "RetroLib/Ranges/Views/SetBits.h"
+
+namespace {
+    /**
+     * The size of an entity mask, matching the per-frame queries these views are meant for.
+     */
+    constexpr int32 NumMaskBits = 100000;
+
+    TBitArray<> MakeMask(int32 Seed, int32 OneIn) {
+        FRandomStream Stream(Seed);
+        TBitArray<> Result(false, NumMaskBits);
+        for (int32 i = 0; i < NumMaskBits; i++) {
+            Result[i] = Stream.RandHelper(OneIn) == 0;
+        }
+        return Result;
+    }
+} // namespace
+
+RETRO_BENCHMARK(BitMaskQuery, Loop) {
+    TBitArray<> Transform = MakeMask(1, 2);
+    TBitArray<> Health = MakeMask(2, 3);
+    TBitArray<> Hidden = MakeMask(3, 8);
+    for (auto _ : State) {
+        TBitArray<> Combined = TBitArray<>::BitwiseAND(Transform, Health, EBitwiseOperatorFlags::MinSize);
+        int64 Sum = 0;
+        for (TConstSetBitIterator<> It(Combined); It; ++It) {
+            if (!Hidden[It.GetIndex()]) {
+                Sum += It.GetIndex();
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(BitMaskQuery, Retro) {
+    TBitArray<> Transform = MakeMask(1, 2);
+    TBitArray<> Health = MakeMask(2, 3);
+    TBitArray<> Hidden = MakeMask(3, 8);
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (int32 Index :
+             Retro::Ranges::Views::BitAndNot(Retro::Ranges::Views::BitAnd(Transform, Health), Hidden)) {
+            Sum += Index;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(BitMaskMaterialize, Loop) {
+    TBitArray<> Transform = MakeMask(1, 2);
+    TBitArray<> Health = MakeMask(2, 3);
+    for (auto _ : State) {
+        TBitArray<> Result(false, NumMaskBits);
+        for (int32 i = 0; i < NumMaskBits; i++) {
+            Result[i] = Transform[i] && Health[i];
+        }
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(BitMaskMaterialize, Retro) {
+    TBitArray<> Transform = MakeMask(1, 2);
+    TBitArray<> Health = MakeMask(2, 3);
+    for (auto _ : State) {
+        TBitArray<> Result = Retro::Ranges::Views::BitAnd(Transform, Health) | Retro::Ranges::ToBitArray();
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
@@ -0,0 +1,91 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Math/Box.h"
+#include "Math/VectorRegister.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/ContiguousChunk.h"
+#include "RetroLib/Ranges/Views/SimdBatches.h"
+
+namespace {
+    float ScalarDot(const float *A, const float *B, int32 Num) {
+        float Sum = 0;
+        for (int32 i = 0; i < Num; i++) {
+            Sum += A[i] * B[i];
+        }
+        return Sum;
+    }
+
+    TArray<FVector3f> MakePoints() {
+        TArray<float> Coordinates = Retro::Benchmarks::MakeRandomFloats(Retro::Benchmarks::NumBenchmarkElements * 3);
+        TArray<FVector3f> Points;
+        Points.Reserve(Retro::Benchmarks::NumBenchmarkElements);
+        for (int32 i = 0; i < Coordinates.Num(); i += 3) {
+            Points.Emplace(Coordinates[i], Coordinates[i + 1], Coordinates[i + 2]);
+        }
+        return Points;
+    }
+} // namespace
+
+RETRO_BENCHMARK(DotProduct, Loop) {
+    TArray<float> A = Retro::Benchmarks::MakeRandomFloats();
+    TArray<float> B = Retro::Benchmarks::MakeRandomFloats();
+    for (auto _ : State) {
+        Retro::Benchmarks::DoNotOptimize(ScalarDot(A.GetData(), B.GetData(), A.Num()));
+    }
+}
+
+RETRO_BENCHMARK(DotProduct, SimdBatches) {
+    TArray<float> A = Retro::Benchmarks::MakeRandomFloats();
+    TArray<float> B = Retro::Benchmarks::MakeRandomFloats();
+    for (auto _ : State) {
+        auto Batches = TArrayView<float>(A) | Retro::Ranges::Views::SimdBatches<4>();
+        const float *BData = B.GetData();
+
+        auto Head = Batches.GetHead();
+        float Sum = ScalarDot(Head.GetData(), BData, Head.Num());
+
+        VectorRegister4Float Accumulator = VectorZeroFloat();
+        for (TArrayView<float> Batch : Batches) {
+            const float *Other = BData + (Batch.GetData() - A.GetData());
+            Accumulator = VectorMultiplyAdd(VectorLoadAligned(Batch.GetData()), VectorLoad(Other), Accumulator);
+        }
+
+        alignas(16) float Lanes[4];
+        VectorStoreAligned(Accumulator, Lanes);
+        Sum += Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+
+        auto Tail = Batches.GetTail();
+        Sum += ScalarDot(Tail.GetData(), BData + (Tail.GetData() - A.GetData()), Tail.Num());
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(BoundingBox, Loop) {
+    TArray<FVector3f> Points = MakePoints();
+    for (auto _ : State) {
+        FBox3f Bounds(ForceInit);
+        for (const FVector3f &Point : Points) {
+            Bounds += Point;
+        }
+        Retro::Benchmarks::DoNotOptimize(Bounds);
+    }
+}
+
+RETRO_BENCHMARK(BoundingBox, Chunk) {
+    TArray<FVector3f> Points = MakePoints();
+    for (auto _ : State) {
+        FBox3f Bounds(ForceInit);
+        for (TArrayView<FVector3f> Chunk : Points | Retro::Ranges::Views::Chunk(256)) {
+            FVector3f Min = Chunk[0];
+            FVector3f Max = Chunk[0];
+            for (const FVector3f &Point : Chunk) {
+                Min = FVector3f::Min(Min, Point);
+                Max = FVector3f::Max(Max, Point);
+            }
+            Bounds += FBox3f(Min, Max);
+        }
+        Retro::Benchmarks::DoNotOptimize(Bounds);
+    }
+}
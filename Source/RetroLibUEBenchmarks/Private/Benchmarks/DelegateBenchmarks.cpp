@@ -0,0 +1,206 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Async/Async.h"
+#include "Components/TimelineComponent.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Functional/Delegates.h"
+#include "RetroLib/Functional/GameThreadDispatch.h"
+#include "RetroLib/Functional/StaticBindings.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace {
+    DECLARE_DELEGATE_RetVal_OneParam(int32, FBenchmarkDelegate, int32);
+    DECLARE_DELEGATE_OneParam(FBenchmarkVoidDelegate, int32);
+    DECLARE_MULTICAST_DELEGATE_OneParam(FBenchmarkMulticastDelegate, int32 &);
+
+    int32 AddOffset(int32 Value, int32 Offset) {
+        return Value + Offset;
+    }
+
+    void Accumulate(int32 &Total, int32 Value) {
+        Total += Value;
+    }
+
+    class FBenchmarkReceiver : public TSharedFromThis<FBenchmarkReceiver> {
+      public:
+        int32 Scale(int32 Value) const {
+            return Value * Factor;
+        }
+
+      private:
+        int32 Factor = 3;
+    };
+} // namespace
+
+RETRO_BENCHMARK(DelegateCreateStatic, Loop) {
+    for (auto _ : State) {
+        auto Delegate = FBenchmarkDelegate::CreateStatic(&AddOffset, 4);
+        Retro::Benchmarks::DoNotOptimize(Delegate);
+    }
+}
+
+RETRO_BENCHMARK(DelegateCreateStatic, Retro) {
+    for (auto _ : State) {
+        auto Delegate = Retro::Delegates::Create<FBenchmarkDelegate>(&AddOffset, 4);
+        Retro::Benchmarks::DoNotOptimize(Delegate);
+    }
+}
+
+RETRO_BENCHMARK(DelegateCreateSP, Loop) {
+    auto Receiver = MakeShared<FBenchmarkReceiver>();
+    for (auto _ : State) {
+        auto Delegate = FBenchmarkDelegate::CreateSP(Receiver, &FBenchmarkReceiver::Scale);
+        Retro::Benchmarks::DoNotOptimize(Delegate);
+    }
+}
+
+RETRO_BENCHMARK(DelegateCreateSP, Retro) {
+    auto Receiver = MakeShared<FBenchmarkReceiver>();
+    for (auto _ : State) {
+        auto Delegate = Retro::Delegates::Create<FBenchmarkDelegate>(Receiver, &FBenchmarkReceiver::Scale);
+        Retro::Benchmarks::DoNotOptimize(Delegate);
+    }
+}
+
+RETRO_BENCHMARK(DelegateBindLambda, Loop) {
+    FBenchmarkDelegate Delegate;
+    int32 Offset = 7;
+    for (auto _ : State) {
+        Delegate.BindLambda([Offset](int32 Value) { return Value + Offset; });
+        Retro::Benchmarks::DoNotOptimize(Delegate);
+    }
+}
+
+RETRO_BENCHMARK(DelegateBindLambda, Retro) {
+    FBenchmarkDelegate Delegate;
+    int32 Offset = 7;
+    for (auto _ : State) {
+        Delegate | Retro::Delegates::Bind([Offset](int32 Value) { return Value + Offset; });
+        Retro::Benchmarks::DoNotOptimize(Delegate);
+    }
+}
+
+RETRO_BENCHMARK(DelegateExecute, Loop) {
+    auto Delegate = FBenchmarkDelegate::CreateStatic(&AddOffset, 4);
+    int32 Value = 0;
+    for (auto _ : State) {
+        Value = Delegate.Execute(Value);
+    }
+    Retro::Benchmarks::DoNotOptimize(Value);
+}
+
+RETRO_BENCHMARK(DelegateExecute, Retro) {
+    Retro::Delegates::TDelegateInvoker Invoker(FBenchmarkDelegate::CreateStatic(&AddOffset, 4));
+    int32 Value = 0;
+    for (auto _ : State) {
+        Value = Invoker(Value);
+    }
+    Retro::Benchmarks::DoNotOptimize(Value);
+}
+
+RETRO_BENCHMARK(DelegateExecute, StaticBinding) {
+    auto Binding = Retro::Delegates::BindStatic<&AddOffset>(4);
+    int32 Value = 0;
+    for (auto _ : State) {
+        Value = Binding(Value);
+        Retro::Benchmarks::DoNotOptimize(Value);
+    }
+}
+
+RETRO_BENCHMARK(DelegateExecuteMember, Loop) {
+    auto Receiver = MakeShared<FBenchmarkReceiver>();
+    auto Delegate = FBenchmarkDelegate::CreateSP(Receiver, &FBenchmarkReceiver::Scale);
+    int32 Value = 1;
+    for (auto _ : State) {
+        Value = Delegate.Execute(Value) & 0xFFFF;
+    }
+    Retro::Benchmarks::DoNotOptimize(Value);
+}
+
+RETRO_BENCHMARK(DelegateExecuteMember, MemberBinding) {
+    auto Receiver = MakeShared<FBenchmarkReceiver>();
+    auto Binding = Retro::Delegates::BindMember<&FBenchmarkReceiver::Scale>(Receiver);
+    int32 Value = 1;
+    for (auto _ : State) {
+        Value = Binding(Value) & 0xFFFF;
+        Retro::Benchmarks::DoNotOptimize(Value);
+    }
+}
+
+RETRO_BENCHMARK(DelegateBroadcast, Loop) {
+    FBenchmarkMulticastDelegate Delegate;
+    for (int32 i = 0; i < 8; i++) {
+        Delegate.AddStatic(&Accumulate, i);
+    }
+
+    int32 Total = 0;
+    for (auto _ : State) {
+        Delegate.Broadcast(Total);
+    }
+    Retro::Benchmarks::DoNotOptimize(Total);
+}
+
+RETRO_BENCHMARK(DelegateBroadcast, Retro) {
+    FBenchmarkMulticastDelegate Delegate;
+    for (int32 i = 0; i < 8; i++) {
+        Delegate | Retro::Delegates::Add(&Accumulate, i);
+    }
+
+    Retro::Delegates::TDelegateInvoker Invoker(MoveTemp(Delegate));
+    int32 Total = 0;
+    for (auto _ : State) {
+        Invoker(Total);
+    }
+    Retro::Benchmarks::DoNotOptimize(Total);
+}
+
+RETRO_BENCHMARK(DynamicDelegateExecute, Loop) {
+    TStrongObjectPtr<UTimelineComponent> Timeline(NewObject<UTimelineComponent>(GetTransientPackage()));
+    FOnTimelineFloat Delegate;
+    Delegate.BindUFunction(Timeline.Get(), GET_FUNCTION_NAME_CHECKED(UTimelineComponent, SetPlayRate));
+    float Rate = 0.f;
+    for (auto _ : State) {
+        Delegate.Execute(Rate);
+        Rate += 1.f;
+    }
+    Retro::Benchmarks::DoNotOptimize(Timeline->GetPlayRate());
+}
+
+RETRO_BENCHMARK(DynamicDelegateExecute, Retro) {
+    TStrongObjectPtr<UTimelineComponent> Timeline(NewObject<UTimelineComponent>(GetTransientPackage()));
+    FOnTimelineFloat Delegate;
+    Delegate.BindUFunction(Timeline.Get(), GET_FUNCTION_NAME_CHECKED(UTimelineComponent, SetPlayRate));
+    Retro::Delegates::TDelegateInvoker Invoker(MoveTemp(Delegate));
+    float Rate = 0.f;
+    for (auto _ : State) {
+        Invoker(Rate);
+        Rate += 1.f;
+    }
+    Retro::Benchmarks::DoNotOptimize(Timeline->GetPlayRate());
+}
+
+RETRO_BENCHMARK(GameThreadMarshal, Loop) {
+    int32 Total = 0;
+    auto Delegate = FBenchmarkVoidDelegate::CreateLambda([&Total](int32 Value) { Total += AddOffset(Value, 4); });
+    for (auto _ : State) {
+        for (int32 i = 0; i < 64; i++) {
+            AsyncTask(ENamedThreads::GameThread, [&Delegate, i] { Delegate.ExecuteIfBound(i); });
+        }
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+    }
+    Retro::Benchmarks::DoNotOptimize(Total);
+}
+
+RETRO_BENCHMARK(GameThreadMarshal, Retro) {
+    int32 Total = 0;
+    auto Marshalled = Retro::Delegates::MarshalToGameThread(
+        FBenchmarkVoidDelegate::CreateLambda([&Total](int32 Value) { Total += AddOffset(Value, 4); }));
+    for (auto _ : State) {
+        for (int32 i = 0; i < 64; i++) {
+            Marshalled(i);
+        }
+        Retro::Delegates::FGameThreadDispatcher::Get().Flush();
+    }
+    Retro::Benchmarks::DoNotOptimize(Total);
+}
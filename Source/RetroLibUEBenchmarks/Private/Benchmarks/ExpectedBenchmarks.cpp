@@ -0,0 +1,106 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Expected/Expected.h"
+
+#include <stdexcept>
+
+namespace {
+    using Retro::Expected::TExpected;
+
+    enum class EParseError : uint8 {
+        NotANumber,
+        OutOfRange
+    };
+
+    /**
+     * Tokens for a parse pipeline where roughly one in four inputs fails, either because it is not a number or
+     * because the parsed value is out of range.
+     */
+    TArray<FString> MakeTokens() {
+        TArray<int32> Values = Retro::Benchmarks::MakeRandomIntegers();
+        TArray<FString> Result;
+        Result.Reserve(Values.Num());
+        for (int32 Value : Values) {
+            if (Value % 8 == 0) {
+                Result.Add(TEXT("invalid"));
+            } else {
+                Result.Add(FString::FromInt(Value % 8 == 1 ? -Value : Value));
+            }
+        }
+        return Result;
+    }
+
+    bool TryParse(const FString &Token, int32 &OutValue) {
+        if (!Token.IsNumeric()) {
+            return false;
+        }
+        OutValue = FCString::Atoi(*Token);
+        return OutValue >= 0;
+    }
+
+    int32 ParseOrThrow(const FString &Token) {
+        if (!Token.IsNumeric()) {
+            throw std::invalid_argument("Not a number");
+        }
+        int32 Value = FCString::Atoi(*Token);
+        if (Value < 0) {
+            throw std::out_of_range("Negative value");
+        }
+        return Value;
+    }
+
+    TExpected<int32, EParseError> Parse(const FString &Token) {
+        if (!Token.IsNumeric()) {
+            return MakeError(EParseError::NotANumber);
+        }
+        return MakeValue(FCString::Atoi(*Token));
+    }
+
+    TExpected<int32, EParseError> Validate(int32 Value) {
+        if (Value < 0) {
+            return MakeError(EParseError::OutOfRange);
+        }
+        return MakeValue(Value);
+    }
+} // namespace
+
+RETRO_BENCHMARK(ExpectedParsePipeline, Loop) {
+    TArray<FString> Tokens = MakeTokens();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const FString &Token : Tokens) {
+            int32 Value;
+            Sum += TryParse(Token, Value) ? Value * 2 : -1;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(ExpectedParsePipeline, Throw) {
+    TArray<FString> Tokens = MakeTokens();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const FString &Token : Tokens) {
+            try {
+                Sum += ParseOrThrow(Token) * 2;
+            } catch (const std::exception &) {
+                Sum -= 1;
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(ExpectedParsePipeline, Retro) {
+    TArray<FString> Tokens = MakeTokens();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const FString &Token : Tokens) {
+            Sum += Parse(Token) | Retro::Expected::AndThen(&Validate) |
+                   Retro::Expected::Transform([](int32 Value) { return Value * 2; }) | Retro::Expected::ValueOr(-1);
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
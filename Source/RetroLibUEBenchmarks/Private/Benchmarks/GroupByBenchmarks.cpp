@@ -0,0 +1,89 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Algorithm/GroupBy.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+
+namespace {
+    struct FEntityRecord {
+        int32 Team;
+        int32 Zone;
+        float Health;
+    };
+
+    /**
+     * Entities of the shape the per-frame rollups run over: a handful of teams and a few hundred zones.
+     */
+    TArray<FEntityRecord> MakeEntities() {
+        constexpr int32 NumEntities = 100000;
+        TArray<int32> Zones = Retro::Benchmarks::MakeRandomIntegers(NumEntities, 255);
+        TArray<float> Health = Retro::Benchmarks::MakeRandomFloats(NumEntities);
+        TArray<FEntityRecord> Result;
+        Result.Reserve(NumEntities);
+        for (int32 i = 0; i < NumEntities; i++) {
+            Result.Add({Zones[i] % 4, Zones[i], Health[i]});
+        }
+        return Result;
+    }
+} // namespace
+
+RETRO_BENCHMARK(GroupEntitiesByZone, Loop) {
+    const TArray<FEntityRecord> Entities = MakeEntities();
+    for (auto _ : State) {
+        TMap<int32, TArray<FEntityRecord>> Groups;
+        for (const FEntityRecord &Entity : Entities) {
+            Groups.FindOrAdd(Entity.Zone).Add(Entity);
+        }
+        Retro::Benchmarks::DoNotOptimize(Groups);
+    }
+}
+
+RETRO_BENCHMARK(GroupEntitiesByZone, Retro) {
+    const TArray<FEntityRecord> Entities = MakeEntities();
+    for (auto _ : State) {
+        auto Groups = Entities | Retro::Ranges::GroupBy(&FEntityRecord::Zone);
+        Retro::Benchmarks::DoNotOptimize(Groups);
+    }
+}
+
+RETRO_BENCHMARK(GroupEntitiesByZone, RetroParallel) {
+    const TArray<FEntityRecord> Entities = MakeEntities();
+    for (auto _ : State) {
+        auto Groups = Entities | Retro::Ranges::GroupBy(&FEntityRecord::Zone, Retro::Ranges::EGroupingMode::Parallel);
+        Retro::Benchmarks::DoNotOptimize(Groups);
+    }
+}
+
+RETRO_BENCHMARK(SumHealthByZone, Loop) {
+    const TArray<FEntityRecord> Entities = MakeEntities();
+    for (auto _ : State) {
+        TMap<int32, float> Totals;
+        for (const FEntityRecord &Entity : Entities) {
+            Totals.FindOrAdd(Entity.Zone) += Entity.Health;
+        }
+        Retro::Benchmarks::DoNotOptimize(Totals);
+    }
+}
+
+RETRO_BENCHMARK(SumHealthByZone, Retro) {
+    const TArray<FEntityRecord> Entities = MakeEntities();
+    for (auto _ : State) {
+        auto Totals = Entities | Retro::Ranges::AggregateBy(&FEntityRecord::Zone, 0.f,
+                                                            [](float &Total, const FEntityRecord &Entity) {
+                                                                Total += Entity.Health;
+                                                            });
+        Retro::Benchmarks::DoNotOptimize(Totals);
+    }
+}
+
+RETRO_BENCHMARK(SumHealthByZone, RetroParallel) {
+    const TArray<FEntityRecord> Entities = MakeEntities();
+    for (auto _ : State) {
+        auto Totals = Entities | Retro::Ranges::AggregateBy(
+                                     &FEntityRecord::Zone, 0.f,
+                                     [](float &Total, const FEntityRecord &Entity) { Total += Entity.Health; },
+                                     Retro::Ranges::EGroupingMode::Parallel);
+        Retro::Benchmarks::DoNotOptimize(Totals);
+    }
+}
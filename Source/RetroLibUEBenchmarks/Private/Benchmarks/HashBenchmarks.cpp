@@ -0,0 +1,40 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Algorithm/HashRange.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+
+namespace {
+    /**
+     * Enough data to cross several hash chunks, which is the size of payload the content keys are computed for.
+     */
+    constexpr int32 NumHashedElements = 4 * 1024 * 1024;
+} // namespace
+
+RETRO_BENCHMARK(HashPayload, Loop) {
+    const TArray<int32> Values = Retro::Benchmarks::MakeRandomIntegers(NumHashedElements, MAX_int32);
+    for (auto _ : State) {
+        uint32 Hash = 0;
+        for (int32 Value : Values) {
+            Hash = HashCombine(Hash, GetTypeHash(Value));
+        }
+        Retro::Benchmarks::DoNotOptimize(Hash);
+    }
+}
+
+RETRO_BENCHMARK(HashPayload, Retro) {
+    const TArray<int32> Values = Retro::Benchmarks::MakeRandomIntegers(NumHashedElements, MAX_int32);
+    for (auto _ : State) {
+        uint64 Hash = Values | Retro::Ranges::HashRange();
+        Retro::Benchmarks::DoNotOptimize(Hash);
+    }
+}
+
+RETRO_BENCHMARK(HashPayload, Retro128) {
+    const TArray<int32> Values = Retro::Benchmarks::MakeRandomIntegers(NumHashedElements, MAX_int32);
+    for (auto _ : State) {
+        FXxHash128 Hash = Values | Retro::Ranges::HashRange(Retro::Ranges::FXxHash128Hasher());
+        Retro::Benchmarks::DoNotOptimize(Hash);
+    }
+}
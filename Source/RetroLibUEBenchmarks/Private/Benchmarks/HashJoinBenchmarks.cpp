@@ -0,0 +1,111 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/HashJoin.h"
+
+namespace {
+    struct FActorRecord {
+        int32 Id;
+        float Health;
+    };
+
+    struct FComponentRecord {
+        int32 Owner;
+        float Weight;
+    };
+
+    TArray<FActorRecord> MakeActors() {
+        TArray<float> Health = Retro::Benchmarks::MakeRandomFloats();
+        TArray<FActorRecord> Result;
+        Result.Reserve(Health.Num());
+        for (int32 i = 0; i < Health.Num(); i++) {
+            Result.Add({i, Health[i]});
+        }
+        return Result;
+    }
+
+    /**
+     * A couple of components per actor, owned by random actors, with some owned by actors that no longer exist.
+     */
+    TArray<FComponentRecord> MakeComponents() {
+        TArray<int32> Owners =
+            Retro::Benchmarks::MakeRandomIntegers(Retro::Benchmarks::NumBenchmarkElements * 2,
+                                                  Retro::Benchmarks::NumBenchmarkElements + 256);
+        TArray<float> Weights = Retro::Benchmarks::MakeRandomFloats(Owners.Num());
+        TArray<FComponentRecord> Result;
+        Result.Reserve(Owners.Num());
+        for (int32 i = 0; i < Owners.Num(); i++) {
+            Result.Add({Owners[i], Weights[i]});
+        }
+        return Result;
+    }
+} // namespace
+
+RETRO_BENCHMARK(JoinActorsWithComponents, Loop) {
+    const TArray<FActorRecord> Actors = MakeActors();
+    const TArray<FComponentRecord> Components = MakeComponents();
+    for (auto _ : State) {
+        float Total = 0.f;
+        for (const FComponentRecord &Component : Components) {
+            for (const FActorRecord &Actor : Actors) {
+                if (Actor.Id == Component.Owner) {
+                    Total += Actor.Health * Component.Weight;
+                }
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Total);
+    }
+}
+
+RETRO_BENCHMARK(JoinActorsWithComponents, MapFind) {
+    const TArray<FActorRecord> Actors = MakeActors();
+    const TArray<FComponentRecord> Components = MakeComponents();
+    for (auto _ : State) {
+        TMap<int32, const FActorRecord *> ActorsById;
+        ActorsById.Reserve(Actors.Num());
+        for (const FActorRecord &Actor : Actors) {
+            ActorsById.Add(Actor.Id, &Actor);
+        }
+
+        float Total = 0.f;
+        for (const FComponentRecord &Component : Components) {
+            if (const FActorRecord *const *Actor = ActorsById.Find(Component.Owner)) {
+                Total += (*Actor)->Health * Component.Weight;
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Total);
+    }
+}
+
+RETRO_BENCHMARK(JoinActorsWithComponents, Retro) {
+    const TArray<FActorRecord> Actors = MakeActors();
+    const TArray<FComponentRecord> Components = MakeComponents();
+    for (auto _ : State) {
+        float Total = 0.f;
+        for (auto [Component, Actor] :
+             Components | Retro::Ranges::Views::HashJoin(Actors, &FComponentRecord::Owner, &FActorRecord::Id)) {
+            Total += Actor.Health * Component.Weight;
+        }
+        Retro::Benchmarks::DoNotOptimize(Total);
+    }
+}
+
+RETRO_BENCHMARK(JoinActorsWithComponents, RetroLookupJoin) {
+    const TArray<FActorRecord> Actors = MakeActors();
+    const TArray<FComponentRecord> Components = MakeComponents();
+    TMap<int32, float> HealthById;
+    for (const FActorRecord &Actor : Actors) {
+        HealthById.Add(Actor.Id, Actor.Health);
+    }
+
+    for (auto _ : State) {
+        float Total = 0.f;
+        for (auto [Component, Health] :
+             Components | Retro::Ranges::Views::LookupJoin(HealthById, &FComponentRecord::Owner)) {
+            Total += Health * Component.Weight;
+        }
+        Retro::Benchmarks::DoNotOptimize(Total);
+    }
+}
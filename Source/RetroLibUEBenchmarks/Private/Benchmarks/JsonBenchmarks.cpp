@@ -0,0 +1,71 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Dom/JsonObject.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Json/JsonEncoding.h"
+#include "RetroLib/Ranges/Algorithm/WriteJson.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace {
+    struct FTelemetrySample {
+        double Timestamp;
+        int32 FrameIndex;
+        float FrameTime;
+        FString Map;
+    };
+
+    /**
+     * Telemetry samples of the shape that the session dumps are made of: a handful of numeric fields and a string.
+     */
+    TArray<FTelemetrySample> MakeSamples() {
+        TArray<float> FrameTimes = Retro::Benchmarks::MakeRandomFloats();
+        TArray<FTelemetrySample> Result;
+        Result.Reserve(FrameTimes.Num());
+        for (int32 i = 0; i < FrameTimes.Num(); i++) {
+            Result.Add({i / 60.0, i, 16.6f + FrameTimes[i], TEXT("/Game/Maps/Arena")});
+        }
+        return Result;
+    }
+} // namespace
+
+template <>
+struct Retro::Json::TJsonFields<FTelemetrySample> {
+    static constexpr auto Fields =
+        std::make_tuple(Field(TEXT("timestamp"), &FTelemetrySample::Timestamp),
+                        Field(TEXT("frame"), &FTelemetrySample::FrameIndex),
+                        Field(TEXT("frameTime"), &FTelemetrySample::FrameTime),
+                        Field(TEXT("map"), &FTelemetrySample::Map));
+};
+
+RETRO_BENCHMARK(ExportTelemetryJson, Loop) {
+    const TArray<FTelemetrySample> Samples = MakeSamples();
+    for (auto _ : State) {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Samples.Num());
+        for (const FTelemetrySample &Sample : Samples) {
+            auto Object = MakeShared<FJsonObject>();
+            Object->SetNumberField(TEXT("timestamp"), Sample.Timestamp);
+            Object->SetNumberField(TEXT("frame"), Sample.FrameIndex);
+            Object->SetNumberField(TEXT("frameTime"), Sample.FrameTime);
+            Object->SetStringField(TEXT("map"), Sample.Map);
+            Values.Add(MakeShared<FJsonValueObject>(MoveTemp(Object)));
+        }
+
+        FString Output;
+        auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+        FJsonSerializer::Serialize(Values, Writer);
+        Retro::Benchmarks::DoNotOptimize(Output);
+    }
+}
+
+RETRO_BENCHMARK(ExportTelemetryJson, Retro) {
+    const TArray<FTelemetrySample> Samples = MakeSamples();
+    TArray<uint8> Output;
+    for (auto _ : State) {
+        Output.Reset();
+        Samples | Retro::Ranges::WriteJsonTo(Output);
+        Retro::Benchmarks::DoNotOptimize(Output);
+    }
+}
@@ -0,0 +1,64 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GameFramework/Actor.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Views/ClassView.h"
+#include "RetroLib/Ranges/Views/Filter.h"
+#include "RetroLib/Ranges/Views/ObjectView.h"
+#include "UObject/UObjectIterator.h"
+
+namespace {
+    bool IsActorClass(const UClass *Class) {
+        return Class->IsChildOf<AActor>();
+    }
+} // namespace
+
+RETRO_BENCHMARK(ObjectIteration, Loop) {
+    for (auto _ : State) {
+        int32 Count = 0;
+        for (TObjectIterator<UClass> It; It; ++It) {
+            if (IsActorClass(*It)) {
+                UClass *Class = *It;
+                Retro::Benchmarks::DoNotOptimize(Class);
+                Count++;
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Count);
+    }
+}
+
+RETRO_BENCHMARK(ObjectIteration, Retro) {
+    for (auto _ : State) {
+        int32 Count = 0;
+        for (UClass *Class : Retro::Ranges::TObjectView<UClass>() | Retro::Ranges::Views::Filter(&IsActorClass)) {
+            Retro::Benchmarks::DoNotOptimize(Class);
+            Count++;
+        }
+        Retro::Benchmarks::DoNotOptimize(Count);
+    }
+}
+
+RETRO_BENCHMARK(ClassIteration, Loop) {
+    for (auto _ : State) {
+        int32 Count = 0;
+        for (TObjectIterator<UClass> It; It; ++It) {
+            if (It->IsChildOf<AActor>()) {
+                TSubclassOf<AActor> Class = *It;
+                Retro::Benchmarks::DoNotOptimize(Class);
+                Count++;
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Count);
+    }
+}
+
+RETRO_BENCHMARK(ClassIteration, Retro) {
+    for (auto _ : State) {
+        int32 Count = 0;
+        for (TSubclassOf<AActor> Class : Retro::Ranges::TClassView<AActor>()) {
+            Retro::Benchmarks::DoNotOptimize(Class);
+            Count++;
+        }
+        Retro::Benchmarks::DoNotOptimize(Count);
+    }
+}
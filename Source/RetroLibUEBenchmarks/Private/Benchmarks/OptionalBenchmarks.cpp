@@ -0,0 +1,92 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Optionals/Compatiblity/UnrealOptional.h"
+#include "RetroLib/Optionals/OptionalColumn.h"
+#include "RetroLib/Optionals/OrElseValue.h"
+#include "RetroLib/Optionals/Transform.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+
+#include <ranges>
+
+namespace {
+    TArray<TOptional<int32>> MakeSparseOptionals() {
+        TArray<int32> Values = Retro::Benchmarks::MakeRandomIntegers();
+        TArray<TOptional<int32>> Result;
+        Result.Reserve(Values.Num());
+        for (int32 Value : Values) {
+            Result.Add(Value % 3 == 0 ? TOptional<int32>() : TOptional<int32>(Value));
+        }
+        return Result;
+    }
+
+    int32 Triple(int32 Value) {
+        return Value * 3;
+    }
+} // namespace
+
+RETRO_BENCHMARK(OptionalTransformOrElse, Loop) {
+    TArray<TOptional<int32>> Data = MakeSparseOptionals();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const TOptional<int32> &Value : Data) {
+            Sum += Value.IsSet() ? Triple(Value.GetValue()) : -1;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(OptionalTransformOrElse, Retro) {
+    TArray<TOptional<int32>> Data = MakeSparseOptionals();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const TOptional<int32> &Value : Data) {
+            Sum += Value | Retro::Optionals::Transform(&Triple) | Retro::Optionals::OrElseValue(-1);
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(OptionalJoinSum, Loop) {
+    TArray<TOptional<int32>> Data = MakeSparseOptionals();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const TOptional<int32> &Value : Data) {
+            if (Value.IsSet()) {
+                Sum += Value.GetValue();
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(OptionalJoinSum, Retro) {
+    TArray<TOptional<int32>> Data = MakeSparseOptionals();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (int32 Value : Data | std::ranges::views::join) {
+            Sum += Value;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(OptionalJoinSum, OptionalColumn) {
+    Retro::Optionals::TOptionalColumn<int32> Data;
+    for (const TOptional<int32> &Value : MakeSparseOptionals()) {
+        if (Value.IsSet()) {
+            Data.Add(Value.GetValue());
+        } else {
+            Data.AddUnset();
+        }
+    }
+
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (int32 Value : Data.GetSetValues()) {
+            Sum += Value;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
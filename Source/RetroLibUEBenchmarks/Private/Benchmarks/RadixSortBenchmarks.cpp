@@ -0,0 +1,67 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Algorithm/RadixSort.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+
+namespace {
+    struct FSortRecord {
+        float Depth;
+        int32 Index;
+        uint64 Payload;
+    };
+
+    /**
+     * Records for the sort benchmarks. These use a larger count than the other benchmarks, as radix sort is aimed at
+     * the large per-frame sort passes where comparison sorts fall behind.
+     */
+    TArray<FSortRecord> MakeRecords() {
+        constexpr int32 NumRecords = Retro::Benchmarks::NumBenchmarkElements * 64;
+        TArray<float> Depths = Retro::Benchmarks::MakeRandomFloats(NumRecords);
+        TArray<FSortRecord> Result;
+        Result.Reserve(NumRecords);
+        for (int32 i = 0; i < NumRecords; i++) {
+            Result.Add({Depths[i] * 10000.f, i, static_cast<uint64>(i)});
+        }
+        return Result;
+    }
+} // namespace
+
+RETRO_BENCHMARK(SortRecordsByDepth, Loop) {
+    const TArray<FSortRecord> Records = MakeRecords();
+    for (auto _ : State) {
+        TArray<FSortRecord> Data = Records;
+        Algo::SortBy(Data, &FSortRecord::Depth);
+        Retro::Benchmarks::DoNotOptimize(Data);
+    }
+}
+
+RETRO_BENCHMARK(SortRecordsByDepth, StableSort) {
+    const TArray<FSortRecord> Records = MakeRecords();
+    for (auto _ : State) {
+        TArray<FSortRecord> Data = Records;
+        Algo::StableSortBy(Data, &FSortRecord::Depth);
+        Retro::Benchmarks::DoNotOptimize(Data);
+    }
+}
+
+RETRO_BENCHMARK(SortRecordsByDepth, Retro) {
+    const TArray<FSortRecord> Records = MakeRecords();
+    for (auto _ : State) {
+        TArray<FSortRecord> Data = Records;
+        Retro::Ranges::RadixSort(Data, &FSortRecord::Depth);
+        Retro::Benchmarks::DoNotOptimize(Data);
+    }
+}
+
+RETRO_BENCHMARK(SortRecordsByDepth, Retro11Bit) {
+    const TArray<FSortRecord> Records = MakeRecords();
+    for (auto _ : State) {
+        TArray<FSortRecord> Data = Records;
+        Retro::Ranges::RadixSort<FDefaultAllocator, 11>(Data, &FSortRecord::Depth);
+        Retro::Benchmarks::DoNotOptimize(Data);
+    }
+}
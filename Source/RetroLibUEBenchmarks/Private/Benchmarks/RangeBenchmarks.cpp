@@ -0,0 +1,118 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Memory/BumpArena.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Algorithm/ToArray.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Compatibility/UnrealContainers.h"
+#include "RetroLib/Ranges/Views/Filter.h"
+#include "RetroLib/Ranges/Views/Transform.h"
+
+namespace {
+    bool IsEven(int32 Value) {
+        return Value % 2 == 0;
+    }
+
+    int32 Square(int32 Value) {
+        return Value * Value;
+    }
+} // namespace
+
+RETRO_BENCHMARK(ArrayFilterTransformSum, Loop) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (int32 Value : Data) {
+            if (IsEven(Value)) {
+                Sum += Square(Value);
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(ArrayFilterTransformSum, Retro) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (int32 Value :
+             Data | Retro::Ranges::Views::Filter(&IsEven) | Retro::Ranges::Views::Transform(&Square)) {
+            Sum += Value;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(ArrayFilterTransformToArray, Loop) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        TArray<int32> Result;
+        for (int32 Value : Data) {
+            if (IsEven(Value)) {
+                Result.Add(Square(Value));
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(ArrayFilterTransformToArray, Retro) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        auto Result = Data | Retro::Ranges::Views::Filter(&IsEven) | Retro::Ranges::Views::Transform(&Square) |
+                      Retro::Ranges::To<TArray>();
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(ArrayFilterTransformToArray, RetroBumpArena) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        Retro::FBumpArenaMark Mark;
+        auto Result = Data | Retro::Ranges::Views::Filter(&IsEven) | Retro::Ranges::Views::Transform(&Square) |
+                      Retro::Ranges::ToArray<Retro::TBumpArenaAllocator<>>();
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(ArrayTransformToArray, Loop) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        TArray<int32> Result;
+        Result.Reserve(Data.Num());
+        for (int32 Value : Data) {
+            Result.Add(Square(Value));
+        }
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(ArrayTransformToArray, Retro) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        auto Result = Data | Retro::Ranges::Views::Transform(&Square) | Retro::Ranges::To<TArray>();
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(ArrayToSet, Loop) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        TSet<int32> Result;
+        Result.Reserve(Data.Num());
+        for (int32 Value : Data) {
+            Result.Add(Value);
+        }
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(ArrayToSet, Retro) {
+    TArray<int32> Data = Retro::Benchmarks::MakeRandomIntegers();
+    for (auto _ : State) {
+        auto Result = Data | Retro::Ranges::To<TSet>();
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
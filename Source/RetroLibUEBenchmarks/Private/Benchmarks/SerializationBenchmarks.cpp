@@ -0,0 +1,75 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Algorithm/SerializeTo.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/Deserialize.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace {
+    constexpr auto IsPositive = [](float Value) { return Value > 0.f; };
+
+    TArray<uint8> MakeSerializedFloats() {
+        TArray<float> Values = Retro::Benchmarks::MakeRandomFloats();
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+        Writer << Values;
+        return Bytes;
+    }
+} // namespace
+
+RETRO_BENCHMARK(SerializeFilteredFloats, Loop) {
+    const TArray<float> Values = Retro::Benchmarks::MakeRandomFloats();
+    TArray<uint8> Bytes;
+    for (auto _ : State) {
+        Bytes.Reset();
+        FMemoryWriter Writer(Bytes);
+        TArray<float> Filtered;
+        for (float Value : Values) {
+            if (IsPositive(Value)) {
+                Filtered.Add(Value);
+            }
+        }
+        Writer << Filtered;
+        Retro::Benchmarks::DoNotOptimize(Bytes);
+    }
+}
+
+RETRO_BENCHMARK(SerializeFilteredFloats, Retro) {
+    const TArray<float> Values = Retro::Benchmarks::MakeRandomFloats();
+    TArray<uint8> Bytes;
+    for (auto _ : State) {
+        Bytes.Reset();
+        FMemoryWriter Writer(Bytes);
+        Values | std::views::filter(IsPositive) | Retro::Ranges::SerializeTo(Writer);
+        Retro::Benchmarks::DoNotOptimize(Bytes);
+    }
+}
+
+RETRO_BENCHMARK(DeserializeAndSumFloats, Loop) {
+    const TArray<uint8> Bytes = MakeSerializedFloats();
+    for (auto _ : State) {
+        FMemoryReader Reader(Bytes);
+        TArray<float> Values;
+        Reader << Values;
+        float Sum = 0.f;
+        for (float Value : Values) {
+            Sum += Value;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(DeserializeAndSumFloats, Retro) {
+    const TArray<uint8> Bytes = MakeSerializedFloats();
+    for (auto _ : State) {
+        FMemoryReader Reader(Bytes);
+        float Sum = 0.f;
+        for (float Value : Retro::Ranges::Views::Deserialize<float>(Reader)) {
+            Sum += Value;
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
@@ -0,0 +1,86 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Containers/SortedMap.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Containers/FlatSortedMap.h"
+#include "RetroLib/Ranges/Algorithm/ToSorted.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+
+namespace {
+    TArray<TPair<int32, int32>> MakeRandomPairs() {
+        TArray<int32> Keys = Retro::Benchmarks::MakeRandomIntegers(Retro::Benchmarks::NumBenchmarkElements, MAX_int32);
+        TArray<TPair<int32, int32>> Result;
+        Result.Reserve(Keys.Num());
+        for (int32 i = 0; i < Keys.Num(); i++) {
+            Result.Emplace(Keys[i], i);
+        }
+        return Result;
+    }
+} // namespace
+
+RETRO_BENCHMARK(SortedMapBuild, Loop) {
+    TArray<TPair<int32, int32>> Pairs = MakeRandomPairs();
+    for (auto _ : State) {
+        TSortedMap<int32, int32> Map;
+        for (const TPair<int32, int32> &Pair : Pairs) {
+            Map.Add(Pair.Key, Pair.Value);
+        }
+        Retro::Benchmarks::DoNotOptimize(Map);
+    }
+}
+
+RETRO_BENCHMARK(SortedMapBuild, Retro) {
+    TArray<TPair<int32, int32>> Pairs = MakeRandomPairs();
+    for (auto _ : State) {
+        auto Map = Pairs | Retro::Ranges::ToSortedMap();
+        Retro::Benchmarks::DoNotOptimize(Map);
+    }
+}
+
+RETRO_BENCHMARK(SortedMapBuild, FlatSortedMap) {
+    TArray<TPair<int32, int32>> Pairs = MakeRandomPairs();
+    for (auto _ : State) {
+        auto Map = Pairs | Retro::Ranges::ToFlatSortedMap();
+        Retro::Benchmarks::DoNotOptimize(Map);
+    }
+}
+
+RETRO_BENCHMARK(SortedMapLookup, Loop) {
+    TArray<TPair<int32, int32>> Pairs = MakeRandomPairs();
+    auto Map = Pairs | Retro::Ranges::ToSortedMap();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const TPair<int32, int32> &Pair : Pairs) {
+            Sum += *Map.Find(Pair.Key);
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(SortedMapLookup, TMap) {
+    TArray<TPair<int32, int32>> Pairs = MakeRandomPairs();
+    TMap<int32, int32> Map;
+    for (const TPair<int32, int32> &Pair : Pairs) {
+        Map.Add(Pair.Key, Pair.Value);
+    }
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const TPair<int32, int32> &Pair : Pairs) {
+            Sum += Map.FindChecked(Pair.Key);
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
+
+RETRO_BENCHMARK(SortedMapLookup, FlatSortedMap) {
+    TArray<TPair<int32, int32>> Pairs = MakeRandomPairs();
+    auto Map = Pairs | Retro::Ranges::ToFlatSortedMap();
+    for (auto _ : State) {
+        int64 Sum = 0;
+        for (const TPair<int32, int32> &Pair : Pairs) {
+            Sum += Map.FindChecked(Pair.Key);
+        }
+        Retro::Benchmarks::DoNotOptimize(Sum);
+    }
+}
@@ -0,0 +1,103 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Compatibility/Array.h"
+#include "RetroLib/Ranges/Views/SortedSetOperations.h"
+
+namespace {
+    TArray<int32> MakeSortedIntegers(int32 Num, int32 Max) {
+        TArray<int32> Result = Retro::Benchmarks::MakeRandomIntegers(Num, Max);
+        Result.Sort();
+        return Result;
+    }
+} // namespace
+
+RETRO_BENCHMARK(DiffSortedIds, Loop) {
+    const TArray<int32> Previous = MakeSortedIntegers(Retro::Benchmarks::NumBenchmarkElements, 8192);
+    const TArray<int32> Current = MakeSortedIntegers(Retro::Benchmarks::NumBenchmarkElements, 8192);
+    for (auto _ : State) {
+        TSet<int32> CurrentSet(Current);
+        int32 Removed = 0;
+        for (int32 Id : Previous) {
+            if (!CurrentSet.Contains(Id)) {
+                Removed++;
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Removed);
+    }
+}
+
+RETRO_BENCHMARK(DiffSortedIds, Retro) {
+    const TArray<int32> Previous = MakeSortedIntegers(Retro::Benchmarks::NumBenchmarkElements, 8192);
+    const TArray<int32> Current = MakeSortedIntegers(Retro::Benchmarks::NumBenchmarkElements, 8192);
+    for (auto _ : State) {
+        int32 Removed = 0;
+        for (int32 Id : Previous | Retro::Ranges::Views::SetDifference(Current)) {
+            Removed++;
+            Retro::Benchmarks::DoNotOptimize(Id);
+        }
+        Retro::Benchmarks::DoNotOptimize(Removed);
+    }
+}
+
+RETRO_BENCHMARK(IntersectSkewedIds, Loop) {
+    const TArray<int32> Small = MakeSortedIntegers(64, Retro::Benchmarks::NumBenchmarkElements * 64);
+    const TArray<int32> Large =
+        MakeSortedIntegers(Retro::Benchmarks::NumBenchmarkElements * 16, Retro::Benchmarks::NumBenchmarkElements * 64);
+    for (auto _ : State) {
+        TArray<int32> Result;
+        int32 i = 0;
+        int32 j = 0;
+        while (i < Small.Num() && j < Large.Num()) {
+            if (Small[i] < Large[j]) {
+                i++;
+            } else if (Large[j] < Small[i]) {
+                j++;
+            } else {
+                Result.Add(Small[i]);
+                i++;
+                j++;
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(IntersectSkewedIds, Retro) {
+    const TArray<int32> Small = MakeSortedIntegers(64, Retro::Benchmarks::NumBenchmarkElements * 64);
+    const TArray<int32> Large =
+        MakeSortedIntegers(Retro::Benchmarks::NumBenchmarkElements * 16, Retro::Benchmarks::NumBenchmarkElements * 64);
+    for (auto _ : State) {
+        auto Result = Small | Retro::Ranges::Views::SetIntersection(Large) | Retro::Ranges::To<TArray>();
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(MergeSortedRuns, Loop) {
+    TArray<TArray<int32>> Runs;
+    for (int32 i = 0; i < 16; i++) {
+        Runs.Add(
+            MakeSortedIntegers(Retro::Benchmarks::NumBenchmarkElements / 16, Retro::Benchmarks::NumBenchmarkElements));
+    }
+    for (auto _ : State) {
+        TArray<int32> Result;
+        for (const TArray<int32> &Run : Runs) {
+            Result.Append(Run);
+        }
+        Result.Sort();
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
+
+RETRO_BENCHMARK(MergeSortedRuns, Retro) {
+    TArray<TArray<int32>> Runs;
+    for (int32 i = 0; i < 16; i++) {
+        Runs.Add(
+            MakeSortedIntegers(Retro::Benchmarks::NumBenchmarkElements / 16, Retro::Benchmarks::NumBenchmarkElements));
+    }
+    for (auto _ : State) {
+        auto Result = Runs | Retro::Ranges::Views::MergeSortedRanges() | Retro::Ranges::To<TArray>();
+        Retro::Benchmarks::DoNotOptimize(Result);
+    }
+}
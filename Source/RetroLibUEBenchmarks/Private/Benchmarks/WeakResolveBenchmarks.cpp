@@ -0,0 +1,84 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Benchmarks/BenchmarkData.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Ranges/Algorithm/ResolveAll.h"
+#include "RetroLib/Ranges/Views/ResolveWeak.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace {
+    /**
+     * A set of live objects along with weak handles to them, where one handle in eight points at an object that has
+     * been marked as garbage.
+     */
+    struct FWeakHandleData {
+        TArray<TStrongObjectPtr<UObject>> Objects;
+        TArray<TWeakObjectPtr<UObject>> Handles;
+
+        FWeakHandleData() {
+            Objects.Reserve(Retro::Benchmarks::NumBenchmarkElements);
+            Handles.Reserve(Retro::Benchmarks::NumBenchmarkElements);
+            for (int32 i = 0; i < Retro::Benchmarks::NumBenchmarkElements; i++) {
+                auto &Object = Objects.Emplace_GetRef(NewObject<UObject>(GetTransientPackage()));
+                Handles.Emplace(Object.Get());
+                if (i % 8 == 0) {
+                    Object->MarkAsGarbage();
+                }
+            }
+        }
+
+        ~FWeakHandleData() {
+            for (auto &Object : Objects) {
+                Object->ClearGarbage();
+            }
+        }
+    };
+} // namespace
+
+RETRO_BENCHMARK(WeakResolve, Loop) {
+    FWeakHandleData Data;
+    for (auto _ : State) {
+        int32 Count = 0;
+        for (const auto &Handle : Data.Handles) {
+            if (UObject *Object = Handle.Get(); Object != nullptr) {
+                Retro::Benchmarks::DoNotOptimize(Object);
+                Count++;
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Count);
+    }
+}
+
+RETRO_BENCHMARK(WeakResolve, Retro) {
+    FWeakHandleData Data;
+    for (auto _ : State) {
+        int32 Count = 0;
+        for (UObject *Object : Data.Handles | Retro::Ranges::Views::ResolveWeak()) {
+            Retro::Benchmarks::DoNotOptimize(Object);
+            Count++;
+        }
+        Retro::Benchmarks::DoNotOptimize(Count);
+    }
+}
+
+RETRO_BENCHMARK(WeakResolveAll, Loop) {
+    FWeakHandleData Data;
+    for (auto _ : State) {
+        TArray<UObject *> Result;
+        for (const auto &Handle : Data.Handles) {
+            if (UObject *Object = Handle.Get(); Object != nullptr) {
+                Result.Add(Object);
+            }
+        }
+        Retro::Benchmarks::DoNotOptimize(Result.GetData());
+    }
+}
+
+RETRO_BENCHMARK(WeakResolveAll, Retro) {
+    FWeakHandleData Data;
+    for (auto _ : State) {
+        auto Result = Data.Handles | Retro::Ranges::ResolveAll();
+        Retro::Benchmarks::DoNotOptimize(Result.GetData());
+    }
+}
@@ -0,0 +1,37 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Benchmarks/Benchmark.h"
+
+namespace Retro::Benchmarks {
+    void FBenchmarkState::StartTiming() {
+        Counter.Emplace();
+        StartCycles = FPlatformTime::Cycles64();
+    }
+
+    void FBenchmarkState::StopTiming() {
+        if (bComplete) {
+            return;
+        }
+
+        EndCycles = FPlatformTime::Cycles64();
+        NumAllocations = Counter->GetNumAllocations();
+        NumBytes = Counter->GetNumBytes();
+        Counter.Reset();
+        bComplete = true;
+    }
+
+    TArray<FBenchmarkDefinition> &GetRegisteredBenchmarks() {
+        static TArray<FBenchmarkDefinition> Benchmarks;
+        return Benchmarks;
+    }
+
+    FBenchmarkRegistration::FBenchmarkRegistration(const TCHAR *Group, const TCHAR *Variant,
+                                                   FBenchmarkFunction Function) {
+        GetRegisteredBenchmarks().Add({Group, Variant, Function});
+    }
+
+    namespace Private {
+        void UseCharPointer(const volatile char *) {
+        }
+    } // namespace Private
+} // namespace Retro::Benchmarks
@@ -0,0 +1,197 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RetroLib/Benchmarks/BenchmarkRunner.h"
+
+#include "RetroLib/Benchmarks/Benchmark.h"
+
+#include <Containers/Map.h>
+#include <HAL/PlatformProperties.h>
+#include <Misc/DateTime.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Serialization/JsonWriter.h>
+
+DEFINE_LOG_CATEGORY_STATIC(LogRetroBenchmarks, Log, All);
+
+namespace Retro::Benchmarks {
+    namespace {
+        constexpr int64 MaxIterationsPerSample = 1ll << 30;
+
+        void RunSample(const FBenchmarkDefinition &Benchmark, FBenchmarkState &State) {
+            Benchmark.Function(State);
+            checkf(State.IsComplete(), TEXT("Benchmark %s did not iterate over its state"), *Benchmark.GetName());
+        }
+
+        int64 CalibrateIterations(const FBenchmarkDefinition &Benchmark, const FBenchmarkSettings &Settings) {
+            int64 NumIterations = 1;
+            while (NumIterations < MaxIterationsPerSample) {
+                FBenchmarkState State(NumIterations);
+                RunSample(Benchmark, State);
+                double Elapsed = State.GetElapsedSeconds();
+                if (Elapsed >= Settings.MinSampleSeconds) {
+                    break;
+                }
+
+                // Aim slightly past the target so that we rarely need another round, but never grow by more than 10x
+                // at once in case the first few iterations were unrepresentative
+                double Scale = Elapsed > 0 ? Settings.MinSampleSeconds * 1.4 / Elapsed : 10.0;
+                NumIterations = FMath::Min(
+                    MaxIterationsPerSample,
+                    FMath::Max(NumIterations + 1, static_cast<int64>(NumIterations * FMath::Min(Scale, 10.0))));
+            }
+
+            return NumIterations;
+        }
+
+        double Percentile(const TArray<double> &Sorted, double Fraction) {
+            int32 Rank = FMath::CeilToInt32(Fraction * Sorted.Num());
+            return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+        }
+
+        FBenchmarkResult RunBenchmark(const FBenchmarkDefinition &Benchmark, const FBenchmarkSettings &Settings) {
+            int64 NumIterations = CalibrateIterations(Benchmark, Settings);
+            for (int32 i = 0; i < Settings.NumWarmupSamples; i++) {
+                FBenchmarkState State(NumIterations);
+                RunSample(Benchmark, State);
+            }
+
+            TArray<double> Samples;
+            Samples.Reserve(Settings.NumSamples);
+            int64 NumAllocations = 0;
+            int64 NumBytes = 0;
+            for (int32 i = 0; i < Settings.NumSamples; i++) {
+                FBenchmarkState State(NumIterations);
+                RunSample(Benchmark, State);
+                Samples.Add(State.GetElapsedSeconds() * 1e9 / static_cast<double>(NumIterations));
+                NumAllocations += State.GetNumAllocations();
+                NumBytes += State.GetNumBytes();
+            }
+            Samples.Sort();
+
+            FBenchmarkResult Result;
+            Result.Group = Benchmark.Group;
+            Result.Variant = Benchmark.Variant;
+            Result.IterationsPerSample = NumIterations;
+            Result.NumSamples = Samples.Num();
+            if (Samples.IsEmpty()) {
+                return Result;
+            }
+
+            double TotalIterations = static_cast<double>(NumIterations) * Samples.Num();
+            double Total = 0;
+            for (double Sample : Samples) {
+                Total += Sample;
+            }
+
+            Result.MinNanoseconds = Samples[0];
+            Result.MeanNanoseconds = Total / Samples.Num();
+            Result.MedianNanoseconds = Percentile(Samples, 0.5);
+            Result.P95Nanoseconds = Percentile(Samples, 0.95);
+            Result.P99Nanoseconds = Percentile(Samples, 0.99);
+            Result.AllocationsPerIteration = static_cast<double>(NumAllocations) / TotalIterations;
+            Result.BytesPerIteration = static_cast<double>(NumBytes) / TotalIterations;
+            return Result;
+        }
+
+        void ComputeBaselines(TArray<FBenchmarkResult> &Results) {
+            TMap<FString, double> Baselines;
+            for (const FBenchmarkResult &Result : Results) {
+                if (Result.Variant == BaselineVariant) {
+                    Baselines.Add(Result.Group, Result.MedianNanoseconds);
+                }
+            }
+
+            for (FBenchmarkResult &Result : Results) {
+                if (const double *Baseline = Baselines.Find(Result.Group); Baseline != nullptr && *Baseline > 0) {
+                    Result.RelativeToBaseline = Result.MedianNanoseconds / *Baseline;
+                }
+            }
+        }
+
+        FString ToJson(TConstArrayView<FBenchmarkResult> Results) {
+            FString Output;
+            auto Writer = TJsonWriterFactory<>::Create(&Output);
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("Platform"), FString(FPlatformProperties::IniPlatformName()));
+            Writer->WriteValue(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+            Writer->WriteArrayStart(TEXT("Results"));
+            for (const FBenchmarkResult &Result : Results) {
+                Writer->WriteObjectStart();
+                Writer->WriteValue(TEXT("Group"), Result.Group);
+                Writer->WriteValue(TEXT("Variant"), Result.Variant);
+                Writer->WriteValue(TEXT("IterationsPerSample"), Result.IterationsPerSample);
+                Writer->WriteValue(TEXT("NumSamples"), Result.NumSamples);
+                Writer->WriteValue(TEXT("MinNs"), Result.MinNanoseconds);
+                Writer->WriteValue(TEXT("MeanNs"), Result.MeanNanoseconds);
+                Writer->WriteValue(TEXT("MedianNs"), Result.MedianNanoseconds);
+                Writer->WriteValue(TEXT("P95Ns"), Result.P95Nanoseconds);
+                Writer->WriteValue(TEXT("P99Ns"), Result.P99Nanoseconds);
+                Writer->WriteValue(TEXT("AllocationsPerIteration"), Result.AllocationsPerIteration);
+                Writer->WriteValue(TEXT("BytesPerIteration"), Result.BytesPerIteration);
+                Writer->WriteValue(TEXT("RelativeToBaseline"), Result.RelativeToBaseline);
+                Writer->WriteObjectEnd();
+            }
+            Writer->WriteArrayEnd();
+            Writer->WriteObjectEnd();
+            Writer->Close();
+            return Output;
+        }
+
+        FString ToCsv(TConstArrayView<FBenchmarkResult> Results) {
+            FString Output = TEXT("Group,Variant,IterationsPerSample,NumSamples,MinNs,MeanNs,MedianNs,P95Ns,P99Ns,"
+                                  "AllocationsPerIteration,BytesPerIteration,RelativeToBaseline\n");
+            for (const FBenchmarkResult &Result : Results) {
+                Output += FString::Printf(TEXT("%s,%s,%lld,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.4f\n"),
+                                          *Result.Group, *Result.Variant, Result.IterationsPerSample,
+                                          Result.NumSamples, Result.MinNanoseconds, Result.MeanNanoseconds,
+                                          Result.MedianNanoseconds, Result.P95Nanoseconds, Result.P99Nanoseconds,
+                                          Result.AllocationsPerIteration, Result.BytesPerIteration,
+                                          Result.RelativeToBaseline);
+            }
+            return Output;
+        }
+    } // namespace
+
+    TArray<FBenchmarkResult> RunBenchmarks(const FBenchmarkSettings &Settings) {
+        if (!FScopedAllocationCounter::IsProxyInstalled()) {
+            UE_LOG(LogRetroBenchmarks, Warning,
+                   TEXT("Allocations are not being counted and will be reported as zero, run with -RetroCountAllocs "
+                        "to record them"));
+        }
+
+        TArray<FBenchmarkResult> Results;
+        for (const FBenchmarkDefinition &Benchmark : GetRegisteredBenchmarks()) {
+            FString Name = Benchmark.GetName();
+            if (!Settings.Filter.IsEmpty() && !Name.Contains(Settings.Filter)) {
+                continue;
+            }
+
+            FBenchmarkResult &Result = Results.Add_GetRef(RunBenchmark(Benchmark, Settings));
+            UE_LOG(LogRetroBenchmarks, Display, TEXT("%-48s median %10.2f ns  p95 %10.2f ns  p99 %10.2f ns  %6.2f allocs"),
+                   *Name, Result.MedianNanoseconds, Result.P95Nanoseconds, Result.P99Nanoseconds,
+                   Result.AllocationsPerIteration);
+        }
+
+        ComputeBaselines(Results);
+        for (const FBenchmarkResult &Result : Results) {
+            if (Result.RelativeToBaseline > 0 && Result.Variant != BaselineVariant) {
+                UE_LOG(LogRetroBenchmarks, Display, TEXT("%s.%s is %.2fx the hand-written loop"), *Result.Group,
+                       *Result.Variant, Result.RelativeToBaseline);
+            }
+        }
+
+        return Results;
+    }
+
+    FString WriteBenchmarkReports(TConstArrayView<FBenchmarkResult> Results, const FString &Directory) {
+        FString OutputDirectory =
+            Directory.IsEmpty() ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks")) : Directory;
+        FString BasePath = FPaths::Combine(
+            OutputDirectory, FString::Printf(TEXT("RetroLib-%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+
+        FFileHelper::SaveStringToFile(ToJson(Results), *(BasePath + TEXT(".json")));
+        FFileHelper::SaveStringToFile(ToCsv(Results), *(BasePath + TEXT(".csv")));
+        UE_LOG(LogRetroBenchmarks, Display, TEXT("Wrote benchmark reports to %s"), *BasePath);
+        return BasePath;
+    }
+} // namespace Retro::Benchmarks
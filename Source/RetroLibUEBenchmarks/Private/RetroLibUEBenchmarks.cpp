@@ -0,0 +1,48 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Modules/ModuleManager.h"
+#include "RetroLib/Benchmarks/Benchmark.h"
+#include "RetroLib/Benchmarks/BenchmarkRunner.h"
+
+namespace {
+    FAutoConsoleCommand RunBenchmarksCommand(
+        TEXT("RetroLib.Benchmarks.Run"),
+        TEXT("Run the RetroLib benchmarks and write the results to Saved/Benchmarks. Takes an optional name filter."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString> &Args) {
+            Retro::Benchmarks::FBenchmarkSettings Settings;
+            if (!Args.IsEmpty()) {
+                Settings.Filter = Args[0];
+            }
+
+            auto Results = Retro::Benchmarks::RunBenchmarks(Settings);
+            Retro::Benchmarks::WriteBenchmarkReports(Results);
+        }));
+} // namespace
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRetroLibBenchmarks, "RetroLib.Benchmarks",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::PerfFilter)
+
+bool FRetroLibBenchmarks::RunTest(const FString &Parameters) {
+    Retro::Benchmarks::FBenchmarkSettings Settings;
+    Settings.Filter = Parameters;
+
+    auto Results = Retro::Benchmarks::RunBenchmarks(Settings);
+    for (const auto &Result : Results) {
+        AddInfo(FString::Printf(TEXT("%s.%s: median %.2f ns, p95 %.2f ns, p99 %.2f ns, %.2f allocations"),
+                                *Result.Group, *Result.Variant, Result.MedianNanoseconds, Result.P95Nanoseconds,
+                                Result.P99Nanoseconds, Result.AllocationsPerIteration));
+    }
+
+    FString ReportPath = Retro::Benchmarks::WriteBenchmarkReports(Results);
+    AddInfo(FString::Printf(TEXT("Reports written to %s"), *ReportPath));
+    return TestFalse(TEXT("Benchmarks were run"), Results.IsEmpty());
+}
+
+#endif
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, RetroLibUEBenchmarks)
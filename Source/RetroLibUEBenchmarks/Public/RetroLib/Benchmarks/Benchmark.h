@@ -0,0 +1,206 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "RetroLib/Memory/AllocationCounter.h"
+
+#include <Containers/Array.h>
+#include <Containers/UnrealString.h>
+#include <HAL/PlatformTime.h>
+#include <Misc/Optional.h>
+
+namespace Retro::Benchmarks {
+
+    /**
+     * The variant name that other variants in the same group are compared against. By convention this is the plain
+     * hand-written loop that the Retro pipeline replaces.
+     */
+    inline const TCHAR *const BaselineVariant = TEXT("Loop");
+
+    /**
+     * State passed to a benchmark body for a single sample. The body performs its setup and then iterates over the
+     * state, doing one unit of work per iteration. Only the iteration loop is timed, and every allocation made on
+     * the benchmark thread during it is counted.
+     *
+     *     RETRO_BENCHMARK(Sum, Loop) {
+     *         TArray<int32> Data = MakeData();
+     *         for (auto _ : State) {
+     *             Retro::Benchmarks::DoNotOptimize(Sum(Data));
+     *         }
+     *     }
+     */
+    class RETROLIBUEBENCHMARKS_API FBenchmarkState {
+      public:
+        struct FIterator {
+            struct FValue {};
+
+            FValue operator*() const {
+                return FValue();
+            }
+
+            FIterator &operator++() {
+                --Remaining;
+                return *this;
+            }
+
+            bool operator!=(const FIterator &) {
+                if (Remaining > 0) [[likely]] {
+                    return true;
+                }
+
+                State->StopTiming();
+                return false;
+            }
+
+            FBenchmarkState *State;
+            int64 Remaining;
+        };
+
+        explicit FBenchmarkState(int64 NumIterations) : NumIterations(NumIterations) {
+        }
+
+        UE_NONCOPYABLE(FBenchmarkState)
+
+        FIterator begin() {
+            check(!bStarted);
+            bStarted = true;
+            StartTiming();
+            return FIterator{this, NumIterations};
+        }
+
+        FIterator end() {
+            return FIterator{this, 0};
+        }
+
+        /**
+         * Get the number of iterations the body is expected to run in this sample.
+         *
+         * @return The number of iterations
+         */
+        int64 GetNumIterations() const {
+            return NumIterations;
+        }
+
+        /**
+         * Get the time spent inside the iteration loop.
+         *
+         * @return The elapsed time in seconds
+         */
+        double GetElapsedSeconds() const {
+            return static_cast<double>(EndCycles - StartCycles) * FPlatformTime::GetSecondsPerCycle64();
+        }
+
+        /**
+         * Get the number of global allocations made inside the iteration loop.
+         *
+         * @return The number of allocations
+         */
+        int64 GetNumAllocations() const {
+            return NumAllocations;
+        }
+
+        /**
+         * Get the number of bytes requested from the global allocator inside the iteration loop.
+         *
+         * @return The number of bytes
+         */
+        int64 GetNumBytes() const {
+            return NumBytes;
+        }
+
+        /**
+         * Check if the body has iterated over the state to completion.
+         *
+         * @return Did the sample run
+         */
+        bool IsComplete() const {
+            return bComplete;
+        }
+
+      private:
+        void StartTiming();
+
+        void StopTiming();
+
+        int64 NumIterations;
+        uint64 StartCycles = 0;
+        uint64 EndCycles = 0;
+        int64 NumAllocations = 0;
+        int64 NumBytes = 0;
+        bool bStarted = false;
+        bool bComplete = false;
+        TOptional<FScopedAllocationCounter> Counter;
+    };
+
+    using FBenchmarkFunction = void (*)(FBenchmarkState &);
+
+    /**
+     * A single registered benchmark.
+     */
+    struct FBenchmarkDefinition {
+        /**
+         * The group the benchmark belongs to. Variants in the same group perform the same work in different ways.
+         */
+        FString Group;
+
+        /**
+         * The name of the variant within its group.
+         */
+        FString Variant;
+
+        /**
+         * The body of the benchmark.
+         */
+        FBenchmarkFunction Function;
+
+        FString GetName() const {
+            return Group + TEXT(".") + Variant;
+        }
+    };
+
+    /**
+     * Get every benchmark that has been registered with RETRO_BENCHMARK.
+     *
+     * @return The registered benchmarks
+     */
+    RETROLIBUEBENCHMARKS_API TArray<FBenchmarkDefinition> &GetRegisteredBenchmarks();
+
+    /**
+     * Static registration helper used by RETRO_BENCHMARK.
+     */
+    struct RETROLIBUEBENCHMARKS_API FBenchmarkRegistration {
+        FBenchmarkRegistration(const TCHAR *Group, const TCHAR *Variant, FBenchmarkFunction Function);
+    };
+
+    namespace Private {
+        RETROLIBUEBENCHMARKS_API void UseCharPointer(const volatile char *);
+    }
+
+    /**
+     * Prevent the compiler from optimizing away the computation of a value that is otherwise unused.
+     *
+     * @tparam T The type of value
+     * @param Value The value to keep alive
+     */
+    template <typename T>
+    FORCEINLINE void DoNotOptimize(const T &Value) {
+#if defined(__clang__) || defined(__GNUC__)
+        asm volatile("" : : "r,m"(Value) : "memory");
+#else
+        Private::UseCharPointer(&reinterpret_cast<const volatile char &>(Value));
+        _ReadWriteBarrier();
+#endif
+    }
+} // namespace Retro::Benchmarks
+
+/**
+ * Define and register a benchmark. The body receives an FBenchmarkState named State that it must iterate over.
+ *
+ * @param Group The group of benchmarks that perform equivalent work
+ * @param Variant The name of this implementation, use Loop for the hand-written baseline
+ */
+#define RETRO_BENCHMARK(Group, Variant)                                                                                \
+    static void RetroBenchmark_##Group##_##Variant(Retro::Benchmarks::FBenchmarkState &State);                         \
+    static Retro::Benchmarks::FBenchmarkRegistration RetroBenchmarkRegistration_##Group##_##Variant(                   \
+        TEXT(#Group), TEXT(#Variant), &RetroBenchmark_##Group##_##Variant);                                            \
+    static void RetroBenchmark_##Group##_##Variant(Retro::Benchmarks::FBenchmarkState &State)
@@ -0,0 +1,78 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Containers/ArrayView.h>
+#include <Containers/UnrealString.h>
+
+namespace Retro::Benchmarks {
+
+    /**
+     * Settings that control how the registered benchmarks are run.
+     */
+    struct FBenchmarkSettings {
+        /**
+         * Only run benchmarks whose full name (Group.Variant) contains this string. Empty runs everything.
+         */
+        FString Filter;
+
+        /**
+         * The number of untimed samples to run before measuring.
+         */
+        int32 NumWarmupSamples = 3;
+
+        /**
+         * The number of timed samples to collect.
+         */
+        int32 NumSamples = 31;
+
+        /**
+         * The minimum duration of a single sample. The number of iterations per sample is scaled up until a sample
+         * takes at least this long, so that timer resolution does not dominate the results.
+         */
+        double MinSampleSeconds = 0.002;
+    };
+
+    /**
+     * The measured results of a single benchmark.
+     */
+    struct FBenchmarkResult {
+        FString Group;
+        FString Variant;
+        int64 IterationsPerSample = 0;
+        int32 NumSamples = 0;
+        double MinNanoseconds = 0;
+        double MeanNanoseconds = 0;
+        double MedianNanoseconds = 0;
+        double P95Nanoseconds = 0;
+        double P99Nanoseconds = 0;
+        double AllocationsPerIteration = 0;
+        double BytesPerIteration = 0;
+
+        /**
+         * The median time of this benchmark divided by the median time of the Loop variant in the same group, or
+         * zero if the group has no baseline.
+         */
+        double RelativeToBaseline = 0;
+    };
+
+    /**
+     * Run every registered benchmark that matches the filter on the calling thread.
+     *
+     * @param Settings The settings to run with
+     * @return The results, grouped in registration order
+     */
+    RETROLIBUEBENCHMARKS_API TArray<FBenchmarkResult> RunBenchmarks(const FBenchmarkSettings &Settings = {});
+
+    /**
+     * Write the results as both JSON and CSV to the given directory. The files are named after the current time so
+     * that successive runs can be compared.
+     *
+     * @param Results The results to write
+     * @param Directory The output directory, defaults to Saved/Benchmarks
+     * @return The path of the written files, without the extension
+     */
+    RETROLIBUEBENCHMARKS_API FString WriteBenchmarkReports(TConstArrayView<FBenchmarkResult> Results,
+                                                           const FString &Directory = FString());
+} // namespace Retro::Benchmarks
@@ -0,0 +1,34 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class RetroLibUEBenchmarks : ModuleRules
+{
+	public RetroLibUEBenchmarks(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// Needed for the throw/catch baseline that the expected pipelines are measured against
+		bEnableExceptions = true;
+		
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"RetroLib",
+				"RetroLibUE"
+			}
+			);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"AssetRegistry",
+				"CoreUObject",
+				"Engine",
+				"Json"
+			}
+			);
+	}
+}